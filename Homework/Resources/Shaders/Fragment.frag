@@ -17,6 +17,60 @@ struct Light
 uniform Light uLight;
 uniform vec3  uViewPos; 
 
+// [߰] Ŭ  . LightManager::PointLight ġ ƾ մϴ.
+struct PointLight
+{
+    vec3  position;
+    float radius;
+    vec3  color;
+    float intensity;
+};
+
+layout(std430, binding = 0) readonly buffer PointLights
+{
+    PointLight pointLights[];
+};
+
+// Ŭ͸ lightIndices  ( ġ, )
+layout(std430, binding = 1) readonly buffer Clusters
+{
+    uvec2 clusters[];
+};
+
+layout(std430, binding = 2) readonly buffer LightIndices
+{
+    uint lightIndices[];
+};
+
+uniform mat4 uView;
+uniform vec3 uClusterGrid;  //  Ÿ ,  Ÿ ,   
+uniform vec2 uClusterDepth; //   = log() * x - y
+uniform vec4 uViewport;     // x, y, ʺ, 
+
+vec3 CalculatePointLight(PointLight light, vec3 norm, vec3 viewDir)
+{
+    vec3  toLight  = light.position - vFragPos;
+    float distance = length(toLight);
+    if (distance >= light.radius)
+    {
+        return vec3(0.0);
+    }
+
+    vec3 lightDir = toLight / distance;
+
+    // Ÿ  ݺϵ, ݰ濡 0 ǵ մϴ.
+    float ratio       = distance / light.radius;
+    float window      = clamp(1.0 - ratio * ratio * ratio * ratio, 0.0, 1.0);
+    float attenuation = window * window / (1.0 + distance * distance);
+
+    float diff = max(dot(norm, lightDir), 0.0);
+
+    vec3  reflectDir = reflect(-lightDir, norm);
+    float spec       = pow(max(dot(viewDir, reflectDir), 0.0), 32);
+
+    return (diff + uLight.specular * spec) * light.color * light.intensity * attenuation;
+}
+
 void main()
 {
     vec3 ambient = uLight.ambient * uLight.color;
@@ -32,6 +86,23 @@ void main()
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32);
     vec3 specular = uLight.specular * spec * uLight.color;  
     
-    vec3 result = (ambient + diffuse + specular) * vColor;
+    vec3 lighting = ambient + diffuse + specular;
+
+    // [߰]  ׸Ʈ  ŬͿ   մϴ.
+    float depth = -(uView * vec4(vFragPos, 1.0)).z;
+    ivec3 grid  = ivec3(uClusterGrid);
+
+    ivec3 cell;
+    cell.xy = ivec2((gl_FragCoord.xy - uViewport.xy) / uViewport.zw * uClusterGrid.xy);
+    cell.z  = int(floor(log(max(depth, 1e-4)) * uClusterDepth.x - uClusterDepth.y));
+    cell    = clamp(cell, ivec3(0), grid - 1);
+
+    uvec2 cluster = clusters[(cell.z * grid.y + cell.y) * grid.x + cell.x];
+    for (uint index = 0; index < cluster.y; ++index)
+    {
+        lighting += CalculatePointLight(pointLights[lightIndices[cluster.x + index]], norm, viewDir);
+    }
+
+    vec3 result = lighting * vColor;
     FragColor = vec4(result, 1.0);
 }
\ No newline at end of file
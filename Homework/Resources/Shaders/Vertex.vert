@@ -3,10 +3,14 @@
 layout(location = 0) in vec3 aPosition;
 layout(location = 1) in vec3 aColor;
 layout(location = 2) in vec3 aNormal;
+layout(location = 3) in vec4 aInstance; // [߰] νϽ (x, y, z, )
 
 uniform mat4 uModel;
 uniform mat4 uView;
 uniform mat4 uProjection;
+uniform bool uInstanced;    // [߰] true uModel  aInstance ġ ̸ մϴ.
+uniform vec3 uInstanceScale; // [߰] νϽ  ũ. (y) aInstance.w ϴ.
+uniform mat3 uNormalMatrix; // CPU  transpose(inverse(mat3(uModel)))
 
 out vec3 vFragPos; // [߰]  ǥ  ġ
 out vec3 vNormal;  // [߰] ȯ  
@@ -16,8 +20,19 @@ void main()
 {
     vColor = aColor;
     
-    vFragPos = vec3(uModel * vec4(aPosition, 1.0));
-    vNormal = mat3(transpose(inverse(uModel))) * aNormal;
+    if (uInstanced)
+    {
+        // ȸ Ƿ     ũ  Ͱ ϴ.
+        vec3 scale = uInstanceScale * vec3(1.0, aInstance.w, 1.0);
+
+        vFragPos = aInstance.xyz + aPosition * scale;
+        vNormal  = aNormal / scale;
+    }
+    else
+    {
+        vFragPos = vec3(uModel * vec4(aPosition, 1.0));
+        vNormal = uNormalMatrix * aNormal;
+    }
 
     gl_Position = uProjection * uView * vec4(vFragPos, 1.0);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "Application.h"
 
 #include "Input.h"
+#include "Random.h"
 
 int Application::Run(const Application::Configuration& configuration_) noexcept
 {
@@ -13,22 +14,36 @@ int Application::Run(const Application::Configuration& configuration_) noexcept
 
 	Load();
 
+	const bool isReplaying = Input::IsReplaying();
+	const auto replayStart = std::chrono::steady_clock::now();
+
 	// 3. 메인 루프
 	while (!glfwWindowShouldClose(window))
 	{
 		glfwPollEvents();
 
+		// 콜백이 쌓은 입력 이벤트로 이번 프레임의 입력 스냅샷을 만듭니다.
+		Input::Update();
+
 		static float previousTime = static_cast<float>(glfwGetTime());
 
+		// 기록하거나 재생하는 중이라면 같은 결과가 나오도록 고정된 시간 간격을 사용합니다.
 		const float currentTime = static_cast<float>(glfwGetTime());
-		const float deltaTime   = currentTime - previousTime;
+		const float deltaTime   = (Input::IsRecording() || isReplaying) ? FIXED_DELTA_TIME : currentTime - previousTime;
 
 		Tick(deltaTime);
 		Display();
 
-		Input::Update();
-
 		previousTime = currentTime;
+
+		// 재생이 끝났다면 걸린 시간을 남기고 종료합니다. 같은 기록으로 성능을 비교할 수 있습니다.
+		// 끝 표시는 기록의 마지막 프레임에 쓰이므로, 그 프레임까지 진행한 뒤에 멈춰야 기록과 프레임 수가 같습니다.
+		if (isReplaying && !Input::IsReplaying())
+		{
+			const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - replayStart;
+			spdlog::info("Replay took {:.1f} ms ({:.3f} ms/frame)", elapsed.count(), elapsed.count() / static_cast<double>(Input::GetFrameIndex()));
+			break;
+		}
 	}
 
 	Close();
@@ -38,6 +53,9 @@ int Application::Run(const Application::Configuration& configuration_) noexcept
 
 void Application::Quit(const int exitCode_) noexcept
 {
+	// std::exit은 Close를 거치지 않으므로 입력 기록을 여기서 마무리합니다.
+	Input::StopRecording();
+
 	std::exit(exitCode_);
 }
 
@@ -77,6 +95,25 @@ bool Application::Initialize() noexcept
 			Input::OnCursorMove(static_cast<int>(x_), static_cast<int>(y_));
 		});
 	}
+	// 입력 기록/재생 (환경 변수)
+	{
+		std::uint32_t seed = std::random_device()();
+
+		if (const char* const replayPath = std::getenv(REPLAY_ENVIRONMENT))
+		{
+			if (Input::StartReplay(replayPath, seed))
+			{
+				Random::Seed(seed);
+			}
+		}
+		else if (const char* const recordPath = std::getenv(RECORD_ENVIRONMENT))
+		{
+			if (Input::StartRecording(recordPath, seed))
+			{
+				Random::Seed(seed);
+			}
+		}
+	}
 	// 2. GLAD 초기화
 	{
 		if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress)))
@@ -141,6 +178,8 @@ void Application::Close() noexcept
 		configuration.onClose();
 	}
 
+	Input::StopRecording();
+
 	glfwDestroyWindow(window);
 	glfwTerminate();
 }
@@ -159,6 +159,21 @@ class Application final
 	 */
 	static void Close() noexcept;
 
+	/**
+	 * @brief 입력을 기록할 파일 경로를 담는 환경 변수.
+	 */
+	static constexpr const char* RECORD_ENVIRONMENT = "CG_INPUT_RECORD";
+
+	/**
+	 * @brief 재생할 입력 기록 파일 경로를 담는 환경 변수. 기록보다 우선합니다.
+	 */
+	static constexpr const char* REPLAY_ENVIRONMENT = "CG_INPUT_REPLAY";
+
+	/**
+	 * @brief 입력을 기록하거나 재생할 때 사용하는 고정 시간 간격(초).
+	 */
+	static constexpr float FIXED_DELTA_TIME = 1.0f / 60.0f;
+
 	/**
 	 * @brief 애플리케이션 설정.
 	 */
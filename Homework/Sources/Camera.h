@@ -148,13 +148,25 @@ class Camera final
 	 * @brief 뷰포트 반환
 	 */
 	[[nodiscard]]
-	inline const Camera::Viewport& GetViewport() noexcept;
+	inline const Camera::Viewport& GetViewport() const noexcept;
 
 	/**
 	 * @brief 뷰포트 설정
 	 */
 	inline void SetViewport(const Viewport& viewport_) noexcept;
 
+	/**
+	 * @brief 근평면 거리 반환
+	 */
+	[[nodiscard]]
+	inline float GetNearPlane() const noexcept;
+
+	/**
+	 * @brief 원평면 거리 반환
+	 */
+	[[nodiscard]]
+	inline float GetFarPlane() const noexcept;
+
 	/**
 	 * @brief View 행렬 반환
 	 */
@@ -259,7 +271,7 @@ inline void Camera::SetUp(const glm::vec3& up_) noexcept
 	up = up_;
 }
 
-inline const Camera::Viewport& Camera::GetViewport() noexcept
+inline const Camera::Viewport& Camera::GetViewport() const noexcept
 {
 	return viewport;
 }
@@ -269,6 +281,16 @@ inline void Camera::SetViewport(const Viewport& viewport_) noexcept
 	viewport = viewport_;
 }
 
+inline float Camera::GetNearPlane() const noexcept
+{
+	return nearPlane;
+}
+
+inline float Camera::GetFarPlane() const noexcept
+{
+	return farPlane;
+}
+
 inline glm::mat4 Camera::GetViewMatrix() const noexcept
 {
 	return glm::lookAt(position, position + forward, up);
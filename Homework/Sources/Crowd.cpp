@@ -0,0 +1,156 @@
+#include "Crowd.h"
+
+#include "FlowField.h"
+#include "Maze.h"
+#include "Mesh.h"
+#include "Resources.h"
+#include "Shader.h"
+
+Crowd::Crowd() noexcept
+	: instanceBuffer(0)
+	, isDirty(true)
+	, mesh(Resources::GetMesh("Resources/Meshes/Player.obj"))
+{
+	glGenBuffers(1, &instanceBuffer);
+}
+
+Crowd::~Crowd() noexcept
+{
+	glDeleteBuffers(1, &instanceBuffer);
+}
+
+void Crowd::Spawn(const Maze&		  maze_,
+				  const std::size_t	  count_,
+				  const std::uint64_t seed_) noexcept
+{
+	positions.clear();
+	speeds.clear();
+	isDirty = true;
+
+	// 방이 하나도 없는 미로에는 배치할 곳이 없습니다.
+	if (maze_.GetWidth() < 3 || maze_.GetHeight() < 3)
+	{
+		return;
+	}
+
+	positions.reserve(count_);
+	speeds.reserve(count_);
+
+	std::mt19937_64						  random(seed_);
+	std::uniform_int_distribution<int>	  roomX(0, (maze_.GetWidth()  - 1) / 2 - 1);
+	std::uniform_int_distribution<int>	  roomY(0, (maze_.GetHeight() - 1) / 2 - 1);
+	std::uniform_real_distribution<float> speed(MIN_SPEED, MAX_SPEED);
+
+	// 방은 모두 통로이므로 방 좌표에서 고르면 다시 뽑을 필요가 없습니다.
+	for (std::size_t index = 0; index < count_; ++index)
+	{
+		const int x = roomX(random) * 2 + 1;
+		const int y = roomY(random) * 2 + 1;
+
+		positions.emplace_back(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+		speeds.push_back(speed(random));
+	}
+}
+
+void Crowd::Update(const FlowField& field_,
+				   const float		deltaTime_) noexcept
+{
+	for (std::size_t index = 0; index < positions.size(); ++index)
+	{
+		glm::vec2& position = positions[index];
+
+		const int		   tileX	 = static_cast<int>(position.x);
+		const int		   tileY	 = static_cast<int>(position.y);
+		const std::uint8_t direction = field_.GetDirection(tileX, tileY);
+		if (direction >= FlowField::GOAL)
+		{
+			continue;
+		}
+
+		// 다음 타일의 중심으로 곧게 이동합니다. 두 타일을 합친 사각형 안에서만 움직이므로 벽을 뚫지 않습니다.
+		const glm::vec2 target = glm::vec2(static_cast<float>(tileX + FlowField::DX[direction]) + 0.5f,
+										   static_cast<float>(tileY + FlowField::DY[direction]) + 0.5f);
+
+		const glm::vec2 delta	 = target - position;
+		const float		distance = glm::length(delta);
+		const float		step	 = speeds[index] * deltaTime_;
+
+		position = step >= distance ? target : position + delta * (step / distance);
+	}
+
+	isDirty = true;
+}
+
+void Crowd::Render(const glm::vec3& origin_) noexcept
+{
+	if (!mesh || positions.empty())
+	{
+		return;
+	}
+
+	if (isDirty)
+	{
+		// 플레이어처럼 타일 위(높이 0.1)에 발을 붙입니다.
+		const float y = origin_.y + 0.1f + AGENT_SCALE * 0.5f;
+
+		instances.resize(positions.size());
+		for (std::size_t index = 0; index < positions.size(); ++index)
+		{
+			instances[index] = glm::vec4(origin_.x + positions[index].x, y, origin_.z + positions[index].y, 1.0f);
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+		glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(glm::vec4) * instances.size()), instances.data(), GL_STREAM_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		isDirty = false;
+	}
+
+	Shader::SetUniformInt("uInstanced", 1);
+	Shader::SetUniformVector3("uInstanceScale", glm::vec3(AGENT_SCALE));
+
+	mesh->RenderInstanced(instanceBuffer, static_cast<GLsizei>(positions.size()));
+
+	Shader::SetUniformInt("uInstanced", 0);
+}
+
+void Crowd::Benchmark() noexcept
+{
+	constexpr int		  SIZE		  = 4096;
+	constexpr std::size_t AGENT_COUNT = 100000;
+	constexpr int		  FRAME_COUNT = 60;
+
+	Maze maze;
+	maze.Generate(SIZE, SIZE, Maze::Algorithm::Backtracker, 42);
+
+	// 1. 흐름장 계산. 목표는 중앙에 가장 가까운 방입니다.
+	const glm::ivec2 goal = glm::ivec2((SIZE / 2) | 1, (SIZE / 2) | 1);
+
+	FlowField field;
+	for (const int threadCount : { 1, static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u)) })
+	{
+		const auto start = std::chrono::steady_clock::now();
+		field.Compute(maze, goal, threadCount);
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+		spdlog::info("Flow field {}x{} ({} threads): {:.1f} ms, max distance {}",
+					 SIZE,
+					 SIZE,
+					 threadCount,
+					 elapsed.count(),
+					 field.GetMaxDistance());
+	}
+
+	// 2. 에이전트 갱신.
+	Crowd crowd;
+	crowd.Spawn(maze, AGENT_COUNT, 42);
+
+	const auto start = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < FRAME_COUNT; ++frame)
+	{
+		crowd.Update(field, 1.0f / 60.0f);
+	}
+	const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+	spdlog::info("Crowd {} agents: {:.3f} ms per update", crowd.GetCount(), elapsed.count() / FRAME_COUNT);
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "PCH.h"
+
+class FlowField;
+class Maze;
+class Mesh;
+
+/**
+ * @brief 흐름장을 따라 미로를 이동하는 에이전트 무리.
+ *
+ * 에이전트는 위치와 속력만 가지며(SoA), 매 갱신마다 자기 타일의 방향을 읽어 다음 타일의 중심으로 이동합니다.
+ * 모든 에이전트는 플레이어 메쉬의 인스턴스로 한 번에 그립니다.
+ */
+class Crowd final
+{
+public:
+	/**
+	 * @brief 생성자.
+	 */
+	explicit Crowd() noexcept;
+
+	/**
+	 * @brief 소멸자.
+	 */
+	~Crowd() noexcept;
+
+	Crowd(const Crowd&) = delete;
+	Crowd& operator=(const Crowd&) = delete;
+
+	/**
+	 * @brief 미로의 무작위 통로 타일에 에이전트들을 배치합니다. 기존 에이전트는 지워집니다.
+	 *
+	 * @param maze_	 대상 미로
+	 * @param count_ 에이전트 수
+	 * @param seed_	 난수 시드
+	 */
+	void Spawn(const Maze&		   maze_,
+			   const std::size_t   count_,
+			   const std::uint64_t seed_) noexcept;
+
+	/**
+	 * @brief 모든 에이전트를 흐름장을 따라 이동시킵니다. 목표에 닿았거나 닿을 수 없는 에이전트는 멈춥니다.
+	 *
+	 * @param field_	 따라갈 흐름장
+	 * @param deltaTime_ 이전 프레임과 현재 프레임 사이의 시간 간격
+	 */
+	void Update(const FlowField& field_,
+				const float		 deltaTime_) noexcept;
+
+	/**
+	 * @brief 모든 에이전트를 그립니다. 갱신된 이후 처음 그릴 때만 인스턴스 버퍼를 다시 올립니다.
+	 *
+	 * @param origin_ 타일 (0, 0)의 모서리에 해당하는 월드 좌표
+	 */
+	void Render(const glm::vec3& origin_) noexcept;
+
+	/**
+	 * @brief 에이전트 수를 반환합니다.
+	 *
+	 * @return std::size_t 에이전트 수
+	 */
+	[[nodiscard]]
+	inline std::size_t GetCount() const noexcept;
+
+	/**
+	 * @brief 4096 x 4096 미로에서 흐름장 계산과 에이전트 100000개의 갱신에 걸린 시간을 로그로 남깁니다.
+	 */
+	static void Benchmark() noexcept;
+
+private:
+	/**
+	 * @brief 에이전트의 크기. 플레이어와 같습니다.
+	 */
+	static constexpr float AGENT_SCALE = 0.25f;
+
+	/**
+	 * @brief 에이전트의 최소 속력(타일/초).
+	 */
+	static constexpr float MIN_SPEED = 1.5f;
+
+	/**
+	 * @brief 에이전트의 최대 속력(타일/초).
+	 */
+	static constexpr float MAX_SPEED = 3.0f;
+
+	/**
+	 * @brief 타일 좌표계 상의 위치. 타일 (x, y)의 중심은 (x + 0.5, y + 0.5) 입니다.
+	 */
+	std::vector<glm::vec2> positions;
+
+	/**
+	 * @brief 속력(타일/초).
+	 */
+	std::vector<float> speeds;
+
+	/**
+	 * @brief 인스턴스 버퍼에 올릴 값들. 인스턴스마다 (x, y, z, 1)입니다.
+	 */
+	std::vector<glm::vec4> instances;
+
+	/**
+	 * @brief 인스턴스 버퍼.
+	 */
+	GLuint instanceBuffer;
+
+	/**
+	 * @brief 마지막으로 그린 이후 위치가 바뀌었는지 여부.
+	 */
+	bool isDirty;
+
+	/**
+	 * @brief 에이전트 메쉬.
+	 */
+	Mesh* mesh;
+};
+
+inline std::size_t Crowd::GetCount() const noexcept
+{
+	return positions.size();
+}
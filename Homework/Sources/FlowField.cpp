@@ -0,0 +1,203 @@
+#include "FlowField.h"
+
+#include "Maze.h"
+
+FlowField::FlowField() noexcept
+	: width(0)
+	, height(0)
+	, pitch(0)
+	, goal(-1, -1)
+	, maxDistance(0)
+	, words(nullptr)
+	, distance(0)
+	, threadCount(1)
+	, isStopping(false)
+{
+}
+
+FlowField::~FlowField() noexcept
+{
+	StopWorkers();
+}
+
+void FlowField::Compute(const Maze&		  maze_,
+						const glm::ivec2& goal_,
+						const int		  threadCount_) noexcept
+{
+	width		= maze_.GetWidth();
+	height		= maze_.GetHeight();
+	pitch		= height > 0 ? maze_.GetRow(0).size() * 64 : 0;
+	goal		= goal_;
+	maxDistance = 0;
+
+	distances.assign(pitch * height, INFINITE_DISTANCE);
+	directions.assign(pitch * height, UNREACHABLE);
+
+	frontier.clear();
+	next.clear();
+
+	if (!maze_.IsOpen(goal_.x, goal_.y))
+	{
+		return;
+	}
+
+	// 미로의 비트는 행마다 연속이므로, 첫 행부터 pitch 간격으로 모든 타일을 가리킬 수 있습니다.
+	words = maze_.GetRow(0).data();
+
+	const std::uint32_t goalIndex = static_cast<std::uint32_t>(goal_.y * pitch + goal_.x);
+	distances[goalIndex]  = 0;
+	directions[goalIndex] = GOAL;
+	frontier.push_back(goalIndex);
+
+	if (threadCount_ <= 1)
+	{
+		for (distance = 1; !frontier.empty(); ++distance)
+		{
+			Expand(words, frontier, distance, false, next);
+			if (!next.empty())
+			{
+				maxDistance = distance;
+			}
+
+			frontier.swap(next);
+			next.clear();
+		}
+
+		return;
+	}
+
+	// 작업 스레드들은 계산 사이에도 장벽에서 대기하며, 파면이 넓을 때만 깨어나 자기 몫을 넓힙니다.
+	if (threadCount_ != threadCount)
+	{
+		StartWorkers(threadCount_);
+	}
+
+	for (distance = 1; !frontier.empty(); ++distance)
+	{
+		if (frontier.size() < PARALLEL_THRESHOLD)
+		{
+			Expand(words, frontier, distance, false, next);
+		}
+		else
+		{
+			sync->arrive_and_wait();
+			ExpandSlice(0);
+			sync->arrive_and_wait();
+
+			for (const std::vector<std::uint32_t>& threadNext : threadNexts)
+			{
+				next.insert(next.end(), threadNext.begin(), threadNext.end());
+			}
+		}
+
+		if (!next.empty())
+		{
+			maxDistance = distance;
+		}
+
+		frontier.swap(next);
+		next.clear();
+	}
+}
+
+void FlowField::StartWorkers(const int threadCount_) noexcept
+{
+	StopWorkers();
+
+	threadCount = threadCount_;
+	isStopping	= false;
+	sync		= std::make_unique<std::barrier<>>(threadCount);
+	threadNexts.assign(threadCount, {});
+
+	workers.reserve(threadCount - 1);
+
+	for (int thread = 1; thread < threadCount; ++thread)
+	{
+		workers.emplace_back([this, thread]
+		{
+			while (true)
+			{
+				sync->arrive_and_wait();
+				if (isStopping)
+				{
+					break;
+				}
+
+				ExpandSlice(thread);
+				sync->arrive_and_wait();
+			}
+		});
+	}
+}
+
+void FlowField::StopWorkers() noexcept
+{
+	if (workers.empty())
+	{
+		return;
+	}
+
+	isStopping = true;
+	sync->arrive_and_wait();
+
+	workers.clear();
+	threadCount = 1;
+}
+
+void FlowField::ExpandSlice(const int thread_) noexcept
+{
+	const std::span<const std::uint32_t> tiles = frontier;
+	const std::size_t					 first = tiles.size() * thread_		  / threadCount;
+	const std::size_t					 last  = tiles.size() * (thread_ + 1) / threadCount;
+
+	threadNexts[thread_].clear();
+	Expand(words, tiles.subspan(first, last - first), distance, true, threadNexts[thread_]);
+}
+
+void FlowField::Expand(const std::uint64_t* const	  words_,
+					   std::span<const std::uint32_t> tiles_,
+					   const std::uint32_t			  distance_,
+					   const bool					  isConcurrent_,
+					   std::vector<std::uint32_t>&	  next_) noexcept
+{
+	// 방향별 인덱스 이동량. 미로의 가장자리는 항상 벽이므로 통로 타일의 이웃은 범위를 벗어나지 않습니다.
+	const std::ptrdiff_t offsets[4] = { 1, static_cast<std::ptrdiff_t>(pitch), -1, -static_cast<std::ptrdiff_t>(pitch) };
+
+	for (const std::uint32_t tile : tiles_)
+	{
+		for (int direction = 0; direction < 4; ++direction)
+		{
+			const std::uint32_t neighbor = static_cast<std::uint32_t>(tile + offsets[direction]);
+			if (!((words_[neighbor >> 6] >> (neighbor & 63)) & 1))
+			{
+				continue;
+			}
+
+			// 여러 스레드가 같은 타일에 닿을 수 있으므로, 먼저 거리를 기록한 스레드만 타일을 가져갑니다.
+			if (isConcurrent_)
+			{
+				std::atomic_ref<std::uint32_t> slot(distances[neighbor]);
+
+				std::uint32_t expected = INFINITE_DISTANCE;
+				if (slot.load(std::memory_order_relaxed) != INFINITE_DISTANCE
+					|| !slot.compare_exchange_strong(expected, distance_, std::memory_order_relaxed))
+				{
+					continue;
+				}
+			}
+			else
+			{
+				if (distances[neighbor] != INFINITE_DISTANCE)
+				{
+					continue;
+				}
+
+				distances[neighbor] = distance_;
+			}
+
+			// 이웃에서 목표로 가려면 지금 타일로 돌아와야 하므로 반대 방향을 기록합니다.
+			directions[neighbor] = static_cast<std::uint8_t>((direction + 2) & 3);
+			next_.push_back(neighbor);
+		}
+	}
+}
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "PCH.h"
+
+class Maze;
+
+/**
+ * @brief 목표 타일로부터의 거리와 다음 한 걸음의 방향을 미로의 모든 타일에 대해 담는 흐름장(flow field).
+ *
+ * 한 번의 너비 우선 탐색으로 만들며, 에이전트는 자기 타일의 방향만 읽으면 되므로 에이전트 수와 무관하게 O(1)로 길을 찾습니다.
+ * 타일은 미로의 비트와 같은 배치(행마다 64의 배수 폭)로 저장하므로, 비트 위치가 곧 배열 인덱스입니다.
+ * 여러 스레드로 계산할 때의 작업 스레드는 흐름장과 함께 살아 있으며, 계산하지 않는 동안 장벽에서 대기합니다.
+ */
+class FlowField final
+{
+public:
+	/**
+	 * @brief 목표 타일의 방향 값.
+	 */
+	static constexpr std::uint8_t GOAL = 4;
+
+	/**
+	 * @brief 목표에 닿을 수 없는 타일의 방향 값.
+	 */
+	static constexpr std::uint8_t UNREACHABLE = 0xFF;
+
+	/**
+	 * @brief 목표에 닿을 수 없는 타일의 거리 값.
+	 */
+	static constexpr std::uint32_t INFINITE_DISTANCE = std::numeric_limits<std::uint32_t>::max();
+
+	/**
+	 * @brief 방향별 x 이동량. 순서는 +x, +y, -x, -y 이며 미로 생성기와 같습니다.
+	 */
+	static constexpr int DX[4] = { 1, 0, -1,  0 };
+
+	/**
+	 * @brief 방향별 y 이동량.
+	 */
+	static constexpr int DY[4] = { 0, 1,  0, -1 };
+
+	/**
+	 * @brief 생성자. 비어 있는 흐름장을 만듭니다.
+	 */
+	explicit FlowField() noexcept;
+
+	/**
+	 * @brief 소멸자. 작업 스레드들을 종료합니다.
+	 */
+	~FlowField() noexcept;
+
+	FlowField(const FlowField&) = delete;
+	FlowField& operator=(const FlowField&) = delete;
+
+	/**
+	 * @brief 지정한 미로에서 목표까지의 흐름장을 계산합니다.
+	 *
+	 * 거리가 같은 타일들(파면)을 한 단계씩 넓혀 가며, 파면이 충분히 넓을 때만 여러 스레드로 나누어 넓힙니다.
+	 *
+	 * @param maze_		   대상 미로
+	 * @param goal_		   목표 타일 좌표. 벽이라면 모든 타일이 닿을 수 없게 됩니다.
+	 * @param threadCount_ 사용할 스레드 수. 1이면 현재 스레드에서만 계산합니다. 이전 계산과 수가 다를 때만 작업 스레드를 다시 만듭니다.
+	 */
+	void Compute(const Maze&	   maze_,
+				 const glm::ivec2& goal_,
+				 const int		   threadCount_ = 1) noexcept;
+
+	/**
+	 * @brief 지정한 타일에서 목표까지의 거리를 반환합니다.
+	 *
+	 * @param x_ 타일 x 좌표
+	 * @param y_ 타일 y 좌표
+	 *
+	 * @return std::uint32_t 거리. 닿을 수 없다면 INFINITE_DISTANCE입니다.
+	 */
+	[[nodiscard]]
+	inline std::uint32_t GetDistance(const int x_, const int y_) const noexcept;
+
+	/**
+	 * @brief 지정한 타일에서 목표로 가기 위한 다음 방향을 반환합니다.
+	 *
+	 * @param x_ 타일 x 좌표
+	 * @param y_ 타일 y 좌표
+	 *
+	 * @return std::uint8_t 방향(0 ~ 3), 목표라면 GOAL, 닿을 수 없다면 UNREACHABLE
+	 */
+	[[nodiscard]]
+	inline std::uint8_t GetDirection(const int x_, const int y_) const noexcept;
+
+	/**
+	 * @brief 목표 타일 좌표를 반환합니다.
+	 *
+	 * @return glm::ivec2 목표 타일 좌표
+	 */
+	[[nodiscard]]
+	inline glm::ivec2 GetGoal() const noexcept;
+
+	/**
+	 * @brief 목표에서 가장 먼 타일까지의 거리를 반환합니다.
+	 *
+	 * @return std::uint32_t 가장 먼 거리
+	 */
+	[[nodiscard]]
+	inline std::uint32_t GetMaxDistance() const noexcept;
+
+private:
+	/**
+	 * @brief 작업 스레드를 지정한 수에 맞춰 다시 만듭니다.
+	 *
+	 * @param threadCount_ 호출한 스레드를 포함한 스레드 수
+	 */
+	void StartWorkers(const int threadCount_) noexcept;
+
+	/**
+	 * @brief 작업 스레드들을 깨워 종료시키고 합류합니다.
+	 */
+	void StopWorkers() noexcept;
+
+	/**
+	 * @brief 현재 파면 중 지정한 스레드의 몫을 넓혀 그 스레드의 다음 파면에 담습니다.
+	 *
+	 * @param thread_ 스레드 번호. 0은 Compute를 호출한 스레드입니다.
+	 */
+	void ExpandSlice(const int thread_) noexcept;
+
+	/**
+	 * @brief 파면의 일부를 한 단계 넓힙니다.
+	 *
+	 * @param words_		미로의 타일 비트
+	 * @param tiles_		넓힐 파면 타일들
+	 * @param distance_		넓혀진 타일들에 기록할 거리
+	 * @param isConcurrent_ 다른 스레드와 같은 배열을 기록하는지 여부. true라면 원자적으로 타일을 차지합니다.
+	 * @param next_			새로 닿은 타일을 추가할 위치
+	 */
+	void Expand(const std::uint64_t* const	   words_,
+				std::span<const std::uint32_t> tiles_,
+				const std::uint32_t			   distance_,
+				const bool					   isConcurrent_,
+				std::vector<std::uint32_t>&	   next_) noexcept;
+
+	/**
+	 * @brief 여러 스레드로 나누어 넓힐 최소 파면 크기. 이보다 좁다면 동기화 비용이 더 큽니다.
+	 */
+	static constexpr std::size_t PARALLEL_THRESHOLD = 4096;
+
+	/**
+	 * @brief 타일 단위 너비.
+	 */
+	int width;
+
+	/**
+	 * @brief 타일 단위 높이.
+	 */
+	int height;
+
+	/**
+	 * @brief 한 행의 타일 수. 미로의 한 행 워드 수 * 64 입니다.
+	 */
+	std::size_t pitch;
+
+	/**
+	 * @brief 목표 타일 좌표.
+	 */
+	glm::ivec2 goal;
+
+	/**
+	 * @brief 목표에서 가장 먼 타일까지의 거리.
+	 */
+	std::uint32_t maxDistance;
+
+	/**
+	 * @brief 타일별 목표까지의 거리.
+	 */
+	std::vector<std::uint32_t> distances;
+
+	/**
+	 * @brief 타일별 다음 방향.
+	 */
+	std::vector<std::uint8_t> directions;
+
+	/**
+	 * @brief 현재 파면. 계산할 때마다 재사용합니다.
+	 */
+	std::vector<std::uint32_t> frontier;
+
+	/**
+	 * @brief 다음 파면. 계산할 때마다 재사용합니다.
+	 */
+	std::vector<std::uint32_t> next;
+
+	/**
+	 * @brief 계산 중인 미로의 타일 비트. 작업 스레드가 읽습니다.
+	 */
+	const std::uint64_t* words;
+
+	/**
+	 * @brief 지금 넓히는 파면에 기록할 거리. 작업 스레드가 읽습니다.
+	 */
+	std::uint32_t distance;
+
+	/**
+	 * @brief 작업 스레드를 포함한 스레드 수. 작업 스레드가 없다면 1입니다.
+	 */
+	int threadCount;
+
+	/**
+	 * @brief 호출한 스레드와 작업 스레드들이 파면 하나를 넓히기 전후에 만나는 장벽.
+	 */
+	std::unique_ptr<std::barrier<>> sync;
+
+	/**
+	 * @brief 스레드별 다음 파면.
+	 */
+	std::vector<std::vector<std::uint32_t>> threadNexts;
+
+	/**
+	 * @brief 작업 스레드들이 종료해야 하는지 여부.
+	 */
+	bool isStopping;
+
+	/**
+	 * @brief 작업 스레드들.
+	 */
+	std::vector<std::jthread> workers;
+};
+
+inline std::uint32_t FlowField::GetDistance(const int x_, const int y_) const noexcept
+{
+	if (x_ < 0 || y_ < 0 || x_ >= width || y_ >= height)
+	{
+		return INFINITE_DISTANCE;
+	}
+
+	return distances[y_ * pitch + x_];
+}
+
+inline std::uint8_t FlowField::GetDirection(const int x_, const int y_) const noexcept
+{
+	if (x_ < 0 || y_ < 0 || x_ >= width || y_ >= height)
+	{
+		return UNREACHABLE;
+	}
+
+	return directions[y_ * pitch + x_];
+}
+
+inline glm::ivec2 FlowField::GetGoal() const noexcept
+{
+	return goal;
+}
+
+inline std::uint32_t FlowField::GetMaxDistance() const noexcept
+{
+	return maxDistance;
+}
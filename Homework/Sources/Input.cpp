@@ -1,115 +1,409 @@
 #include "Input.h"
 
+/**
+ * @brief 부호 없는 정수를 7비트씩 나누어 씁니다. (LEB128)
+ */
+static void WriteVarint(std::ostream& stream_, std::uint64_t value_) noexcept;
+
+/**
+ * @brief WriteVarint로 쓴 정수를 읽습니다.
+ *
+ * @return bool 읽었다면 true, 파일의 끝이거나 잘못된 값이라면 false
+ */
+static bool ReadVarint(std::istream& stream_, std::uint64_t& value_) noexcept;
+
 void Input::Update() noexcept
 {
-	for (KeyState& keyState : keyStates)
+	const double now = glfwGetTime();
+	++frameIndex;
+
+	// 1. 이전 프레임의 눌림/떼어짐을 지웁니다. 누르고 있는 상태는 이벤트가 올 때만 바뀝니다.
+	snapshot.pressedKeys.reset();
+	snapshot.releasedKeys.reset();
+	snapshot.pressedMouseButtons.reset();
+	snapshot.releasedMouseButtons.reset();
+
+	snapshot.lastMousePosition = snapshot.mousePosition;
+	snapshot.time			   = now;
+	snapshot.latency		   = 0.0;
+	snapshot.eventCount		   = 0;
+
+	std::size_t		  head = eventHead.load(std::memory_order_relaxed);
+	const std::size_t tail = eventTail.load(std::memory_order_acquire);
+
+	// 2. 재생 중이라면 실제 입력은 버리고, 이번 프레임에 기록된 이벤트만 반영합니다.
+	if (IsReplaying())
 	{
-		switch (keyState)
+		eventHead.store(tail, std::memory_order_release);
+
+		while (IsReplaying() && traceFrame == frameIndex)
 		{
-			case KeyState::Press:
-			{
-				keyState = KeyState::Hold;
-				break;
-			}
-			case KeyState::Release:
-			{
-				keyState = KeyState::Idle;
-				break;
-			}
-			default:
+			ApplyEvent(replayEvent);
+			++snapshot.eventCount;
+
+			if (replayEvent.type == EventType::End || !ReadEvent())
 			{
-				break;
+				spdlog::info("Input replay finished at frame {}", frameIndex);
+				replayStream.close();
 			}
 		}
+
+		return;
+	}
+
+	// 3. 쌓인 이벤트를 들어온 순서대로 반영하고, 기록 중이라면 같은 순서로 남깁니다.
+	if (head != tail)
+	{
+		snapshot.latency	= now - events[head & (EVENT_CAPACITY - 1)].time;
+		snapshot.eventCount = tail - head;
 	}
 
-	for (KeyState& mouseButtonState : mouseButtonStates)
+	for (; head != tail; ++head)
 	{
-		switch (mouseButtonState)
+		const Event& event = events[head & (EVENT_CAPACITY - 1)];
+
+		ApplyEvent(event);
+		if (IsRecording())
 		{
-			case KeyState::Press:
+			WriteEvent(event);
+		}
+	}
+
+	eventHead.store(tail, std::memory_order_release);
+}
+
+bool Input::StartRecording(const std::filesystem::path& path_,
+						   const std::uint32_t			seed_) noexcept
+{
+	StopRecording();
+
+	recordStream.open(path_, std::ios::binary | std::ios::trunc);
+	if (!recordStream.is_open())
+	{
+		spdlog::error("Failed to open input trace for recording: {}", path_.string());
+		return false;
+	}
+
+	recordStream.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+	recordStream.put(static_cast<char>(TRACE_VERSION));
+	for (int shift = 0; shift < 32; shift += 8)
+	{
+		recordStream.put(static_cast<char>((seed_ >> shift) & 0xFF));
+	}
+
+	traceFrame	= frameIndex;
+	traceCursor = glm::ivec2(0, 0);
+
+	spdlog::info("Recording input to {} (seed {})", path_.string(), seed_);
+	return true;
+}
+
+void Input::StopRecording() noexcept
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	// 마지막 이벤트 이후에도 프레임이 이어졌을 수 있으므로, 끝난 프레임을 남겨 재생 길이를 맞춥니다.
+	Event end = { };
+	end.type = EventType::End;
+	WriteEvent(end);
+
+	recordStream.close();
+}
+
+bool Input::StartReplay(const std::filesystem::path& path_,
+						std::uint32_t&				 seed_) noexcept
+{
+	replayStream.open(path_, std::ios::binary);
+	if (!replayStream.is_open())
+	{
+		spdlog::error("Failed to open input trace for replay: {}", path_.string());
+		return false;
+	}
+
+	char		 magic[sizeof(TRACE_MAGIC)] = { };
+	std::uint8_t header[5]					= { };
+
+	replayStream.read(magic, sizeof(magic));
+	replayStream.read(reinterpret_cast<char*>(header), sizeof(header));
+
+	if (!replayStream || std::memcmp(magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0 || header[0] != TRACE_VERSION)
+	{
+		spdlog::error("Invalid input trace: {}", path_.string());
+		replayStream.close();
+		return false;
+	}
+
+	seed_ = static_cast<std::uint32_t>(header[1])
+		  | static_cast<std::uint32_t>(header[2]) << 8
+		  | static_cast<std::uint32_t>(header[3]) << 16
+		  | static_cast<std::uint32_t>(header[4]) << 24;
+
+	traceFrame	= frameIndex;
+	traceCursor = glm::ivec2(0, 0);
+
+	if (!ReadEvent())
+	{
+		spdlog::error("Empty input trace: {}", path_.string());
+		replayStream.close();
+		return false;
+	}
+
+	spdlog::info("Replaying input from {} (seed {})", path_.string(), seed_);
+	return true;
+}
+
+void Input::OnKeyInteract(int key, int scancode, int action, int mods) noexcept
+{
+	if (key < 0 || key >= static_cast<int>(MAX_KEYS) || action == GLFW_REPEAT)
+	{
+		return;
+	}
+
+	Event event = { };
+	event.time	 = glfwGetTime();
+	event.code	 = key;
+	event.action = action;
+	event.mods	 = mods;
+	event.type	 = EventType::Key;
+
+	PushEvent(event);
+}
+
+void Input::OnMouseButtonInteract(int button, int action, int mods) noexcept
+{
+	if (button < 0 || button >= MAX_MOUSE_BUTTONS)
+	{
+		return;
+	}
+
+	Event event = { };
+	event.time	 = glfwGetTime();
+	event.code	 = button;
+	event.action = action;
+	event.mods	 = mods;
+	event.type	 = EventType::MouseButton;
+
+	PushEvent(event);
+}
+
+void Input::OnCursorMove(double xpos, double ypos) noexcept
+{
+	Event event = { };
+	event.time	   = glfwGetTime();
+	event.position = glm::vec2(static_cast<float>(xpos), static_cast<float>(ypos));
+	event.type	   = EventType::CursorMove;
+
+	PushEvent(event);
+}
+
+bool Input::PushEvent(const Event& event_) noexcept
+{
+	const std::size_t tail = eventTail.load(std::memory_order_relaxed);
+
+	if (tail - eventHead.load(std::memory_order_acquire) == EVENT_CAPACITY)
+	{
+		spdlog::warn("Input event queue is full. Event dropped.");
+		return false;
+	}
+
+	events[tail & (EVENT_CAPACITY - 1)] = event_;
+	eventTail.store(tail + 1, std::memory_order_release);
+
+	return true;
+}
+
+void Input::ApplyEvent(const Event& event_) noexcept
+{
+	switch (event_.type)
+	{
+		case EventType::Key:
+		{
+			if (event_.action == GLFW_PRESS)
+			{
+				snapshot.heldKeys.set(event_.code);
+				snapshot.pressedKeys.set(event_.code);
+			}
+			else if (event_.action == GLFW_RELEASE)
 			{
-				mouseButtonState = KeyState::Hold;
-				break;
+				snapshot.heldKeys.reset(event_.code);
+				snapshot.releasedKeys.set(event_.code);
 			}
-			case KeyState::Release:
+
+			snapshot.mods = event_.mods;
+			break;
+		}
+		case EventType::MouseButton:
+		{
+			if (event_.action == GLFW_PRESS)
 			{
-				mouseButtonState = KeyState::Idle;
-				break;
+				snapshot.heldMouseButtons.set(event_.code);
+				snapshot.pressedMouseButtons.set(event_.code);
 			}
-			default:
+			else if (event_.action == GLFW_RELEASE)
 			{
-				break;
+				snapshot.heldMouseButtons.reset(event_.code);
+				snapshot.releasedMouseButtons.set(event_.code);
 			}
+
+			snapshot.mods = event_.mods;
+			break;
+		}
+		case EventType::CursorMove:
+		{
+			snapshot.mousePosition = event_.position;
+			break;
+		}
+		case EventType::End:
+		{
+			break;
 		}
 	}
 }
 
-void Input::OnKeyInteract(int key, int scancode, int action, int mods) noexcept
+void Input::WriteEvent(const Event& event_) noexcept
 {
-	if (key < 0 || key >= static_cast<int>(MAX_KEYS))
-	{
-		return;
-	}
-	switch (action)
+	WriteVarint(recordStream, frameIndex - traceFrame);
+	recordStream.put(static_cast<char>(static_cast<int>(event_.type) | (event_.action == GLFW_PRESS ? 4 : 0)));
+	traceFrame = frameIndex;
+
+	switch (event_.type)
 	{
-		case GLFW_PRESS:
+		case EventType::Key:
+		case EventType::MouseButton:
 		{
-			keyStates[key] = KeyState::Press;
+			WriteVarint(recordStream, static_cast<std::uint64_t>(event_.code));
+			recordStream.put(static_cast<char>(event_.mods));
 			break;
 		}
-		case GLFW_RELEASE:
+		case EventType::CursorMove:
 		{
-			keyStates[key] = KeyState::Release;
+			// 커서 좌표는 정수이므로 이전 위치와의 차이를 지그재그 부호화하여 작게 남깁니다.
+			const glm::ivec2 position = glm::ivec2(event_.position);
+			for (const std::int64_t delta : { std::int64_t(position.x - traceCursor.x), std::int64_t(position.y - traceCursor.y) })
+			{
+				WriteVarint(recordStream, static_cast<std::uint64_t>((delta << 1) ^ (delta >> 63)));
+			}
+
+			traceCursor = position;
 			break;
 		}
-		default:
+		case EventType::End:
 		{
 			break;
 		}
 	}
-
-	currentMods = mods;
 }
 
-void Input::OnMouseButtonInteract(int button, int action, int mods) noexcept
+bool Input::ReadEvent() noexcept
 {
-	if (button < 0 || button >= MAX_MOUSE_BUTTONS)
+	std::uint64_t frameDelta = 0;
+	if (!ReadVarint(replayStream, frameDelta))
 	{
-		return;
+		return false;
+	}
+
+	const int header = replayStream.get();
+	if (header == EOF || (header & 3) > static_cast<int>(EventType::End))
+	{
+		return false;
 	}
-	switch (action)
+
+	replayEvent		   = { };
+	replayEvent.type   = static_cast<EventType>(header & 3);
+	replayEvent.action = (header & 4) ? GLFW_PRESS : GLFW_RELEASE;
+	traceFrame		  += frameDelta;
+
+	switch (replayEvent.type)
 	{
-		case GLFW_PRESS:
+		case EventType::Key:
+		case EventType::MouseButton:
 		{
-			mouseButtonStates[button] = KeyState::Press;
+			std::uint64_t code = 0;
+			const int	  mods = ReadVarint(replayStream, code) ? replayStream.get() : EOF;
+			if (mods == EOF || code >= (replayEvent.type == EventType::Key ? MAX_KEYS : MAX_MOUSE_BUTTONS))
+			{
+				return false;
+			}
+
+			replayEvent.code = static_cast<int>(code);
+			replayEvent.mods = mods;
 			break;
 		}
-		case GLFW_RELEASE:
+		case EventType::CursorMove:
 		{
-			mouseButtonStates[button] = KeyState::Release;
+			std::uint64_t deltas[2] = { };
+			if (!ReadVarint(replayStream, deltas[0]) || !ReadVarint(replayStream, deltas[1]))
+			{
+				return false;
+			}
+
+			traceCursor.x += static_cast<int>(static_cast<std::int64_t>(deltas[0] >> 1) ^ -static_cast<std::int64_t>(deltas[0] & 1));
+			traceCursor.y += static_cast<int>(static_cast<std::int64_t>(deltas[1] >> 1) ^ -static_cast<std::int64_t>(deltas[1] & 1));
+
+			replayEvent.position = glm::vec2(traceCursor);
 			break;
 		}
-		default:
+		case EventType::End:
 		{
 			break;
 		}
 	}
-	currentMods = mods;
+
+	return true;
 }
 
-void Input::OnCursorMove(double xpos, double ypos) noexcept
+void WriteVarint(std::ostream& stream_, std::uint64_t value_) noexcept
+{
+	while (value_ >= 0x80)
+	{
+		stream_.put(static_cast<char>((value_ & 0x7F) | 0x80));
+		value_ >>= 7;
+	}
+
+	stream_.put(static_cast<char>(value_));
+}
+
+bool ReadVarint(std::istream& stream_, std::uint64_t& value_) noexcept
 {
-	lastMousePosition = currentMousePosition;
-	currentMousePosition = glm::vec2(static_cast<float>(xpos), static_cast<float>(ypos));
+	value_ = 0;
+
+	for (int shift = 0; shift < 64; shift += 7)
+	{
+		const int byte = stream_.get();
+		if (byte == EOF)
+		{
+			return false;
+		}
+
+		value_ |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+		if (!(byte & 0x80))
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
-std::array<Input::KeyState, Input::MAX_KEYS> Input::keyStates = { Input::KeyState::Idle };
+std::array<Input::Event, Input::EVENT_CAPACITY> Input::events = { };
+
+std::atomic<std::size_t> Input::eventHead = 0;
+
+std::atomic<std::size_t> Input::eventTail = 0;
+
+Input::Snapshot Input::snapshot = { };
+
+std::uint64_t Input::frameIndex = 0;
+
+std::ofstream Input::recordStream;
 
-std::array<Input::KeyState, Input::MAX_MOUSE_BUTTONS> Input::mouseButtonStates = { Input::KeyState::Idle };
+std::ifstream Input::replayStream;
 
-glm::vec2 Input::lastMousePosition = glm::vec2(0.0f, 0.0f);
+std::uint64_t Input::traceFrame = 0;
 
-glm::vec2 Input::currentMousePosition = glm::vec2(0.0f, 0.0f);
+glm::ivec2 Input::traceCursor = glm::ivec2(0, 0);
 
-int Input::currentMods = 0;
\ No newline at end of file
+Input::Event Input::replayEvent = { };
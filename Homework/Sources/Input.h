@@ -6,90 +6,262 @@ class Application;
 
 /**
  * @brief 키/버튼 입력을 감지합니다.
+ *
+ * GLFW 콜백은 시각이 찍힌 이벤트를 단일 생산자/단일 소비자 링 버퍼에 넣기만 하고,
+ * 프레임마다 한 번 Update에서 이벤트를 꺼내 그 프레임 동안 바뀌지 않는 스냅샷을 만듭니다.
+ * 따라서 한 프레임 안에 눌렀다 뗀 키도 '눌린 순간'과 '떼어진 순간'이 모두 남습니다.
  */
 class Input final
 {
     friend class Application;
 
+    /**
+     * @brief 감지할 수 있는 키의 최대 개수.
+     */
+    static constexpr std::size_t MAX_KEYS = GLFW_KEY_LAST;
+
+	/**
+	 * @brief 감지할 수 있는 마우스 버튼의 최대 개수.
+	 */
+	static constexpr std::size_t MAX_MOUSE_BUTTONS = GLFW_MOUSE_BUTTON_LAST;
+
 public:
     /**
-     * @brief 키/버튼 입력 상태를 갱신합니다.
+     * @brief 한 프레임 동안의 입력 상태. 만들어진 뒤에는 바뀌지 않으므로 복사하여 다른 스레드로 넘길 수 있습니다.
+     */
+    struct Snapshot final
+    {
+        /**
+         * @brief 누르고 있는 키.
+         */
+        std::bitset<MAX_KEYS> heldKeys;
+
+        /**
+         * @brief 이번 프레임에 눌린 키.
+         */
+        std::bitset<MAX_KEYS> pressedKeys;
+
+        /**
+         * @brief 이번 프레임에 떼어진 키.
+         */
+        std::bitset<MAX_KEYS> releasedKeys;
+
+        /**
+         * @brief 누르고 있는 마우스 버튼.
+         */
+        std::bitset<MAX_MOUSE_BUTTONS> heldMouseButtons;
+
+        /**
+         * @brief 이번 프레임에 눌린 마우스 버튼.
+         */
+        std::bitset<MAX_MOUSE_BUTTONS> pressedMouseButtons;
+
+        /**
+         * @brief 이번 프레임에 떼어진 마우스 버튼.
+         */
+        std::bitset<MAX_MOUSE_BUTTONS> releasedMouseButtons;
+
+        /**
+         * @brief 이전 프레임의 마우스 커서 위치.
+         */
+        glm::vec2 lastMousePosition;
+
+        /**
+         * @brief 현재 프레임의 마우스 커서 위치.
+         */
+        glm::vec2 mousePosition;
+
+        /**
+         * @brief 마지막 키/버튼 이벤트의 수정키.
+         */
+        int mods;
+
+        /**
+         * @brief 스냅샷을 만든 시각(초).
+         */
+        double time;
+
+        /**
+         * @brief 이번 프레임에 처리한 이벤트 중 가장 오래된 것이 발생한 뒤 스냅샷이 만들어지기까지의 시간(초). 이벤트가 없다면 0입니다.
+         */
+        double latency;
+
+        /**
+         * @brief 이번 프레임에 처리한 이벤트 수.
+         */
+        std::size_t eventCount;
+    };
+
+    /**
+     * @brief 쌓인 이벤트를 모두 꺼내 이번 프레임의 스냅샷을 만듭니다. 이벤트 처리(glfwPollEvents) 직후 프레임마다 한 번 호출합니다.
+     *
+     * 이전 프레임의 눌림/떼어짐은 비트 단위로 지우고, 이벤트가 가리키는 키만 갱신합니다.
      */
     static void Update() noexcept;
 
+    /**
+     * @brief 이번 프레임의 스냅샷을 반환합니다.
+     */
+    [[nodiscard]]
+    static inline const Snapshot& GetSnapshot() noexcept;
+
+    /**
+     * @brief 이후 프레임마다 반영되는 이벤트를 입력 기록 파일로 남깁니다.
+     *
+     * 파일은 헤더("CGIN", 버전, 난수 시드) 뒤에 이벤트마다 프레임 차이(가변 길이 정수), 종류와 액션(1바이트),
+     * 키/버튼과 수정키 또는 커서 이동량(가변 길이 정수)이 이어지는 형식입니다.
+     *
+     * @param path_ 기록할 파일 경로
+     * @param seed_ 함께 남길 난수 시드. 재생할 때 같은 시드로 시작해야 같은 결과가 나옵니다.
+     *
+     * @return bool 파일을 열었다면 true
+     */
+    static bool StartRecording(const std::filesystem::path& path_,
+                               const std::uint32_t          seed_) noexcept;
+
+    /**
+     * @brief 입력 기록을 마치고 파일을 닫습니다. 기록 중이 아니라면 아무것도 하지 않습니다.
+     */
+    static void StopRecording() noexcept;
+
+    /**
+     * @brief 입력 기록 파일을 재생합니다. 재생하는 동안 실제 입력은 무시되며, 기록된 프레임에 기록된 이벤트만 반영됩니다.
+     *
+     * @param path_ 재생할 파일 경로
+     * @param seed_ 기록할 때 사용한 난수 시드를 받을 위치
+     *
+     * @return bool 파일을 열었다면 true
+     */
+    static bool StartReplay(const std::filesystem::path& path_,
+                            std::uint32_t&               seed_) noexcept;
+
+    /**
+     * @brief 입력을 기록하는 중인지 확인합니다.
+     */
+    [[nodiscard]]
+    static inline bool IsRecording() noexcept;
+
+    /**
+     * @brief 입력 기록을 재생하는 중인지 확인합니다. 기록의 끝에 닿으면 false가 됩니다.
+     */
+    [[nodiscard]]
+    static inline bool IsReplaying() noexcept;
+
+    /**
+     * @brief Update가 호출된 횟수(프레임 번호)를 반환합니다.
+     */
+    [[nodiscard]]
+    static inline std::uint64_t GetFrameIndex() noexcept;
+
     /**
      * @brief 키가 '눌린 순간'인지 확인합니다. (해당 프레임만 true)
      */
     [[nodiscard]]
-    static constexpr bool IsKeyPressed(int key) noexcept;
+    static inline bool IsKeyPressed(int key) noexcept;
 
     /**
      * @brief 키가 '떼어진 순간'인지 확인합니다. (해당 프레임만 true)
      */
     [[nodiscard]]
-    static constexpr bool IsKeyReleased(int key) noexcept;
+    static inline bool IsKeyReleased(int key) noexcept;
 
     /**
      * @brief 키를 '누르고 있는 중'인지 확인합니다. (눌린 순간 + 누르고 있는 중)
      */
     [[nodiscard]]
-    static constexpr bool IsKeyHeld(int key) noexcept;
+    static inline bool IsKeyHeld(int key) noexcept;
 
     /**
      * @brief 마우스 버튼이 '눌린 순간'인지 확인합니다.
      */
     [[nodiscard]]
-    static constexpr bool IsMouseButtonPressed(int button) noexcept;
+    static inline bool IsMouseButtonPressed(int button) noexcept;
 
     /**
      * @brief 마우스 버튼이 '떼어진 순간'인지 확인합니다.
      */
     [[nodiscard]]
-    static constexpr bool IsMouseButtonReleased(int button) noexcept;
+    static inline bool IsMouseButtonReleased(int button) noexcept;
 
     /**
      * @brief 마우스 버튼을 '누르고 있는 중'인지 확인합니다.
      */
     [[nodiscard]]
-    static constexpr bool IsMouseButtonHeld(int button) noexcept;
+    static inline bool IsMouseButtonHeld(int button) noexcept;
 
     /**
      * @brief 수정 키(Shift, Ctrl, Alt 등)가 눌려있는지 확인합니다.
 	 */
     [[nodiscard]]
-    static constexpr bool IsModified(int mod) noexcept;
+    static inline bool IsModified(int mod) noexcept;
 
     /**
      * @brief 현재 마우스 커서 위치를 반환합니다.
      */
     [[nodiscard]]
-    static constexpr glm::vec2 GetMousePosition() noexcept;
+    static inline glm::vec2 GetMousePosition() noexcept;
 
 private:
     /**
-     * @brief 키/버튼이 취할 수 있는 상태을 정의합니다.
+     * @brief 이벤트의 종류를 정의합니다.
      */
-    enum class KeyState : unsigned char
+    enum class EventType : unsigned char
     {
         /**
-         * @brief 아무것도 안 함
+         * @brief 키 누름/뗌
          */
-        Idle,
+        Key,
 
         /**
-         * @brief 눌린 순간
+         * @brief 마우스 버튼 누름/뗌
          */
-        Press,
+        MouseButton,
 
         /**
-         * @brief 눌려 있는 중
+         * @brief 마우스 커서 이동
          */
-        Hold,
+        CursorMove,
 
         /**
-         * @brief 뗀 순간
+         * @brief 입력 기록의 끝. 기록 파일에만 쓰입니다.
          */
-        Release
+        End
+    };
+
+    /**
+     * @brief 콜백이 대기열에 넣는 입력 이벤트.
+     */
+    struct Event final
+    {
+        /**
+         * @brief 발생 시각(초).
+         */
+        double time;
+
+        /**
+         * @brief 커서 위치. (CursorMove)
+         */
+        glm::vec2 position;
+
+        /**
+         * @brief 키 또는 마우스 버튼. (Key, MouseButton)
+         */
+        int code;
+
+        /**
+         * @brief GLFW 액션. (Key, MouseButton)
+         */
+        int action;
+
+        /**
+         * @brief 수정키. (Key, MouseButton)
+         */
+        int mods;
+
+        /**
+         * @brief 이벤트 종류.
+         */
+        EventType type;
     };
 
 #pragma region Deleted Functions
@@ -136,81 +308,159 @@ class Input final
     static void OnCursorMove(double xpos, double ypos) noexcept;
 
     /**
-     * @brief 감지할 수 있는 키의 최대 개수.
+     * @brief 이벤트를 대기열에 넣습니다. 콜백을 부르는 스레드(생산자)에서만 호출합니다.
+     *
+     * @param event_ 넣을 이벤트
+     *
+     * @return bool 대기열이 가득 차 버려졌다면 false
      */
-    static constexpr std::size_t MAX_KEYS = GLFW_KEY_LAST;
+    static bool PushEvent(const Event& event_) noexcept;
 
-	/**
-	 * @brief 감지할 수 있는 마우스 버튼의 최대 개수.
-	 */
-	static constexpr std::size_t MAX_MOUSE_BUTTONS = GLFW_MOUSE_BUTTON_LAST;
+    /**
+     * @brief 이벤트 하나를 스냅샷에 반영합니다.
+     *
+     * @param event_ 반영할 이벤트
+     */
+    static void ApplyEvent(const Event& event_) noexcept;
 
-	/**
-	 * @brief 
-	 */
-	static std::array<KeyState, MAX_KEYS> keyStates;
+    /**
+     * @brief 이벤트 하나를 입력 기록 파일에 씁니다.
+     *
+     * @param event_ 기록할 이벤트
+     */
+    static void WriteEvent(const Event& event_) noexcept;
 
-	/**
-	 * @brief 
-	 */
-	static std::array<KeyState, MAX_MOUSE_BUTTONS> mouseButtonStates;
+    /**
+     * @brief 입력 기록 파일에서 다음 이벤트를 읽어 replayEvent와 traceFrame에 둡니다.
+     *
+     * @return bool 읽었다면 true, 파일의 끝이라면 false
+     */
+    static bool ReadEvent() noexcept;
 
     /**
-     * @brief 이전 프레임의 마우스 커서 위치.
-	 */
-	static glm::vec2 lastMousePosition;
+     * @brief 입력 기록 파일의 식별자.
+     */
+    static constexpr char TRACE_MAGIC[4] = { 'C', 'G', 'I', 'N' };
 
     /**
-	 * @brief 현재 프레임의 마우스 커서 위치.
+     * @brief 입력 기록 파일의 형식 버전.
      */
-    static glm::vec2 currentMousePosition;
+    static constexpr std::uint8_t TRACE_VERSION = 1;
 
     /**
-     * @brief 현재 눌린 
+     * @brief 이벤트 대기열의 크기. 2의 거듭제곱이어야 합니다.
      */
-    static int currentMods;
+    static constexpr std::size_t EVENT_CAPACITY = 1024;
+
+    /**
+     * @brief 이벤트 대기열.
+     */
+    static std::array<Event, EVENT_CAPACITY> events;
+
+    /**
+     * @brief 다음에 꺼낼 위치. 소비자만 기록합니다.
+     */
+    alignas(64) static std::atomic<std::size_t> eventHead;
+
+    /**
+     * @brief 다음에 넣을 위치. 생산자만 기록합니다.
+     */
+    alignas(64) static std::atomic<std::size_t> eventTail;
+
+    /**
+     * @brief 이번 프레임의 스냅샷.
+     */
+    static Snapshot snapshot;
+
+    /**
+     * @brief 프레임 번호.
+     */
+    static std::uint64_t frameIndex;
+
+    /**
+     * @brief 입력 기록 파일. 열려 있다면 기록 중입니다.
+     */
+    static std::ofstream recordStream;
+
+    /**
+     * @brief 재생 중인 입력 기록 파일. 열려 있다면 재생 중입니다.
+     */
+    static std::ifstream replayStream;
+
+    /**
+     * @brief 마지막으로 기록하거나 읽은 이벤트의 프레임 번호. 프레임은 이 값과의 차이로 저장됩니다.
+     */
+    static std::uint64_t traceFrame;
+
+    /**
+     * @brief 마지막으로 기록하거나 읽은 커서 위치. 커서는 이 값과의 차이로 저장됩니다.
+     */
+    static glm::ivec2 traceCursor;
+
+    /**
+     * @brief 다음에 재생할 이벤트.
+     */
+    static Event replayEvent;
 };
 
-constexpr bool Input::IsKeyPressed(int key) noexcept
+inline const Input::Snapshot& Input::GetSnapshot() noexcept
 {
-    return key >= 0 && key < static_cast<int>(MAX_KEYS) && keyStates[key] == KeyState::Press;
+    return snapshot;
 }
 
-constexpr bool Input::IsKeyReleased(int key) noexcept
+inline bool Input::IsRecording() noexcept
 {
-    return key >= 0 && key < static_cast<int>(MAX_KEYS) && keyStates[key] == KeyState::Release;
+    return recordStream.is_open();
 }
 
-constexpr bool Input::IsKeyHeld(int key) noexcept
+inline bool Input::IsReplaying() noexcept
 {
-    return key >= 0 && key < static_cast<int>(MAX_KEYS) &&
-           (keyStates[key] == KeyState::Press || keyStates[key] == KeyState::Hold);
+    return replayStream.is_open();
 }
 
-constexpr bool Input::IsMouseButtonPressed(int button) noexcept
+inline std::uint64_t Input::GetFrameIndex() noexcept
 {
-    return button >= 0 && button < static_cast<int>(MAX_MOUSE_BUTTONS) &&
-           mouseButtonStates[button] == KeyState::Press;
+    return frameIndex;
 }
 
-constexpr bool Input::IsMouseButtonReleased(int button) noexcept
+inline bool Input::IsKeyPressed(int key) noexcept
 {
-    return button >= 0 && button < static_cast<int>(MAX_MOUSE_BUTTONS) &&
-           mouseButtonStates[button] == KeyState::Release;
+    return key >= 0 && key < static_cast<int>(MAX_KEYS) && snapshot.pressedKeys.test(key);
+}
+
+inline bool Input::IsKeyReleased(int key) noexcept
+{
+    return key >= 0 && key < static_cast<int>(MAX_KEYS) && snapshot.releasedKeys.test(key);
+}
+
+inline bool Input::IsKeyHeld(int key) noexcept
+{
+    // 한 프레임 안에 눌렀다 뗐다면 누르고 있지는 않지만, 눌린 순간이므로 이번 프레임은 누르고 있는 것으로 봅니다.
+    return key >= 0 && key < static_cast<int>(MAX_KEYS) && (snapshot.heldKeys.test(key) || snapshot.pressedKeys.test(key));
+}
+
+inline bool Input::IsMouseButtonPressed(int button) noexcept
+{
+    return button >= 0 && button < static_cast<int>(MAX_MOUSE_BUTTONS) && snapshot.pressedMouseButtons.test(button);
+}
+
+inline bool Input::IsMouseButtonReleased(int button) noexcept
+{
+    return button >= 0 && button < static_cast<int>(MAX_MOUSE_BUTTONS) && snapshot.releasedMouseButtons.test(button);
 }
 
-constexpr bool Input::IsMouseButtonHeld(int button) noexcept
+inline bool Input::IsMouseButtonHeld(int button) noexcept
 {
     return button >= 0 && button < static_cast<int>(MAX_MOUSE_BUTTONS) &&
-           (mouseButtonStates[button] == KeyState::Press || mouseButtonStates[button] == KeyState::Hold);
+           (snapshot.heldMouseButtons.test(button) || snapshot.pressedMouseButtons.test(button));
 }
 
-constexpr bool Input::IsModified(int mod) noexcept
+inline bool Input::IsModified(int mod) noexcept
 {
-    return (currentMods & mod) == mod;
+    return (snapshot.mods & mod) == mod;
 }
 
-constexpr glm::vec2 Input::GetMousePosition() noexcept
+inline glm::vec2 Input::GetMousePosition() noexcept
 {
-    return currentMousePosition;
+    return snapshot.mousePosition;
 }
\ No newline at end of file
@@ -0,0 +1,256 @@
+#include "LightManager.h"
+
+#include "Camera.h"
+#include "Shader.h"
+
+LightManager::LightManager() noexcept
+	: buffers{ 0, 0, 0 }
+	, isDirty(true)
+	, assignTime(0.0)
+	, threadCount(static_cast<int>(std::clamp(std::thread::hardware_concurrency(), 1u, static_cast<unsigned int>(CLUSTER_Z))))
+	, sync(threadCount)
+	, threadIndices(threadCount)
+	, isStopping(false)
+{
+	glGenBuffers(3, buffers);
+
+	clusters.resize(CLUSTER_COUNT);
+
+	// 작업 스레드들은 장벽에서 대기하다가, 배정이 충분히 클 때만 깨어나 자기 몫의 깊이 구간을 채웁니다.
+	workers.reserve(threadCount - 1);
+
+	for (int thread = 1; thread < threadCount; ++thread)
+	{
+		workers.emplace_back([this, thread]
+		{
+			while (true)
+			{
+				sync.arrive_and_wait();
+				if (isStopping)
+				{
+					break;
+				}
+
+				AssignThreadSlices(thread);
+				sync.arrive_and_wait();
+			}
+		});
+	}
+}
+
+LightManager::~LightManager() noexcept
+{
+	isStopping = true;
+	sync.arrive_and_wait();
+
+	workers.clear();
+
+	glDeleteBuffers(3, buffers);
+}
+
+void LightManager::AddLight(const glm::vec3& position_,
+							const glm::vec3& color_,
+							const float		 radius_,
+							const float		 intensity_) noexcept
+{
+	PointLight light = { };
+	light.position  = position_;
+	light.radius	= radius_;
+	light.color		= color_;
+	light.intensity = intensity_;
+
+	lights.push_back(light);
+	isDirty = true;
+}
+
+void LightManager::Clear() noexcept
+{
+	lights.clear();
+	isDirty = true;
+}
+
+void LightManager::Assign(const Camera& camera_) noexcept
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	const glm::mat4		   view		  = camera_.GetViewMatrix();
+	const glm::mat4		   projection = camera_.GetProjectionMatrix();
+	const Camera::Viewport viewport	  = camera_.GetViewport();
+	const float			   nearPlane  = camera_.GetNearPlane();
+	const float			   farPlane	  = camera_.GetFarPlane();
+
+	// 깊이 d가 속한 구간은 floor(log(d) * depthScale - depthBias) 입니다. (셰이더와 같은 식)
+	const float depthScale = static_cast<float>(CLUSTER_Z) / std::log(farPlane / nearPlane);
+	const float depthBias  = depthScale * std::log(nearPlane);
+
+	const auto toSlice = [&] (const float depth_) -> int
+	{
+		return std::clamp(static_cast<int>(std::floor(std::log(depth_) * depthScale - depthBias)), 0, CLUSTER_Z - 1);
+	};
+
+	const auto toTile = [] (const float ndc_, const int count_) -> int
+	{
+		return std::clamp(static_cast<int>(std::floor((ndc_ * 0.5f + 0.5f) * count_)), 0, count_ - 1);
+	};
+
+	// 1. 조명마다 뷰 공간의 경계 상자를 투영하여 겹치는 타일과 깊이 구간의 범위를 구합니다.
+	bounds.resize(lights.size());
+	for (std::size_t index = 0; index < lights.size(); ++index)
+	{
+		const PointLight& light	 = lights[index];
+		Bounds&			  bound	 = bounds[index];
+
+		bound = { 0, -1, 0, -1, 0, -1 };
+
+		const glm::vec3 center = glm::vec3(view * glm::vec4(light.position, 1.0f));
+		const float		depth  = -center.z;
+
+		const float nearDepth = std::max(depth - light.radius, nearPlane);
+		const float farDepth  = std::min(depth + light.radius, farPlane);
+		if (nearDepth > farDepth)
+		{
+			continue;
+		}
+
+		glm::vec2 minNDC = glm::vec2( std::numeric_limits<float>::max());
+		glm::vec2 maxNDC = glm::vec2(-std::numeric_limits<float>::max());
+		for (int corner = 0; corner < 8; ++corner)
+		{
+			const glm::vec4 point = glm::vec4(center.x + ((corner & 1) ? light.radius : -light.radius),
+											  center.y + ((corner & 2) ? light.radius : -light.radius),
+											  (corner & 4) ? -farDepth : -nearDepth,
+											  1.0f);
+
+			const glm::vec4 clip = projection * point;
+			const glm::vec2 ndc	 = glm::vec2(clip.x, clip.y) / clip.w;
+
+			minNDC = glm::min(minNDC, ndc);
+			maxNDC = glm::max(maxNDC, ndc);
+		}
+
+		if (maxNDC.x < -1.0f || minNDC.x > 1.0f || maxNDC.y < -1.0f || minNDC.y > 1.0f)
+		{
+			continue;
+		}
+
+		bound.minX = toTile(minNDC.x, CLUSTER_X);
+		bound.maxX = toTile(maxNDC.x, CLUSTER_X);
+		bound.minY = toTile(minNDC.y, CLUSTER_Y);
+		bound.maxY = toTile(maxNDC.y, CLUSTER_Y);
+		bound.minZ = toSlice(nearDepth);
+		bound.maxZ = toSlice(farDepth);
+	}
+
+	// 2. 깊이 구간을 스레드마다 나누어 배정합니다. 스레드는 서로 다른 클러스터만 기록하므로 잠금이 필요 없습니다.
+	//    배정이 작다면 작업 스레드를 깨우는 비용이 더 크므로 호출한 스레드에서 전체 배열에 바로 기록합니다.
+	indices.clear();
+	if (threadCount == 1 || lights.size() * CLUSTER_COUNT < PARALLEL_THRESHOLD)
+	{
+		AssignSlices(0, CLUSTER_Z, indices);
+	}
+	else
+	{
+		sync.arrive_and_wait();
+		AssignThreadSlices(0);
+		sync.arrive_and_wait();
+
+		// 3. 스레드별 인덱스를 이어 붙이고, 클러스터의 오프셋을 전체 배열 기준으로 옮깁니다.
+		for (int thread = 0; thread < threadCount; ++thread)
+		{
+			const std::uint32_t base	   = static_cast<std::uint32_t>(indices.size());
+			const int			firstSlice = CLUSTER_Z * thread / threadCount;
+			const int			lastSlice  = CLUSTER_Z * (thread + 1) / threadCount;
+
+			for (int cluster = firstSlice * CLUSTER_X * CLUSTER_Y; cluster < lastSlice * CLUSTER_X * CLUSTER_Y; ++cluster)
+			{
+				clusters[cluster].offset += base;
+			}
+
+			indices.insert(indices.end(), threadIndices[thread].begin(), threadIndices[thread].end());
+		}
+	}
+
+	// 4. 버퍼를 갱신합니다. 빈 버퍼는 바인딩할 수 없으므로 최소 한 개의 원소를 올립니다.
+	if (isDirty)
+	{
+		static constexpr PointLight EMPTY_LIGHT = { };
+
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[LIGHT_BINDING]);
+		glBufferData(GL_SHADER_STORAGE_BUFFER,
+					 static_cast<GLsizeiptr>(sizeof(PointLight) * std::max<std::size_t>(lights.size(), 1)),
+					 lights.empty() ? &EMPTY_LIGHT : lights.data(),
+					 GL_STATIC_DRAW);
+
+		isDirty = false;
+	}
+
+	if (indices.empty())
+	{
+		indices.push_back(0);
+	}
+
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[CLUSTER_BINDING]);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(sizeof(Cluster) * clusters.size()), clusters.data(), GL_STREAM_DRAW);
+
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffers[INDEX_BINDING]);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(sizeof(std::uint32_t) * indices.size()), indices.data(), GL_STREAM_DRAW);
+
+	glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, LIGHT_BINDING,	buffers[LIGHT_BINDING]);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLUSTER_BINDING, buffers[CLUSTER_BINDING]);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, INDEX_BINDING,	buffers[INDEX_BINDING]);
+
+	Shader::SetUniformVector3("uClusterGrid",  glm::vec3(CLUSTER_X, CLUSTER_Y, CLUSTER_Z));
+	Shader::SetUniformVector2("uClusterDepth", glm::vec2(depthScale, depthBias));
+	Shader::SetUniformVector4("uViewport",	   glm::vec4(viewport.x, viewport.y, viewport.width, viewport.height));
+
+	assignTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void LightManager::AssignSlices(const int					firstSlice_,
+								const int					lastSlice_,
+								std::vector<std::uint32_t>& indices_) noexcept
+{
+	std::vector<std::uint32_t> candidates;
+	candidates.reserve(lights.size());
+
+	for (int z = firstSlice_; z < lastSlice_; ++z)
+	{
+		// 이 깊이 구간에 걸친 조명만 추려서 타일마다 검사합니다.
+		candidates.clear();
+		for (std::size_t index = 0; index < bounds.size(); ++index)
+		{
+			if (bounds[index].minZ <= z && z <= bounds[index].maxZ)
+			{
+				candidates.push_back(static_cast<std::uint32_t>(index));
+			}
+		}
+
+		for (int y = 0; y < CLUSTER_Y; ++y)
+		{
+			for (int x = 0; x < CLUSTER_X; ++x)
+			{
+				Cluster& cluster = clusters[(z * CLUSTER_Y + y) * CLUSTER_X + x];
+				cluster.offset = static_cast<std::uint32_t>(indices_.size());
+
+				for (const std::uint32_t index : candidates)
+				{
+					const Bounds& bound = bounds[index];
+					if (bound.minX <= x && x <= bound.maxX && bound.minY <= y && y <= bound.maxY)
+					{
+						indices_.push_back(index);
+					}
+				}
+
+				cluster.count = static_cast<std::uint32_t>(indices_.size()) - cluster.offset;
+			}
+		}
+	}
+}
+
+void LightManager::AssignThreadSlices(const int thread_) noexcept
+{
+	threadIndices[thread_].clear();
+	AssignSlices(CLUSTER_Z * thread_ / threadCount, CLUSTER_Z * (thread_ + 1) / threadCount, threadIndices[thread_]);
+}
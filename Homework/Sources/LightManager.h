@@ -0,0 +1,266 @@
+#pragma once
+
+#include "PCH.h"
+
+class Camera;
+
+/**
+ * @brief 여러 개의 점 조명을 관리하고, 화면을 절두체 격자(클러스터)로 나누어 조명을 배정합니다.
+ *
+ * 조명은 셰이더 저장 버퍼로 올라가며, 프래그먼트 셰이더는 자신이 속한 클러스터에 배정된 조명만 계산합니다.
+ * 배정은 카메라마다 CPU에서 깊이 구간을 나누어 여러 스레드로 수행합니다. 작업 스레드는 생성할 때 한 번 만들어 계속 재사용합니다.
+ */
+class LightManager final
+{
+public:
+	/**
+	 * @brief 점 조명을 정의합니다. (셰이더의 std430 PointLight와 배치가 같습니다)
+	 */
+	struct PointLight final
+	{
+		/**
+		 * @brief 월드 좌표계 상의 위치.
+		 */
+		glm::vec3 position;
+
+		/**
+		 * @brief 영향 반경. 반경 밖에서는 빛이 0이 됩니다.
+		 */
+		float radius;
+
+		/**
+		 * @brief 색상.
+		 */
+		glm::vec3 color;
+
+		/**
+		 * @brief 세기.
+		 */
+		float intensity;
+	};
+
+	/**
+	 * @brief 생성자.
+	 */
+	explicit LightManager() noexcept;
+
+	/**
+	 * @brief 소멸자.
+	 */
+	~LightManager() noexcept;
+
+	LightManager(const LightManager&) = delete;
+	LightManager& operator=(const LightManager&) = delete;
+
+	/**
+	 * @brief 조명을 추가합니다.
+	 *
+	 * @param position_  조명의 위치
+	 * @param color_	 조명의 색상
+	 * @param radius_	 조명의 영향 반경
+	 * @param intensity_ 조명의 세기
+	 */
+	void AddLight(const glm::vec3& position_,
+				  const glm::vec3& color_,
+				  const float	   radius_,
+				  const float	   intensity_ = 1.0f) noexcept;
+
+	/**
+	 * @brief 모든 조명을 제거합니다.
+	 */
+	void Clear() noexcept;
+
+	/**
+	 * @brief 지정한 카메라 기준으로 조명을 클러스터에 배정하고 셰이더에 바인딩합니다.
+	 *
+	 * 카메라의 PreRender 이후, 그리기 전에 카메라마다 호출합니다.
+	 *
+	 * @param camera_ 기준 카메라
+	 */
+	void Assign(const Camera& camera_) noexcept;
+
+	/**
+	 * @brief 조명의 개수를 반환합니다.
+	 *
+	 * @return std::size_t 조명의 개수
+	 */
+	[[nodiscard]]
+	inline std::size_t GetLightCount() const noexcept;
+
+	/**
+	 * @brief 마지막 배정에 걸린 시간을 반환합니다.
+	 *
+	 * @return double 마지막 배정에 걸린 시간(밀리초)
+	 */
+	[[nodiscard]]
+	inline double GetAssignTime() const noexcept;
+
+private:
+	/**
+	 * @brief 클러스터 하나에 배정된 조명 인덱스의 범위. (셰이더의 uvec2와 배치가 같습니다)
+	 */
+	struct Cluster final
+	{
+		/**
+		 * @brief 인덱스 버퍼 내 시작 위치.
+		 */
+		std::uint32_t offset;
+
+		/**
+		 * @brief 배정된 조명의 개수.
+		 */
+		std::uint32_t count;
+	};
+
+	/**
+	 * @brief 한 조명이 차지하는 클러스터 범위.
+	 */
+	struct Bounds final
+	{
+		/**
+		 * @brief 타일 x 범위. [minX, maxX]
+		 */
+		int minX, maxX;
+
+		/**
+		 * @brief 타일 y 범위. [minY, maxY]
+		 */
+		int minY, maxY;
+
+		/**
+		 * @brief 깊이 구간 범위. [minZ, maxZ]
+		 */
+		int minZ, maxZ;
+	};
+
+	/**
+	 * @brief 지정한 깊이 구간들에 속한 클러스터를 채웁니다. 작업 스레드에서도 호출됩니다.
+	 *
+	 * @param firstSlice_ 시작 깊이 구간
+	 * @param lastSlice_  끝 깊이 구간 (포함하지 않음)
+	 * @param indices_    배정된 조명 인덱스를 기록할 위치. 오프셋은 이 배열 기준입니다.
+	 */
+	void AssignSlices(const int					  firstSlice_,
+					  const int					  lastSlice_,
+					  std::vector<std::uint32_t>& indices_) noexcept;
+
+	/**
+	 * @brief 지정한 스레드가 맡은 깊이 구간들을 스레드별 인덱스 배열에 채웁니다.
+	 *
+	 * @param thread_ 스레드 번호. 0은 Assign을 호출한 스레드입니다.
+	 */
+	void AssignThreadSlices(const int thread_) noexcept;
+
+	/**
+	 * @brief 화면 가로 타일 수.
+	 */
+	static constexpr int CLUSTER_X = 16;
+
+	/**
+	 * @brief 화면 세로 타일 수.
+	 */
+	static constexpr int CLUSTER_Y = 9;
+
+	/**
+	 * @brief 깊이 구간 수. 깊이는 로그 간격으로 나눕니다.
+	 */
+	static constexpr int CLUSTER_Z = 24;
+
+	/**
+	 * @brief 전체 클러스터 수.
+	 */
+	static constexpr int CLUSTER_COUNT = CLUSTER_X * CLUSTER_Y * CLUSTER_Z;
+
+	/**
+	 * @brief 여러 스레드로 나누어 배정할 최소 (조명 수 x 클러스터 수).
+	 *
+	 * 조명과 클러스터 한 쌍을 검사하는 데 0.3 ~ 1 ns, 장벽을 한 번 왕복하는 데 수 us가 걸리므로
+	 * 배정이 수십 us(조명 32개 정도) 이상일 때만 작업 스레드를 깨웁니다.
+	 */
+	static constexpr std::size_t PARALLEL_THRESHOLD = 32 * CLUSTER_COUNT;
+
+	/**
+	 * @brief 조명 버퍼 바인딩 지점.
+	 */
+	static constexpr GLuint LIGHT_BINDING = 0;
+
+	/**
+	 * @brief 클러스터 버퍼 바인딩 지점.
+	 */
+	static constexpr GLuint CLUSTER_BINDING = 1;
+
+	/**
+	 * @brief 조명 인덱스 버퍼 바인딩 지점.
+	 */
+	static constexpr GLuint INDEX_BINDING = 2;
+
+	/**
+	 * @brief 조명들.
+	 */
+	std::vector<PointLight> lights;
+
+	/**
+	 * @brief 현재 카메라 기준 조명별 클러스터 범위. 카메라 앞에 없는 조명은 minZ > maxZ 입니다.
+	 */
+	std::vector<Bounds> bounds;
+
+	/**
+	 * @brief 클러스터들.
+	 */
+	std::vector<Cluster> clusters;
+
+	/**
+	 * @brief 모든 클러스터의 조명 인덱스.
+	 */
+	std::vector<std::uint32_t> indices;
+
+	/**
+	 * @brief 조명 버퍼, 클러스터 버퍼, 인덱스 버퍼.
+	 */
+	GLuint buffers[3];
+
+	/**
+	 * @brief 조명이 바뀌어 조명 버퍼를 다시 올려야 하는지 여부.
+	 */
+	bool isDirty;
+
+	/**
+	 * @brief 마지막 배정에 걸린 시간(밀리초).
+	 */
+	double assignTime;
+
+	/**
+	 * @brief 배정에 참여하는 스레드 수. Assign을 호출한 스레드를 포함합니다.
+	 */
+	int threadCount;
+
+	/**
+	 * @brief 호출한 스레드와 작업 스레드들이 배정을 시작하고 끝낼 때 만나는 장벽.
+	 */
+	std::barrier<> sync;
+
+	/**
+	 * @brief 스레드별 조명 인덱스. 클러스터의 오프셋은 먼저 이 배열 기준으로 기록됩니다.
+	 */
+	std::vector<std::vector<std::uint32_t>> threadIndices;
+
+	/**
+	 * @brief 작업 스레드들이 종료해야 하는지 여부.
+	 */
+	bool isStopping;
+
+	/**
+	 * @brief 작업 스레드들. 생성자에서 만들어지며, 배정이 없는 동안 장벽에서 대기합니다.
+	 */
+	std::vector<std::jthread> workers;
+};
+
+inline std::size_t LightManager::GetLightCount() const noexcept
+{
+	return lights.size();
+}
+
+inline double LightManager::GetAssignTime() const noexcept
+{
+	return assignTime;
+}
@@ -4,13 +4,18 @@
 #include "Input.h"
 
 #include "Camera.h"
+#include "Crowd.h"
+#include "FlowField.h"
 #include "Light.h"
+#include "LightManager.h"
+#include "Maze.h"
+#include "MazeWorld.h"
 #include "Mesh.h"
 #include "Shader.h"
 
 #include "Object.h"
 #include "Player.h"
-#include "Mountain.h"
+#include "Random.h"
 
 /**
  * @brief 카메라 모드를 정의합니다.
@@ -75,6 +80,13 @@ static void BuildMaze() noexcept;
  */
 static void SpawnPlayer() noexcept;
 
+/**
+ * @brief 점 조명들을 배치합니다.
+ *
+ * @param shouldStress_ true라면 횃불 대신 STRESS_LIGHT_COUNT개의 조명을 무작위로 배치합니다.
+ */
+static void PlaceLights(const bool shouldStress_) noexcept;
+
 /**
  * @brief 애플리케이션 제목.
  */
@@ -98,7 +110,37 @@ static constexpr std::size_t MIN_LENGTH = 5;
 /**
  * @brief 무대의 최대 세로 사이즈.
  */
-static constexpr std::size_t MAX_LENGTH = 25;
+static constexpr std::size_t MAX_LENGTH = 16384;
+
+/**
+ * @brief 서브 카메라가 내려다볼 무대의 최대 길이. 카메라가 원평면(100) 안에 들어오도록 제한합니다.
+ */
+static constexpr int OVERVIEW_LENGTH = 25;
+
+/**
+ * @brief 횃불을 둘 등장 위치 주변의 반경(타일). 무대가 커져도 횃불은 (2r + 1)^2 칸 안에만 둡니다.
+ */
+static constexpr int TORCH_RADIUS = 16;
+
+/**
+ * @brief 부하 시험에 사용할 점 조명 개수.
+ */
+static constexpr std::size_t STRESS_LIGHT_COUNT = 1024;
+
+/**
+ * @brief 미로에 배치할 추격 에이전트 수.
+ */
+static constexpr std::size_t CROWD_SIZE = 2000;
+
+/**
+ * @brief 추격 에이전트를 배치할 수 있는 무대의 최대 길이. 흐름장은 타일마다 5바이트이므로 4096 x 4096에서 80MB입니다.
+ */
+static constexpr int CROWD_MAX_LENGTH = 4096;
+
+/**
+ * @brief 무대와 무한 미로의 청크들이 각각 사용할 수 있는 최대 메모리(바이트).
+ */
+static constexpr std::size_t WORLD_MEMORY_BUDGET = 8 * 1024 * 1024;
 
 /**
  * @brief 무대의 가로 사이즈.
@@ -125,20 +167,70 @@ static CameraMode cameraMode = CameraMode::TopDown;
  */
 static std::unique_ptr<Camera> subCamera;
 
+/**
+ * @brief 미로.
+ */
+static Maze maze;
+
+/**
+ * @brief 플레이어(없다면 등장 위치)를 목표로 하는 흐름장.
+ */
+static std::unique_ptr<FlowField> flowField;
+
+/**
+ * @brief 흐름장을 따라 플레이어를 쫓는 에이전트들.
+ */
+static std::unique_ptr<Crowd> crowd;
+
+/**
+ * @brief 무대. 생성한 미로를 무한 미로와 같은 청크로 나누어 그립니다.
+ */
+static std::unique_ptr<MazeWorld> stage;
+
+/**
+ * @brief 무한 미로.
+ */
+static std::unique_ptr<MazeWorld> world;
+
+/**
+ * @brief 무대 대신 무한 미로를 사용하는지 여부.
+ */
+static bool isWorldMode = false;
+
+/**
+ * @brief 플레이어와 충돌을 검사할 벽들. 매 프레임 다시 채웁니다.
+ */
+static std::vector<AABB> walls;
+
+/**
+ * @brief 플레이어가 등장할 위치. (미로 중앙에 가장 가까운 방)
+ */
+static glm::vec3 spawnPosition = glm::vec3(0.0f);
+
 /**
  * @brief 조명.
  */
 static std::unique_ptr<Light> light;
 
 /**
- * @brief 플레이어 오브젝트.
+ * @brief 점 조명들.
  */
-static std::unique_ptr<Player> player = nullptr;
+static std::unique_ptr<LightManager> lightManager;
+
+/**
+ * @brief 부하 시험용 조명을 배치했는지 여부.
+ */
+static bool isStressLighting = false;
 
 /**
- * @brief 산 오브젝트들.
+ * @brief 다음 배정 시간을 로그로 남길지 여부.
  */
-static std::vector<std::unique_ptr<Mountain>> mountains;
+static bool shouldReportLights = false;
+
+/**
+ * @brief 플레이어 오브젝트.
+ */
+static std::unique_ptr<Player> player = nullptr;
 
 int main()
 {
@@ -188,7 +280,7 @@ void OnLoad() noexcept
 		constexpr glm::vec2 camSize = glm::vec2(300.0f, 300.0f);
 		constexpr glm::vec2 camPos  = glm::vec2(APP_WIDTH, APP_HEIGHT) - camSize;
 
-		const     glm::vec3		   eye		= glm::vec3(0.0f, (height / 10) * 20.0f,  0.0f);
+		const     glm::vec3		   eye		= glm::vec3(0.0f, (std::min(height, OVERVIEW_LENGTH) / 10) * 20.0f,  0.0f);
 		constexpr glm::vec3		   at		= glm::vec3(0.0f,  0.0f,  0.0f);
 		constexpr glm::vec3		   up       = glm::vec3(0.0f,  0.0f, -1.0f);
 		const	  Camera::Viewport viewport = Camera::Viewport(camPos.x, camPos.y, camSize.x, camSize.y);
@@ -202,40 +294,10 @@ void OnLoad() noexcept
 		light = std::make_unique<Light>(position, color);
 	}
 
-	std::vector<bool> map(width * height, false);
-
-	// 2. 십자(Cross) 만들기
-	// 맵의 중앙 인덱스 계산
-	int centerZ = height / 2;
-	int centerX = width / 2;
-
-	// 가로줄 뚫기 (좌 -> 우)
-	for (int x = 0; x < width; ++x)
-	{
-		map[centerZ * width + x] = true;
-	}
-
-	// 세로줄 뚫기 (상 -> 하)
-	for (int z = 0; z < height; ++z)
-	{
-		map[z * width + centerX] = true;
-	}
-	
-	mountains.clear();
-	mountains.reserve(width * height);
-
-	for (int z = 0; z < height; ++z)
-	{
-		for (int x = 0; x < width; ++x)
-		{
-			Mountain* mountain = mountains.emplace_back(std::make_unique<Mountain>(map[z * width + x])).get();
-
-			const float posX = static_cast<float>(x) - static_cast<float>(width) * 0.5f + 0.5f;
-			const float posZ = static_cast<float>(z) - static_cast<float>(height) * 0.5f + 0.5f;
+	::BuildMaze();
 
-			mountain->SetPosition(glm::vec3(posX, 0.0f, posZ));
-		}
-	}
+	lightManager = std::make_unique<LightManager>();
+	PlaceLights(isStressLighting);
 }
 
 void OnTick(const float deltaTime_) noexcept
@@ -361,9 +423,80 @@ void OnTick(const float deltaTime_) noexcept
 	}
 	if (Input::IsKeyPressed(GLFW_KEY_S))
 	{
-		player = std::make_unique<Player>();
-		player->SetPosition(glm::vec3(0.0f, 10.0f, 0.0f));
+		::SpawnPlayer();
+	}
+	if (Input::IsKeyPressed(GLFW_KEY_B))
+	{
+		Maze::Benchmark();
+	}
+	if (Input::IsKeyPressed(GLFW_KEY_L))
+	{
+		isStressLighting = !isStressLighting;
+		PlaceLights(isStressLighting);
+	}
+	if (Input::IsKeyPressed(GLFW_KEY_G))
+	{
+		if (crowd)
+		{
+			crowd.reset();
+			flowField.reset();
+		}
+		else if (width > CROWD_MAX_LENGTH || height > CROWD_MAX_LENGTH)
+		{
+			spdlog::warn("Crowd needs a stage of at most {}x{}", CROWD_MAX_LENGTH, CROWD_MAX_LENGTH);
+		}
+		else
+		{
+			flowField = std::make_unique<FlowField>();
+
+			crowd = std::make_unique<Crowd>();
+			crowd->Spawn(maze, CROWD_SIZE, static_cast<std::uint64_t>(Random::GetInt(0, std::numeric_limits<int>::max())));
+		}
+	}
+	if (Input::IsKeyPressed(GLFW_KEY_F))
+	{
+		Crowd::Benchmark();
 	}
+	if (Input::IsKeyPressed(GLFW_KEY_E))
+	{
+		isWorldMode = !isWorldMode;
+		if (isWorldMode && !world)
+		{
+			world = std::make_unique<MazeWorld>(static_cast<std::uint64_t>(Random::GetInt(0, std::numeric_limits<int>::max())), WORLD_MEMORY_BUDGET);
+		}
+
+		if (player)
+		{
+			::SpawnPlayer();
+		}
+	}
+
+	// 무대 타일의 애니메이션은 모든 청크에 적용되지만, 실제로는 보이는 청크만 움직입니다.
+	if (Input::IsKeyPressed(GLFW_KEY_M))
+	{
+		if (Input::IsModified(GLFW_MOD_SHIFT))
+		{
+			stage->SetPaused(true);
+		}
+		else
+		{
+			stage->SetPaused(false);
+			stage->PlayAnimation(MazeWorld::Animation::Breathing);
+		}
+	}
+	else if (Input::IsKeyPressed(GLFW_KEY_R))
+	{
+		stage->PlayAnimation(MazeWorld::Animation::Path);
+	}
+	else if (Input::IsKeyPressed(GLFW_KEY_V))
+	{
+		stage->PlayAnimation(MazeWorld::Animation::Level);
+	}
+
+	// 무대와 무한 미로 모두 플레이어(없다면 카메라) 주변의 청크만 준비합니다.
+	MazeWorld* const current = isWorldMode ? world.get() : stage.get();
+	current->Update(player ? player->GetPosition() : mainCamera->GetPosition());
+	current->Animate(deltaTime_);
 	
 	if (player)
 	{
@@ -375,18 +508,14 @@ void OnTick(const float deltaTime_) noexcept
 		glm::vec3 pPos = player->GetPosition();
 		bool collided = false;
 
-		for (const auto& mountain : mountains)
-		{
-			if (mountain->GetScale().y < 0.5f)
-			{
-				continue;
-			}
-
-			AABB wallBox = mountain->GetAABB();
+		walls.clear();
+		current->CollectWalls(playerBox, walls);
 
+		for (const AABB& wallBox : walls)
+		{
 			if (AABB::CheckCollision(playerBox, wallBox))
 			{
-				glm::vec3 mPos = mountain->GetPosition();
+				glm::vec3 mPos = (wallBox.min + wallBox.max) * 0.5f;
 
 				const float xOverlap = glm::min(playerBox.max.x, wallBox.max.x) - glm::max(playerBox.min.x, wallBox.min.x);
 				const float zOverlap = glm::min(playerBox.max.z, wallBox.max.z) - glm::max(playerBox.min.z, wallBox.min.z);
@@ -441,9 +570,25 @@ void OnTick(const float deltaTime_) noexcept
 		}
 	}
 
-	for (const std::unique_ptr<Mountain>& mountain : mountains)
+	// 목표 타일이 바뀌었을 때만 흐름장을 다시 계산하고, 에이전트는 매 프레임 자기 타일의 방향만 읽습니다.
+	if (crowd && !isWorldMode)
 	{
-		mountain->Update(deltaTime_);
+		const glm::vec3	 target = player ? player->GetPosition() : spawnPosition;
+		const glm::ivec2 goal	= glm::ivec2(static_cast<int>(std::floor(target.x + static_cast<float>(width)  * 0.5f)),
+											 static_cast<int>(std::floor(target.z + static_cast<float>(height) * 0.5f)));
+
+		if (goal != flowField->GetGoal())
+		{
+			flowField->Compute(maze, goal, static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u)));
+		}
+
+		crowd->Update(*flowField, deltaTime_);
+	}
+
+	// 충돌 보정까지 끝난 트랜스폼으로 그리기 전에 행렬을 한 번에 갱신합니다.
+	if (player)
+	{
+		player->UpdateMatrices();
 	}
 }
 
@@ -453,14 +598,34 @@ void OnDisplay() noexcept
 	{
 		mainCamera->PreRender();
 
+		if (lightManager)
+		{
+			lightManager->Assign(*mainCamera);
+
+			if (shouldReportLights)
+			{
+				spdlog::info("Point lights: {} (cluster assign {:.3f} ms)", lightManager->GetLightCount(), lightManager->GetAssignTime());
+				shouldReportLights = false;
+			}
+		}
+
 		// 1인칭 일 때는 스킵.
 		if (cameraMode != CameraMode::FirstPerson)
 			if (player)
 				player->Render();
 
-		for (const std::unique_ptr<Mountain>& mountain : mountains)
+		if (isWorldMode)
 		{
-			mountain->Render();
+			world->Render(*mainCamera);
+		}
+		else
+		{
+			stage->Render(*mainCamera);
+
+			if (crowd)
+			{
+				crowd->Render(glm::vec3(static_cast<float>(width) * -0.5f, 0.0f, static_cast<float>(height) * -0.5f));
+			}
 		}
 	}
 
@@ -468,14 +633,28 @@ void OnDisplay() noexcept
 	{
 		subCamera->PreRender();
 
+		if (lightManager)
+		{
+			lightManager->Assign(*subCamera);
+		}
+
 		Shader::SetUniformVector3("uViewPos", mainCamera->GetPosition());
 		
 		if (player)
 		player->Render();
 
-		for (const std::unique_ptr<Mountain>& mountain : mountains)
+		if (isWorldMode)
 		{
-			mountain->Render();
+			world->Render(*subCamera);
+		}
+		else
+		{
+			stage->Render(*subCamera);
+
+			if (crowd)
+			{
+				crowd->Render(glm::vec3(static_cast<float>(width) * -0.5f, 0.0f, static_cast<float>(height) * -0.5f));
+			}
 		}
 	}
 }
@@ -486,7 +665,15 @@ void OnClose() noexcept
 	subCamera.reset();
 
 	player.reset();
-	mountains.clear();
+	stage.reset();
+
+	world.reset();
+	isWorldMode = false;
+
+	crowd.reset();
+	flowField.reset();
+
+	lightManager.reset();
 }
 
 void Reset() noexcept
@@ -537,9 +724,97 @@ void GetUserInput() noexcept
 	std::cout << "r     : 미로 생성\n";
 	std::cout << "v     : 육면체 움직임 정지, 낮은 높이로 변경 (토글)\n";
 	std::cout << "s     : 미로에서 객체 등장\n";
+	std::cout << "b     : 미로 생성 벤치마크 (16384 x 16384)\n";
+	std::cout << "e     : 무대 / 무한 미로 전환\n";
+	std::cout << "g     : 추격 에이전트 2000개 배치 / 제거\n";
+	std::cout << "f     : 흐름장 벤치마크 (4096 x 4096, 에이전트 100000개)\n";
 	std::cout << "↑/↓/←/→ : 미로에서 객체 이동\n";
 	std::cout << "1 / 3 : 1인칭 / 3인칭 시점 전환\n";
+	std::cout << "l     : 횃불 / 조명 1024개 배치 전환\n";
 	std::cout << "c     : 모든 값 초기화\n";
 	std::cout << "q     : 프로그램 종료\n";
 	std::cout << "=====================\n";
+}
+
+void BuildMaze() noexcept
+{
+	// 시드를 로그로 남겨 같은 미로를 다시 만들 수 있게 합니다. 큰 스테이지도 바로 만들 수 있도록 가장 빠른 Eller를 사용합니다.
+	const std::uint64_t seed = static_cast<std::uint64_t>(Random::GetInt(0, std::numeric_limits<int>::max()));
+	maze.Generate(width, height, Maze::Algorithm::Eller, seed);
+
+	spdlog::info("Maze {}x{} (seed {})", width, height, seed);
+
+	// 방은 홀수 좌표에만 있으므로 중앙에 가장 가까운 홀수 좌표를 등장 위치로 사용합니다.
+	const int spawnX = std::min((width  / 2) | 1, width  - 2);
+	const int spawnZ = std::min((height / 2) | 1, height - 2);
+
+	spawnPosition = glm::vec3(static_cast<float>(spawnX) - static_cast<float>(width)  * 0.5f + 0.5f,
+							  0.0f,
+							  static_cast<float>(spawnZ) - static_cast<float>(height) * 0.5f + 0.5f);
+
+	// 무대는 미로의 행 워드를 청크마다 잘라 인스턴스 버퍼로 올립니다. 미로의 중앙이 원점에 오도록 놓습니다.
+	stage = std::make_unique<MazeWorld>(seed,
+										maze,
+										glm::vec3(static_cast<float>(width) * -0.5f, 0.0f, static_cast<float>(height) * -0.5f),
+										WORLD_MEMORY_BUDGET);
+}
+
+void SpawnPlayer() noexcept
+{
+	player = std::make_unique<Player>();
+	player->SetPosition((isWorldMode ? MazeWorld::GetSpawnPosition() : spawnPosition) + glm::vec3(0.0f, 10.0f, 0.0f));
+}
+
+void PlaceLights(const bool shouldStress_) noexcept
+{
+	if (!lightManager)
+	{
+		return;
+	}
+
+	lightManager->Clear();
+
+	if (shouldStress_)
+	{
+		const float halfWidth  = static_cast<float>(width)  * 0.5f;
+		const float halfHeight = static_cast<float>(height) * 0.5f;
+
+		for (std::size_t index = 0; index < STRESS_LIGHT_COUNT; ++index)
+		{
+			const glm::vec3 position = glm::vec3(Random::GetFloat(-halfWidth, halfWidth),
+												 Random::GetFloat(0.5f, 3.0f),
+												 Random::GetFloat(-halfHeight, halfHeight));
+			const glm::vec3 color	 = glm::vec3(Random::GetFloat(0.2f, 1.0f),
+												 Random::GetFloat(0.2f, 1.0f),
+												 Random::GetFloat(0.2f, 1.0f));
+
+			lightManager->AddLight(position, color, 2.0f, 2.0f);
+		}
+	}
+	else
+	{
+		// 등장 위치 주변의 미로 경로 칸마다 횃불을 하나씩 둡니다.
+		const int spawnX = static_cast<int>(std::floor(spawnPosition.x + static_cast<float>(width)  * 0.5f));
+		const int spawnZ = static_cast<int>(std::floor(spawnPosition.z + static_cast<float>(height) * 0.5f));
+
+		for (int z = spawnZ - TORCH_RADIUS; z <= spawnZ + TORCH_RADIUS; ++z)
+		{
+			for (int x = spawnX - TORCH_RADIUS; x <= spawnX + TORCH_RADIUS; ++x)
+			{
+				if (!maze.IsOpen(x, z))
+				{
+					continue;
+				}
+
+				const glm::vec3 position = glm::vec3(static_cast<float>(x) - static_cast<float>(width)  * 0.5f + 0.5f,
+													 1.0f,
+													 static_cast<float>(z) - static_cast<float>(height) * 0.5f + 0.5f);
+				const glm::vec3 color	 = glm::vec3(1.0f, Random::GetFloat(0.5f, 0.7f), 0.3f);
+
+				lightManager->AddLight(position, color, 3.0f, 3.0f);
+			}
+		}
+	}
+
+	shouldReportLights = true;
 }
\ No newline at end of file
@@ -0,0 +1,336 @@
+#include "Maze.h"
+
+/**
+ * @brief 한 번에 64비트씩 뽑아 두고 8비트씩 꺼내 쓰는 난수 비트 공급기.
+ */
+class RandomBits final
+{
+public:
+	explicit RandomBits(std::mt19937_64& random_) noexcept
+		: random(random_)
+		, bits(0)
+		, remaining(0)
+	{
+	}
+
+	/**
+	 * @brief 난수 8비트를 반환합니다.
+	 */
+	[[nodiscard]]
+	inline unsigned NextByte() noexcept
+	{
+		if (remaining < 8)
+		{
+			bits	  = random();
+			remaining = 64;
+		}
+
+		const unsigned value = static_cast<unsigned>(bits & 0xFF);
+		bits	  >>= 8;
+		remaining -= 8;
+
+		return value;
+	}
+
+private:
+	std::mt19937_64& random;
+	std::uint64_t	 bits;
+	int				 remaining;
+};
+
+/**
+ * @brief 32비트 값의 i번째 비트를 64비트 값의 2i번째 비트로 펼칩니다.
+ */
+[[nodiscard]]
+static inline std::uint64_t Spread(const std::uint32_t value_) noexcept
+{
+	std::uint64_t value = value_;
+	value = (value | (value << 16)) & 0x0000FFFF0000FFFFull;
+	value = (value | (value <<  8)) & 0x00FF00FF00FF00FFull;
+	value = (value | (value <<  4)) & 0x0F0F0F0F0F0F0F0Full;
+	value = (value | (value <<  2)) & 0x3333333333333333ull;
+	value = (value | (value <<  1)) & 0x5555555555555555ull;
+	return value;
+}
+
+/**
+ * @brief 분기 없이 condition_에 따라 두 값 중 하나를 고릅니다. 무작위 조건은 분기 예측이 절반쯤 틀리므로 산술로 고릅니다.
+ */
+[[nodiscard]]
+static inline int Select(const bool condition_, const int true_, const int false_) noexcept
+{
+	return false_ ^ ((true_ ^ false_) & -static_cast<int>(condition_));
+}
+
+Maze::Maze() noexcept
+	: width(0)
+	, height(0)
+	, stride(0)
+{
+}
+
+void Maze::Generate(const int			width_,
+					const int			height_,
+					const Algorithm		algorithm_,
+					const std::uint64_t seed_) noexcept
+{
+	width  = std::max(width_,  0);
+	height = std::max(height_, 0);
+	stride = (static_cast<std::size_t>(width) + 63) / 64;
+
+	words.assign(stride * height, 0);
+
+	// 방이 하나도 없다면 모두 벽입니다.
+	if (width < 3 || height < 3)
+	{
+		return;
+	}
+
+	std::mt19937_64 random(seed_);
+
+	switch (algorithm_)
+	{
+		case Algorithm::Backtracker:
+		{
+			GenerateBacktracker(random);
+			break;
+		}
+		case Algorithm::Eller:
+		{
+			GenerateEller(random);
+			break;
+		}
+	}
+}
+
+void Maze::GenerateBacktracker(std::mt19937_64& random_) noexcept
+{
+	// 방향 순서: +x, +y, -x, -y. (방향 + 2) % 4 가 반대 방향입니다.
+	// 후보 방향들의 비트 마스크와 난수 8비트로 고를 방향. 후보 중 (난수 * 후보 수) >> 8 번째를 고릅니다.
+	static constexpr auto CHOICES = []
+	{
+		std::array<std::array<std::uint8_t, 256>, 16> choices = { };
+		for (unsigned mask = 1; mask < 16; ++mask)
+		{
+			int candidates[4];
+			int count = 0;
+			for (int direction = 0; direction < 4; ++direction)
+			{
+				if (mask & (1u << direction))
+				{
+					candidates[count++] = direction;
+				}
+			}
+
+			for (unsigned value = 0; value < 256; ++value)
+			{
+				choices[mask][value] = static_cast<std::uint8_t>(candidates[(value * count) >> 8]);
+			}
+		}
+		return choices;
+	}();
+
+	const int columns = (width  - 1) / 2;
+	const int rows	  = (height - 1) / 2;
+
+	// 방문 여부는 방마다 1비트로, 둘레에 방문한 것으로 표시된 방을 한 겹 둘러 범위 검사 없이 이웃을 읽습니다.
+	// 부모 방향(2비트)도 같은 위치로 찾으므로, 이동할 때는 비트 위치에 방향별 이동량만 더합니다.
+	const std::size_t	 roomPitch	 = ((static_cast<std::size_t>(columns) + 2 + 63) / 64) * 64;
+	const std::ptrdiff_t roomStep[4] = { 1, static_cast<std::ptrdiff_t>(roomPitch), -1, -static_cast<std::ptrdiff_t>(roomPitch) };
+	const std::ptrdiff_t tileStep[4] = { 1, static_cast<std::ptrdiff_t>(stride * 64), -1, -static_cast<std::ptrdiff_t>(stride * 64) };
+
+	std::vector<std::uint64_t> visited(roomPitch / 64 * (rows + 2), 0);
+	std::vector<std::uint64_t> parents(roomPitch / 32 * (rows + 2), 0);
+
+	const auto markVisited = [&] (const std::size_t room_)
+	{
+		visited[room_ >> 6] |= std::uint64_t(1) << (room_ & 63);
+	};
+
+	for (int x = 0; x < columns + 2; ++x)
+	{
+		markVisited(x);
+		markVisited((rows + 1) * roomPitch + x);
+	}
+
+	for (int y = 1; y <= rows; ++y)
+	{
+		markVisited(y * roomPitch);
+		markVisited(y * roomPitch + columns + 1);
+	}
+
+	std::uint64_t* const tiles = words.data();
+	const auto openTile = [tiles] (const std::size_t tile_)
+	{
+		tiles[tile_ >> 6] |= std::uint64_t(1) << (tile_ & 63);
+	};
+
+	RandomBits bits(random_);
+
+	const std::size_t startRoom = roomPitch + 1;
+	const std::size_t startTile = stride * 64 + 1;
+
+	std::size_t room = startRoom;
+	std::size_t tile = startTile;
+	markVisited(room);
+	openTile(tile);
+
+	while (true)
+	{
+		// 1. 아직 방문하지 않은 이웃 방들을 마스크로 모읍니다.
+		unsigned mask = 0;
+		for (int direction = 0; direction < 4; ++direction)
+		{
+			const std::size_t next = room + roomStep[direction];
+			mask |= static_cast<unsigned>(~(visited[next >> 6] >> (next & 63)) & 1) << direction;
+		}
+
+		// 2. 이웃이 있다면 벽을 허물고 이동하고, 없다면 부모 방으로 돌아갑니다.
+		if (mask != 0)
+		{
+			const int direction = CHOICES[mask][(mask & (mask - 1)) != 0 ? bits.NextByte() : 0];
+
+			openTile(tile + tileStep[direction]);
+
+			room += roomStep[direction];
+			tile += tileStep[direction] * 2;
+
+			markVisited(room);
+			openTile(tile);
+			parents[room >> 5] |= static_cast<std::uint64_t>((direction + 2) & 3) << ((room & 31) * 2);
+		}
+		else
+		{
+			if (room == startRoom)
+			{
+				break;
+			}
+
+			const int direction = static_cast<int>((parents[room >> 5] >> ((room & 31) * 2)) & 3);
+			room += roomStep[direction];
+			tile += tileStep[direction] * 2;
+		}
+	}
+}
+
+void Maze::GenerateEller(std::mt19937_64& random_) noexcept
+{
+	const int columns = (width  - 1) / 2;
+	const int rows	  = (height - 1) / 2;
+
+	// 같은 집합의 열들을 원형 연결 리스트(left, right)로 잇습니다.
+	// 집합은 서로 교차하지 않으므로, 두 이웃 열 c, c + 1이 같은 집합이라면 반드시 left[c + 1] == c 입니다.
+	// 마지막 열 다음에는 마지막 열과 같은 집합인 것처럼 보이는 열을 하나 더 두어, 범위 검사 없이 합치지 않게 합니다.
+	std::vector<int> left(columns + 1);
+	std::vector<int> right(columns + 1);
+	for (int column = 0; column < columns; ++column)
+	{
+		left[column]  = column;
+		right[column] = column;
+	}
+	left[columns]  = columns - 1;
+	right[columns] = columns;
+
+	// 한 워드(64 타일)에는 방이 32개 있으므로, 워드마다 난수 하나를 뽑아 합칠지(하위 32비트)와 막을지(상위 32비트)를 정하고
+	// 행의 비트도 워드 단위로 모아서 기록합니다.
+	for (int row = 0; row + 1 < rows; ++row)
+	{
+		std::uint64_t* const roomRow = words.data() + static_cast<std::size_t>(row * 2 + 1) * stride;
+		std::uint64_t* const downRow = roomRow + stride;
+
+		std::uint64_t carry = 0;
+		for (std::size_t word = 0; word < stride; ++word)
+		{
+			const std::uint64_t coins = random_();
+			const int			first = static_cast<int>(word * 32);
+			const int			last  = std::min(columns, first + 32);
+
+			std::uint32_t merged = 0;
+			std::uint32_t closed = 0;
+
+			// 합치기와 막기는 무작위이므로 분기 대신 항상 같은 위치에 기록합니다.
+			// 하지 않을 때는 그 위치에 이미 있는 값을 다시 기록하게 되어 리스트가 바뀌지 않습니다.
+			for (int column = first; column < last; ++column)
+			{
+				const int index = column - first;
+
+				// 1. 오른쪽 방과 다른 집합이라면 무작위로 합칩니다. 합치지 않는다면 target은 자기 자신입니다.
+				const int other		  = left[column + 1];
+				const int rightColumn = right[column];
+
+				const bool isMerged = (other != column) & static_cast<bool>((coins >> index) & 1);
+				const int  target	= Select(isMerged, other, column);
+				right[target]		= rightColumn;
+				left[rightColumn]	= target;
+				right[column]		= Select(isMerged, column + 1, rightColumn);
+				left[column + 1]	= other ^ target ^ column;
+
+				// 2. 집합에 다른 방이 남아 있다면 무작위로 아래를 막고 집합에서 뺍니다. 아니라면 아래로 뚫습니다.
+				const int  previous = left[column];
+				const int  next		= right[column];
+				const bool isClosed = (previous != column) & static_cast<bool>((coins >> (32 + index)) & 1);
+				right[previous] = Select(isClosed, next, column);
+				left[next]		= Select(isClosed, previous, column);
+				left[column]	= Select(isClosed, column, previous);
+				right[column]	= Select(isClosed, column, next);
+
+				merged |= std::uint32_t(isMerged) << index;
+				closed |= std::uint32_t(isClosed) << index;
+			}
+
+			// 방 비트는 홀수 자리, 오른쪽 통로는 그다음 자리입니다. 워드의 마지막 방(bit 63)의 오른쪽 통로는 다음 워드의 첫 비트입니다.
+			const std::uint32_t rooms = last - first == 32 ? ~std::uint32_t(0) : (std::uint32_t(1) << (last - first)) - 1;
+
+			roomRow[word] = carry | (Spread(rooms) << 1) | (Spread(merged) << 2);
+			downRow[word] = Spread(rooms & ~closed) << 1;
+			carry		  = merged >> 31;
+		}
+	}
+	// 3. 마지막 행은 서로 다른 집합을 모두 합쳐 하나의 미로로 만듭니다.
+	const int tileY = rows * 2 - 1;
+	for (int column = 0; column < columns; ++column)
+	{
+		const int tileX = column * 2 + 1;
+		Open(tileX, tileY);
+
+		if (column + 1 < columns && left[column + 1] != column)
+		{
+			const int other = left[column + 1];
+
+			right[other]		= right[column];
+			left[right[column]] = other;
+			right[column]		= column + 1;
+			left[column + 1]	= column;
+
+			Open(tileX + 1, tileY);
+		}
+	}
+}
+
+void Maze::Benchmark() noexcept
+{
+	constexpr int SIZE = 16384;
+
+	Maze maze;
+
+	for (const Algorithm algorithm : { Algorithm::Eller, Algorithm::Backtracker })
+	{
+		const auto start = std::chrono::steady_clock::now();
+		maze.Generate(SIZE, SIZE, algorithm, 42);
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::size_t openCount = 0;
+		for (const std::uint64_t word : maze.words)
+		{
+			openCount += std::popcount(word);
+		}
+
+		spdlog::info("Maze {}x{} ({}): {:.1f} ms, {} open tiles, {:.1f} MB",
+					 SIZE,
+					 SIZE,
+					 algorithm == Algorithm::Eller ? "Eller" : "Backtracker",
+					 elapsed.count(),
+					 openCount,
+					 maze.words.size() * sizeof(std::uint64_t) / (1024.0 * 1024.0));
+	}
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "PCH.h"
+
+/**
+ * @brief 칸마다 1비트(통로 여부)로 저장되는 미로.
+ *
+ * 미로는 타일 격자이며, 홀수 좌표(2i + 1, 2j + 1)의 타일이 방이고 그 사이의 타일이 벽 또는 통로입니다.
+ * 행마다 64비트 단위로 채워 저장하므로, 16384 x 16384 미로도 32MB로 표현됩니다.
+ */
+class Maze final
+{
+public:
+	/**
+	 * @brief 미로 생성 알고리즘을 정의합니다.
+	 */
+	enum class Algorithm : unsigned char
+	{
+		/**
+		 * @brief 반복형 백트래커. 길고 구불구불한 통로를 만듭니다.
+		 */
+		Backtracker,
+
+		/**
+		 * @brief Eller 알고리즘. 한 행씩 만들어 나가므로 가장 빠르고, 행 크기만큼의 메모리만 추가로 사용합니다.
+		 */
+		Eller
+	};
+
+	/**
+	 * @brief 생성자. 비어 있는 미로를 만듭니다.
+	 */
+	explicit Maze() noexcept;
+
+	/**
+	 * @brief 미로를 생성합니다. 재귀를 사용하지 않습니다.
+	 *
+	 * @param width_	 타일 단위 너비
+	 * @param height_	 타일 단위 높이
+	 * @param algorithm_ 생성 알고리즘
+	 * @param seed_		 난수 시드. 같은 시드는 같은 미로를 만듭니다.
+	 */
+	void Generate(const int			  width_,
+				  const int			  height_,
+				  const Algorithm	  algorithm_,
+				  const std::uint64_t seed_) noexcept;
+
+	/**
+	 * @brief 지정한 타일이 통로인지 확인합니다.
+	 *
+	 * @param x_ 타일 x 좌표
+	 * @param y_ 타일 y 좌표
+	 *
+	 * @return bool 통로라면 true. 범위 밖은 벽입니다.
+	 */
+	[[nodiscard]]
+	inline bool IsOpen(const int x_, const int y_) const noexcept;
+
+	/**
+	 * @brief 타일 단위 너비를 반환합니다.
+	 *
+	 * @return int 타일 단위 너비
+	 */
+	[[nodiscard]]
+	inline int GetWidth() const noexcept;
+
+	/**
+	 * @brief 타일 단위 높이를 반환합니다.
+	 *
+	 * @return int 타일 단위 높이
+	 */
+	[[nodiscard]]
+	inline int GetHeight() const noexcept;
+
+	/**
+	 * @brief 지정한 행의 비트를 반환합니다. x번째 타일은 (x / 64)번째 워드의 (x % 64)번째 비트입니다.
+	 *
+	 * @param y_ 행 번호
+	 *
+	 * @return std::span<const std::uint64_t> 행의 워드들
+	 */
+	[[nodiscard]]
+	inline std::span<const std::uint64_t> GetRow(const int y_) const noexcept;
+
+	/**
+	 * @brief 16384 x 16384 미로를 알고리즘별로 생성하여 걸린 시간을 로그로 남깁니다.
+	 */
+	static void Benchmark() noexcept;
+
+private:
+	/**
+	 * @brief 지정한 타일을 통로로 만듭니다.
+	 *
+	 * @param x_ 타일 x 좌표
+	 * @param y_ 타일 y 좌표
+	 */
+	inline void Open(const int x_, const int y_) noexcept;
+
+	/**
+	 * @brief 반복형 백트래커로 방들을 잇습니다.
+	 *
+	 * 명시적 스택 대신 방마다 돌아갈 방향을 2비트로 기록하여 되돌아갑니다.
+	 *
+	 * @param random_ 난수 생성기
+	 */
+	void GenerateBacktracker(std::mt19937_64& random_) noexcept;
+
+	/**
+	 * @brief Eller 알고리즘으로 방들을 한 행씩 잇습니다.
+	 *
+	 * @param random_ 난수 생성기
+	 */
+	void GenerateEller(std::mt19937_64& random_) noexcept;
+
+	/**
+	 * @brief 타일 단위 너비.
+	 */
+	int width;
+
+	/**
+	 * @brief 타일 단위 높이.
+	 */
+	int height;
+
+	/**
+	 * @brief 한 행의 워드 수.
+	 */
+	std::size_t stride;
+
+	/**
+	 * @brief 타일 비트들. 1이면 통로입니다.
+	 */
+	std::vector<std::uint64_t> words;
+};
+
+inline bool Maze::IsOpen(const int x_, const int y_) const noexcept
+{
+	if (x_ < 0 || y_ < 0 || x_ >= width || y_ >= height)
+	{
+		return false;
+	}
+
+	return (words[y_ * stride + (x_ >> 6)] >> (x_ & 63)) & 1;
+}
+
+inline int Maze::GetWidth() const noexcept
+{
+	return width;
+}
+
+inline int Maze::GetHeight() const noexcept
+{
+	return height;
+}
+
+inline std::span<const std::uint64_t> Maze::GetRow(const int y_) const noexcept
+{
+	return std::span<const std::uint64_t>(words.data() + y_ * stride, stride);
+}
+
+inline void Maze::Open(const int x_, const int y_) noexcept
+{
+	words[y_ * stride + (x_ >> 6)] |= std::uint64_t(1) << (x_ & 63);
+}
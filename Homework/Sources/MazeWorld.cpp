@@ -0,0 +1,458 @@
+#include "MazeWorld.h"
+
+#include "Camera.h"
+#include "Mesh.h"
+#include "Resources.h"
+#include "Shader.h"
+
+MazeWorld::MazeWorld(const std::uint64_t seed_,
+					 const std::size_t	 memoryBudget_) noexcept
+	: seed(seed_)
+	, memoryBudget(memoryBudget_)
+	, memoryUsage(0)
+	, updateCount(0)
+	, source(nullptr)
+	, origin(0.0f)
+	, wallAnimation(Animation::Default)
+	, pathAnimation(Animation::Default)
+	, isPaused(false)
+	, time(0.0f)
+	, mesh(Resources::GetMesh("Resources/Meshes/Mountain.obj"))
+{
+}
+
+MazeWorld::MazeWorld(const std::uint64_t seed_,
+					 const Maze&		 maze_,
+					 const glm::vec3&	 origin_,
+					 const std::size_t	 memoryBudget_) noexcept
+	: seed(seed_)
+	, memoryBudget(memoryBudget_)
+	, memoryUsage(0)
+	, updateCount(0)
+	, source(&maze_)
+	, origin(origin_)
+	, wallAnimation(Animation::Default)
+	, pathAnimation(Animation::Default)
+	, isPaused(false)
+	, time(0.0f)
+	, mesh(Resources::GetMesh("Resources/Meshes/Mountain.obj"))
+{
+}
+
+MazeWorld::~MazeWorld() noexcept
+{
+	for (const auto& [key, chunk] : chunks)
+	{
+		glDeleteBuffers(1, &chunk->instanceBuffer);
+	}
+}
+
+void MazeWorld::Update(const glm::vec3& focus_) noexcept
+{
+	++updateCount;
+
+	const glm::ivec2 center = glm::ivec2(static_cast<int>(std::floor((focus_.x - origin.x) / CHUNK_SIZE)),
+										 static_cast<int>(std::floor((focus_.z - origin.z) / CHUNK_SIZE)));
+
+	// 1. 반경 안의 청크를 가까운 순서로 훑으며, 있는 청크는 최근 사용으로 옮기고 없는 청크는 제한된 개수만 만듭니다.
+	std::array<glm::ivec2, (VIEW_RADIUS * 2 + 1) * (VIEW_RADIUS * 2 + 1)> requests;
+	{
+		std::size_t count = 0;
+		for (int y = -VIEW_RADIUS; y <= VIEW_RADIUS; ++y)
+		{
+			for (int x = -VIEW_RADIUS; x <= VIEW_RADIUS; ++x)
+			{
+				requests[count++] = glm::ivec2(x, y);
+			}
+		}
+
+		std::ranges::sort(requests, {}, [] (const glm::ivec2& offset_) { return offset_.x * offset_.x + offset_.y * offset_.y; });
+	}
+
+	int createCount = 0;
+	for (const glm::ivec2& offset : requests)
+	{
+		const glm::ivec2	coordinate = center + offset;
+		const std::uint64_t key		   = ToKey(coordinate);
+
+		if (!IsInside(coordinate))
+		{
+			continue;
+		}
+
+		if (const auto found = chunks.find(key); found != chunks.end())
+		{
+			Chunk& chunk = *found->second;
+			chunk.lastUsed = updateCount;
+			lru.splice(lru.begin(), lru, chunk.lruPosition);
+
+			// 기준 위치와 맞닿은 청크는 보이지 않아도 충돌에 쓰이므로 움직입니다.
+			if (std::abs(offset.x) <= 1 && std::abs(offset.y) <= 1)
+			{
+				chunk.isActive = true;
+			}
+			continue;
+		}
+
+		if (createCount >= MAX_CHUNKS_PER_UPDATE)
+		{
+			continue;
+		}
+
+		std::unique_ptr<Chunk> chunk = CreateChunk(coordinate);
+		chunk->lastUsed	   = updateCount;
+		chunk->lruPosition = lru.insert(lru.begin(), key);
+
+		memoryUsage += GetChunkMemory(*chunk);
+		chunks.emplace(key, std::move(chunk));
+		++createCount;
+	}
+
+	// 2. 예산을 넘었다면 오래된 청크부터 버립니다.
+	Evict();
+}
+
+void MazeWorld::Animate(const float deltaTime_) noexcept
+{
+	if (!source)
+	{
+		return;
+	}
+
+	time += deltaTime_;
+
+	// 목표 높이까지 step_만큼 다가갑니다.
+	const auto moveToward = [] (float& height_, const float target_, const float step_)
+	{
+		height_ = height_ < target_ ? std::min(height_ + step_, target_) : std::max(height_ - step_, target_);
+	};
+
+	for (const auto& [key, chunk] : chunks)
+	{
+		if (!chunk->isActive)
+		{
+			continue;
+		}
+
+		const float elapsed = time - chunk->animatedTime;
+		chunk->isActive		= false;
+		chunk->animatedTime = time;
+
+		bool isChanged = false;
+		for (int y = 0; y < CHUNK_SIZE; ++y)
+		{
+			for (int x = 0; x < CHUNK_SIZE; ++x)
+			{
+				if (!((chunk->solids[y] >> x) & 1))
+				{
+					continue;
+				}
+
+				const int tileX = chunk->coordinate.x * CHUNK_SIZE + x;
+				const int tileZ = chunk->coordinate.y * CHUNK_SIZE + y;
+				const float step = elapsed * GetAnimationSpeed(tileX, tileZ);
+
+				float&		height	 = chunk->heights[y * CHUNK_SIZE + x];
+				const float previous = height;
+
+				switch ((chunk->rows[y] >> x) & 1 ? pathAnimation : wallAnimation)
+				{
+					case Animation::Default:
+					{
+						const float target = GetWallHeight(tileX, tileZ);
+						if (height < target)
+						{
+							height = std::min(height + step, target);
+						}
+						break;
+					}
+					case Animation::Breathing:
+					{
+						if (isPaused)
+						{
+							break;
+						}
+
+						const std::uint32_t bit = 1u << x;
+						if (chunk->growing[y] & bit)
+						{
+							const float target = GetWallHeight(tileX, tileZ);
+
+							height = std::min(height + step, target);
+							if (height >= target)
+							{
+								chunk->growing[y] &= ~bit;
+							}
+						}
+						else
+						{
+							height = std::max(height - step, 0.0f);
+							if (height <= 0.0f)
+							{
+								chunk->growing[y] |= bit;
+							}
+						}
+						break;
+					}
+					case Animation::Path:
+					{
+						moveToward(height, 0.05f, step);
+						break;
+					}
+					case Animation::Level:
+					{
+						moveToward(height, 3.0f, step);
+						break;
+					}
+				}
+
+				isChanged |= height != previous;
+			}
+		}
+
+		// 높이가 바뀐 청크만 인스턴스 버퍼를 다시 올립니다. 인스턴스의 개수와 순서는 그대로입니다.
+		if (isChanged)
+		{
+			BuildInstances(*chunk);
+
+			glBindBuffer(GL_ARRAY_BUFFER, chunk->instanceBuffer);
+			glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(sizeof(glm::vec4) * instances.size()), instances.data());
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+		}
+	}
+}
+
+void MazeWorld::PlayAnimation(const Animation animation_) noexcept
+{
+	pathAnimation = animation_;
+
+	if (animation_ != Animation::Path)
+	{
+		wallAnimation = animation_;
+	}
+}
+
+void MazeWorld::Render(const Camera& camera_) noexcept
+{
+	if (!mesh)
+	{
+		return;
+	}
+
+	// 뷰-투영 행렬의 행으로부터 절두체의 여섯 평면을 구합니다. (평면의 법선은 안쪽을 향합니다)
+	const glm::mat4 viewProjection = camera_.GetProjectionMatrix() * camera_.GetViewMatrix();
+	const glm::vec4 row0 = glm::vec4(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+	const glm::vec4 row1 = glm::vec4(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+	const glm::vec4 row2 = glm::vec4(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+	const glm::vec4 row3 = glm::vec4(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+	const std::array<glm::vec4, 6> planes = { row3 + row0, row3 - row0, row3 + row1, row3 - row1, row3 + row2, row3 - row2 };
+
+	const auto isVisible = [&planes] (const glm::vec3& min_, const glm::vec3& max_) -> bool
+	{
+		for (const glm::vec4& plane : planes)
+		{
+			// 평면 법선 방향으로 가장 먼 꼭짓점이 평면 뒤에 있다면 상자 전체가 밖에 있습니다.
+			const glm::vec3 farthest = glm::vec3(plane.x >= 0.0f ? max_.x : min_.x,
+												 plane.y >= 0.0f ? max_.y : min_.y,
+												 plane.z >= 0.0f ? max_.z : min_.z);
+
+			if (glm::dot(glm::vec3(plane), farthest) + plane.w < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	Shader::SetUniformInt("uInstanced", 1);
+	Shader::SetUniformVector3("uInstanceScale", glm::vec3(1.0f));
+
+	for (const auto& [key, chunk] : chunks)
+	{
+		// 이번 Update에서 요청되지 않은 청크는 예산이 남아 캐시되어 있을 뿐이므로 그리지 않습니다.
+		if (chunk->lastUsed != updateCount || chunk->instanceCount == 0)
+		{
+			continue;
+		}
+
+		const glm::vec3 min = origin + glm::vec3(chunk->coordinate.x * CHUNK_SIZE, 0.0f, chunk->coordinate.y * CHUNK_SIZE);
+		const glm::vec3 max = glm::vec3(min.x + CHUNK_SIZE,				  7.0f, min.z + CHUNK_SIZE);
+		if (!isVisible(min, max))
+		{
+			continue;
+		}
+
+		mesh->RenderInstanced(chunk->instanceBuffer, chunk->instanceCount);
+		chunk->isActive = true;
+	}
+
+	Shader::SetUniformInt("uInstanced", 0);
+}
+
+void MazeWorld::CollectWalls(const AABB&		box_,
+							 std::vector<AABB>& walls_) const noexcept
+{
+	const int minX = static_cast<int>(std::floor(box_.min.x - origin.x));
+	const int maxX = static_cast<int>(std::floor(box_.max.x - origin.x));
+	const int minZ = static_cast<int>(std::floor(box_.min.z - origin.z));
+	const int maxZ = static_cast<int>(std::floor(box_.max.z - origin.z));
+
+	for (int tileZ = minZ; tileZ <= maxZ; ++tileZ)
+	{
+		for (int tileX = minX; tileX <= maxX; ++tileX)
+		{
+			const int chunkX = static_cast<int>(std::floor(static_cast<float>(tileX) / CHUNK_SIZE));
+			const int chunkZ = static_cast<int>(std::floor(static_cast<float>(tileZ) / CHUNK_SIZE));
+
+			const auto found = chunks.find(ToKey(glm::ivec2(chunkX, chunkZ)));
+			if (found == chunks.end())
+			{
+				continue;
+			}
+
+			const int	localX = tileX - chunkX * CHUNK_SIZE;
+			const int	localZ = tileZ - chunkZ * CHUNK_SIZE;
+			const float height = found->second->heights[localZ * CHUNK_SIZE + localX];
+			if (height < 0.5f)
+			{
+				continue;
+			}
+
+			const glm::vec3 min = origin + glm::vec3(tileX, 0.0f, tileZ);
+			walls_.push_back(AABB{ min, min + glm::vec3(1.0f, height, 1.0f) });
+		}
+	}
+}
+
+std::unique_ptr<MazeWorld::Chunk> MazeWorld::CreateChunk(const glm::ivec2& coordinate_) noexcept
+{
+	std::unique_ptr<Chunk> chunk = std::make_unique<Chunk>();
+	chunk->coordinate = coordinate_;
+
+	if (source)
+	{
+		// 1. 무대라면 미로의 행 워드에서 이 청크의 비트를 그대로 잘라 옵니다. 미로 밖의 타일은 통로로 두어 벽을 세우지 않습니다.
+		const int			firstX	= coordinate_.x * CHUNK_SIZE;
+		const int			count	= std::min(source->GetWidth() - firstX, CHUNK_SIZE);
+		const std::uint32_t outside = count < CHUNK_SIZE ? ~std::uint32_t(0) << count : 0;
+
+		for (int y = 0; y < CHUNK_SIZE; ++y)
+		{
+			const int tileZ = coordinate_.y * CHUNK_SIZE + y;
+			if (tileZ >= source->GetHeight())
+			{
+				chunk->rows[y] = ~std::uint32_t(0);
+				continue;
+			}
+
+			chunk->rows[y] = static_cast<std::uint32_t>(source->GetRow(tileZ)[firstX >> 6] >> (firstX & 63)) | outside;
+		}
+	}
+	else
+	{
+		// 1. 오른쪽과 아래쪽 벽은 이웃 청크의 왼쪽과 위쪽 벽이므로, 한 타일 큰 미로를 만들고 CHUNK_SIZE만큼만 사용합니다.
+		scratch.Generate(CHUNK_SIZE + 1, CHUNK_SIZE + 1, Maze::Algorithm::Backtracker, Hash(coordinate_.x, coordinate_.y, 0));
+
+		for (int y = 0; y < CHUNK_SIZE; ++y)
+		{
+			chunk->rows[y] = static_cast<std::uint32_t>(scratch.GetRow(y)[0]);
+		}
+
+		// 2. 왼쪽과 위쪽 경계에 문을 하나씩 뚫습니다. 문의 위치는 이 청크의 좌표로만 정해지므로 이웃도 같은 문을 봅니다.
+		const std::uint64_t doors = Hash(coordinate_.x, coordinate_.y, 1);
+		const int			left  = static_cast<int>(doors		  % (CHUNK_SIZE / 2)) * 2 + 1;
+		const int			top	  = static_cast<int>((doors >> 32) % (CHUNK_SIZE / 2)) * 2 + 1;
+
+		chunk->rows[left] |= 1u;
+		chunk->rows[0]	  |= 1u << top;
+	}
+
+	// 3. 그릴 타일의 높이를 정합니다. 무한 미로는 벽만 제 높이로 서 있고, 무대는 모든 타일이 높이 1에서 애니메이션을 시작합니다.
+	for (int y = 0; y < CHUNK_SIZE; ++y)
+	{
+		chunk->solids[y]  = source ? 0 : ~chunk->rows[y];
+		chunk->growing[y] = 0;
+
+		for (int x = 0; x < CHUNK_SIZE; ++x)
+		{
+			const int tileX = coordinate_.x * CHUNK_SIZE + x;
+			const int tileZ = coordinate_.y * CHUNK_SIZE + y;
+
+			if (source && tileX < source->GetWidth() && tileZ < source->GetHeight())
+			{
+				chunk->solids[y] |= 1u << x;
+			}
+
+			float& height = chunk->heights[y * CHUNK_SIZE + x];
+			if (!((chunk->solids[y] >> x) & 1))
+			{
+				height = 0.0f;
+			}
+			else
+			{
+				height = source ? 1.0f : GetWallHeight(tileX, tileZ);
+			}
+		}
+	}
+
+	chunk->isActive		= true;
+	chunk->animatedTime = time;
+
+	// 4. 그릴 타일마다 인스턴스를 만들어 올립니다. 무대의 청크는 애니메이션마다 다시 올립니다.
+	BuildInstances(*chunk);
+	chunk->instanceCount = static_cast<GLsizei>(instances.size());
+
+	glGenBuffers(1, &chunk->instanceBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, chunk->instanceBuffer);
+	glBufferData(GL_ARRAY_BUFFER,
+				 static_cast<GLsizeiptr>(sizeof(glm::vec4) * instances.size()),
+				 instances.data(),
+				 source ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	return chunk;
+}
+
+void MazeWorld::BuildInstances(const Chunk& chunk_) noexcept
+{
+	instances.clear();
+
+	for (int y = 0; y < CHUNK_SIZE; ++y)
+	{
+		for (int x = 0; x < CHUNK_SIZE; ++x)
+		{
+			if (!((chunk_.solids[y] >> x) & 1))
+			{
+				continue;
+			}
+
+			const int	tileX  = chunk_.coordinate.x * CHUNK_SIZE + x;
+			const int	tileZ  = chunk_.coordinate.y * CHUNK_SIZE + y;
+			const float height = chunk_.heights[y * CHUNK_SIZE + x];
+
+			instances.emplace_back(origin.x + tileX + 0.5f, height * 0.5f, origin.z + tileZ + 0.5f, height);
+		}
+	}
+}
+
+void MazeWorld::Evict() noexcept
+{
+	while (memoryUsage > memoryBudget && !lru.empty())
+	{
+		const auto found = chunks.find(lru.back());
+
+		// 목록의 뒤쪽부터 오래된 순서이므로, 이번에 요청된 청크를 만났다면 더 버릴 수 있는 청크가 없습니다.
+		if (found->second->lastUsed == updateCount)
+		{
+			break;
+		}
+
+		memoryUsage -= GetChunkMemory(*found->second);
+		glDeleteBuffers(1, &found->second->instanceBuffer);
+
+		chunks.erase(found);
+		lru.pop_back();
+	}
+}
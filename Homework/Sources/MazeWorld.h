@@ -0,0 +1,428 @@
+#pragma once
+
+#include "PCH.h"
+
+#include "AABB.h"
+#include "Maze.h"
+
+class Camera;
+class Mesh;
+
+/**
+ * @brief 청크 단위로 필요할 때 만들고, 메모리 예산을 넘으면 가장 오래 쓰지 않은 청크부터 버리는 무한 미로.
+ *
+ * 청크는 CHUNK_SIZE x CHUNK_SIZE 타일이며 (월드 시드, 청크 좌표)만으로 결정되므로 버렸다가 다시 만들어도 같습니다.
+ * 각 청크는 내부가 완전 미로이고, 왼쪽과 위쪽 경계에 문을 하나씩 뚫어 이웃 청크와 이어집니다.
+ * 벽은 청크마다 인스턴스 버퍼 하나로 올려 한 번의 호출로 그립니다.
+ *
+ * 이미 생성한 미로를 주면 무대가 됩니다. 이때 청크는 미로의 행 워드에서 잘라 오고, 미로 밖의 청크는 만들지 않습니다.
+ * 무대는 통로까지 모든 타일이 산으로 솟아 있다가 애니메이션으로 움직이며, 그려졌거나 기준 위치와 맞닿은 청크만 움직입니다.
+ */
+class MazeWorld final
+{
+public:
+	/**
+	 * @brief 무대 타일의 애니메이션을 정의합니다.
+	 */
+	enum class Animation : unsigned char
+	{
+		/**
+		 * @brief 기본: 타일마다 정해진 높이까지 자라남
+		 */
+		Default,
+
+		/**
+		 * @brief M: 숨쉬기 (오르락내리락)
+		 */
+		Breathing,
+
+		/**
+		 * @brief R: 미로 경로 (통로 타일만 납작해짐)
+		 */
+		Path,
+
+		/**
+		 * @brief V: 균등화 (높이 3.0 고정)
+		 */
+		Level
+	};
+
+	/**
+	 * @brief 생성자.
+	 *
+	 * @param seed_			월드 시드
+	 * @param memoryBudget_ 상주 청크가 사용할 수 있는 최대 메모리(바이트). CPU와 GPU 사용량의 합입니다.
+	 */
+	explicit MazeWorld(const std::uint64_t seed_,
+					   const std::size_t   memoryBudget_) noexcept;
+
+	/**
+	 * @brief 생성자. 이미 생성한 미로를 청크로 나누어 무대로 사용합니다.
+	 *
+	 * @param seed_			벽 높이에 사용할 시드
+	 * @param maze_			무대의 미로. 이 객체보다 오래 살아 있어야 합니다.
+	 * @param origin_		미로의 (0, 0) 타일의 모서리가 놓일 월드 위치
+	 * @param memoryBudget_ 상주 청크가 사용할 수 있는 최대 메모리(바이트). CPU와 GPU 사용량의 합입니다.
+	 */
+	explicit MazeWorld(const std::uint64_t seed_,
+					   const Maze&		   maze_,
+					   const glm::vec3&	   origin_,
+					   const std::size_t   memoryBudget_) noexcept;
+
+	/**
+	 * @brief 소멸자.
+	 */
+	~MazeWorld() noexcept;
+
+	MazeWorld(const MazeWorld&) = delete;
+	MazeWorld& operator=(const MazeWorld&) = delete;
+
+	/**
+	 * @brief 지정한 위치 주변의 청크를 가까운 순서로 준비하고, 예산을 넘은 청크를 버립니다.
+	 *
+	 * 프레임 시간이 튀지 않도록 한 번에 MAX_CHUNKS_PER_UPDATE개까지만 만듭니다.
+	 *
+	 * @param focus_ 기준 위치 (플레이어 또는 카메라)
+	 */
+	void Update(const glm::vec3& focus_) noexcept;
+
+	/**
+	 * @brief 무대 타일의 애니메이션을 진행합니다. 무한 미로의 벽은 움직이지 않습니다.
+	 *
+	 * 지난 Animate 이후 그려졌거나 기준 위치와 맞닿은 청크만 움직이고 인스턴스 버퍼를 다시 올립니다.
+	 * 쉬고 있던 청크는 다시 움직일 때 그동안 흐른 시간만큼 한 번에 따라잡습니다.
+	 *
+	 * @param deltaTime_ 이전 프레임과의 시간 차이(초)
+	 */
+	void Animate(const float deltaTime_) noexcept;
+
+	/**
+	 * @brief 무대 타일의 애니메이션을 바꿉니다. Path는 통로 타일에만 적용되며, 벽 타일은 하던 애니메이션을 이어 갑니다.
+	 *
+	 * @param animation_ 바꿀 애니메이션
+	 */
+	void PlayAnimation(const Animation animation_) noexcept;
+
+	/**
+	 * @brief 숨쉬기 애니메이션을 멈추거나 다시 움직입니다.
+	 *
+	 * @param isPaused_ 멈춤 여부
+	 */
+	inline void SetPaused(const bool isPaused_) noexcept;
+
+	/**
+	 * @brief 지정한 카메라의 절두체에 들어오는 청크들을 그리고, 다음 Animate에서 움직일 청크로 표시합니다.
+	 *
+	 * @param camera_ 기준 카메라
+	 */
+	void Render(const Camera& camera_) noexcept;
+
+	/**
+	 * @brief 지정한 충돌 박스와 겹치는 벽들을 모읍니다. 높이가 0.5보다 낮은 타일과 아직 만들지 않은 청크는 비어 있는 것으로 봅니다.
+	 *
+	 * @param box_	 검사할 충돌 박스
+	 * @param walls_ 벽의 충돌 박스를 추가할 위치
+	 */
+	void CollectWalls(const AABB&		 box_,
+					  std::vector<AABB>& walls_) const noexcept;
+
+	/**
+	 * @brief 플레이어가 등장할 위치를 반환합니다. (원점 청크의 첫 번째 방)
+	 *
+	 * @return glm::vec3 등장 위치
+	 */
+	[[nodiscard]]
+	static inline glm::vec3 GetSpawnPosition() noexcept;
+
+	/**
+	 * @brief 상주 중인 청크의 개수를 반환합니다.
+	 *
+	 * @return std::size_t 상주 중인 청크의 개수
+	 */
+	[[nodiscard]]
+	inline std::size_t GetResidentCount() const noexcept;
+
+	/**
+	 * @brief 상주 중인 청크가 사용하는 메모리를 반환합니다.
+	 *
+	 * @return std::size_t 사용 중인 메모리(바이트)
+	 */
+	[[nodiscard]]
+	inline std::size_t GetMemoryUsage() const noexcept;
+
+private:
+	/**
+	 * @brief 청크 한 변의 타일 수. 무대의 청크는 미로의 64비트 워드를 나누어 쓰므로 64의 약수여야 합니다.
+	 */
+	static constexpr int CHUNK_SIZE = 32;
+	static_assert(64 % CHUNK_SIZE == 0);
+
+	/**
+	 * @brief 기준 위치로부터 준비할 청크 반경.
+	 */
+	static constexpr int VIEW_RADIUS = 4;
+
+	/**
+	 * @brief 한 번의 Update에서 만들 수 있는 최대 청크 수.
+	 */
+	static constexpr int MAX_CHUNKS_PER_UPDATE = 4;
+
+	/**
+	 * @brief 청크 하나.
+	 */
+	struct Chunk final
+	{
+		/**
+		 * @brief 청크 좌표.
+		 */
+		glm::ivec2 coordinate;
+
+		/**
+		 * @brief 행마다 CHUNK_SIZE개의 타일 비트. 1이면 통로입니다.
+		 */
+		std::array<std::uint32_t, CHUNK_SIZE> rows;
+
+		/**
+		 * @brief 행마다 인스턴스로 그릴 타일 비트. 무한 미로는 벽만, 무대는 미로 안의 모든 타일을 그립니다.
+		 */
+		std::array<std::uint32_t, CHUNK_SIZE> solids;
+
+		/**
+		 * @brief 타일마다 현재 높이. 그리지 않는 타일은 0입니다.
+		 */
+		std::array<float, CHUNK_SIZE * CHUNK_SIZE> heights;
+
+		/**
+		 * @brief 행마다 숨쉬기 애니메이션에서 자라는 중인 타일 비트.
+		 */
+		std::array<std::uint32_t, CHUNK_SIZE> growing;
+
+		/**
+		 * @brief 벽 인스턴스 버퍼. 인스턴스마다 (x, y, z, 높이)입니다.
+		 */
+		GLuint instanceBuffer;
+
+		/**
+		 * @brief 벽 인스턴스 개수.
+		 */
+		GLsizei instanceCount;
+
+		/**
+		 * @brief 마지막으로 요청된 Update 번호.
+		 */
+		std::uint64_t lastUsed;
+
+		/**
+		 * @brief 다음 Animate에서 움직일지 여부.
+		 */
+		bool isActive;
+
+		/**
+		 * @brief 마지막으로 움직인 시각(초).
+		 */
+		float animatedTime;
+
+		/**
+		 * @brief LRU 목록 내 위치.
+		 */
+		std::list<std::uint64_t>::iterator lruPosition;
+	};
+
+	/**
+	 * @brief 청크를 만들고 인스턴스 버퍼를 올립니다.
+	 *
+	 * @param coordinate_ 청크 좌표
+	 *
+	 * @return std::unique_ptr<Chunk> 만든 청크
+	 */
+	[[nodiscard]]
+	std::unique_ptr<Chunk> CreateChunk(const glm::ivec2& coordinate_) noexcept;
+
+	/**
+	 * @brief 청크의 현재 높이로 인스턴스들을 만듭니다.
+	 *
+	 * @param chunk_ 대상 청크
+	 */
+	void BuildInstances(const Chunk& chunk_) noexcept;
+
+	/**
+	 * @brief 가장 오래 쓰지 않은 청크부터, 이번 Update에 요청되지 않은 청크를 예산 안으로 들어올 때까지 버립니다.
+	 */
+	void Evict() noexcept;
+
+	/**
+	 * @brief 청크 하나가 사용하는 메모리를 반환합니다.
+	 */
+	[[nodiscard]]
+	static inline std::size_t GetChunkMemory(const Chunk& chunk_) noexcept;
+
+	/**
+	 * @brief 무대의 미로와 겹치는 청크인지 확인합니다. 무한 미로라면 항상 true입니다.
+	 */
+	[[nodiscard]]
+	inline bool IsInside(const glm::ivec2& coordinate_) const noexcept;
+
+	/**
+	 * @brief 청크 좌표를 맵의 키로 바꿉니다.
+	 */
+	[[nodiscard]]
+	static inline std::uint64_t ToKey(const glm::ivec2& coordinate_) noexcept;
+
+	/**
+	 * @brief 시드와 좌표로부터 난수 값을 만듭니다. (splitmix64)
+	 */
+	[[nodiscard]]
+	inline std::uint64_t Hash(const int x_, const int y_, const std::uint64_t salt_) const noexcept;
+
+	/**
+	 * @brief 지정한 벽 타일의 높이를 반환합니다.
+	 */
+	[[nodiscard]]
+	inline float GetWallHeight(const int tileX_, const int tileZ_) const noexcept;
+
+	/**
+	 * @brief 지정한 무대 타일의 애니메이션 속도(초당 높이)를 반환합니다.
+	 */
+	[[nodiscard]]
+	inline float GetAnimationSpeed(const int tileX_, const int tileZ_) const noexcept;
+
+	/**
+	 * @brief 월드 시드.
+	 */
+	std::uint64_t seed;
+
+	/**
+	 * @brief 메모리 예산(바이트).
+	 */
+	std::size_t memoryBudget;
+
+	/**
+	 * @brief 상주 청크가 사용 중인 메모리(바이트).
+	 */
+	std::size_t memoryUsage;
+
+	/**
+	 * @brief Update 호출 번호.
+	 */
+	std::uint64_t updateCount;
+
+	/**
+	 * @brief 무대의 미로. 무한 미로라면 nullptr입니다.
+	 */
+	const Maze* source;
+
+	/**
+	 * @brief (0, 0) 타일의 모서리가 놓이는 월드 위치.
+	 */
+	glm::vec3 origin;
+
+	/**
+	 * @brief 벽 타일의 애니메이션.
+	 */
+	Animation wallAnimation;
+
+	/**
+	 * @brief 통로 타일의 애니메이션.
+	 */
+	Animation pathAnimation;
+
+	/**
+	 * @brief 숨쉬기 애니메이션 멈춤 여부.
+	 */
+	bool isPaused;
+
+	/**
+	 * @brief Animate로 흐른 시각(초).
+	 */
+	float time;
+
+	/**
+	 * @brief 상주 중인 청크들.
+	 */
+	std::unordered_map<std::uint64_t, std::unique_ptr<Chunk>> chunks;
+
+	/**
+	 * @brief 최근에 사용한 순서의 청크 키 목록. 앞쪽이 최근입니다.
+	 */
+	std::list<std::uint64_t> lru;
+
+	/**
+	 * @brief 청크를 만들 때 재사용하는 미로.
+	 */
+	Maze scratch;
+
+	/**
+	 * @brief 인스턴스 버퍼를 올릴 때 재사용하는 배열.
+	 */
+	std::vector<glm::vec4> instances;
+
+	/**
+	 * @brief 벽 메쉬.
+	 */
+	Mesh* mesh;
+};
+
+inline glm::vec3 MazeWorld::GetSpawnPosition() noexcept
+{
+	return glm::vec3(1.5f, 0.0f, 1.5f);
+}
+
+inline void MazeWorld::SetPaused(const bool isPaused_) noexcept
+{
+	isPaused = isPaused_;
+}
+
+inline std::size_t MazeWorld::GetResidentCount() const noexcept
+{
+	return chunks.size();
+}
+
+inline std::size_t MazeWorld::GetMemoryUsage() const noexcept
+{
+	return memoryUsage;
+}
+
+inline std::size_t MazeWorld::GetChunkMemory(const Chunk& chunk_) noexcept
+{
+	return sizeof(Chunk) + static_cast<std::size_t>(chunk_.instanceCount) * sizeof(glm::vec4);
+}
+
+inline bool MazeWorld::IsInside(const glm::ivec2& coordinate_) const noexcept
+{
+	if (!source)
+	{
+		return true;
+	}
+
+	return coordinate_.x >= 0 && coordinate_.y >= 0
+		&& coordinate_.x * CHUNK_SIZE < source->GetWidth()
+		&& coordinate_.y * CHUNK_SIZE < source->GetHeight();
+}
+
+inline std::uint64_t MazeWorld::ToKey(const glm::ivec2& coordinate_) noexcept
+{
+	return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(coordinate_.x)) << 32) | static_cast<std::uint32_t>(coordinate_.y);
+}
+
+inline std::uint64_t MazeWorld::Hash(const int x_, const int y_, const std::uint64_t salt_) const noexcept
+{
+	std::uint64_t value = seed ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x_)) * 0x9E3779B97F4A7C15ull)
+							   ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(y_)) * 0xC2B2AE3D27D4EB4Full)
+							   ^ (salt_ * 0x165667B19E3779F9ull);
+
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
+
+inline float MazeWorld::GetWallHeight(const int tileX_, const int tileZ_) const noexcept
+{
+	// 3.0 이상 7.0 미만을 0.25 단위로 나눕니다.
+	return 3.0f + static_cast<float>(Hash(tileX_, tileZ_, 2) & 15) * 0.25f;
+}
+
+inline float MazeWorld::GetAnimationSpeed(const int tileX_, const int tileZ_) const noexcept
+{
+	// 2.0 이상 10.0 미만을 0.25 단위로 나눕니다.
+	return 2.0f + static_cast<float>(Hash(tileX_, tileZ_, 3) & 31) * 0.25f;
+}
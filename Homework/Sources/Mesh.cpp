@@ -65,5 +65,30 @@ void Mesh::Render(const GLenum renderMode_) const noexcept
     glBindVertexArray(vao);
     glDrawElements(renderMode_, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, nullptr);
 
+    glBindVertexArray(0);
+}
+
+void Mesh::RenderInstanced(const GLuint  instanceBuffer_,
+                           const GLsizei instanceCount_,
+                           const GLenum  renderMode_) const noexcept
+{
+    if (!isInitialized)
+    {
+        return;
+    }
+
+    glBindVertexArray(vao);
+
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer_);
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), nullptr);
+    glVertexAttribDivisor(3, 1);
+
+    glDrawElementsInstanced(renderMode_, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, nullptr, instanceCount_);
+
+    // 일반 렌더링에서는 인스턴스 속성을 사용하지 않으므로 꺼 둡니다.
+    glDisableVertexAttribArray(3);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
     glBindVertexArray(0);
 }
\ No newline at end of file
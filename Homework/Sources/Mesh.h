@@ -47,6 +47,19 @@ class Mesh
      */
     void Render(GLenum renderMode_ = GL_TRIANGLES) const noexcept;
 
+    /**
+     * @brief 해당 메쉬를 인스턴스마다 한 번씩 렌더링합니다.
+     *
+     * 인스턴스 버퍼의 원소는 vec4 하나이며 정점 속성 3번으로 전달됩니다.
+     *
+     * @param instanceBuffer_ 인스턴스 버퍼.
+     * @param instanceCount_  인스턴스 개수.
+     * @param renderMode_     렌더링 모드. 기본값은 GL_TRIANGLES입니다.
+     */
+    void RenderInstanced(const GLuint  instanceBuffer_,
+                         const GLsizei instanceCount_,
+                         GLenum        renderMode_ = GL_TRIANGLES) const noexcept;
+
 private:
     /**
      * @brief 해당 정점 배열 객체.
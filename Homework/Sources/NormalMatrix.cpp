@@ -0,0 +1,128 @@
+#include "NormalMatrix.h"
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define NORMAL_MATRIX_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef NORMAL_MATRIX_USE_SSE2
+/**
+ * @brief 두 벡터의 외적을 계산합니다. (w 성분은 0이 됩니다)
+ */
+static __m128 Cross(const __m128 lhs_, const __m128 rhs_) noexcept
+{
+    const __m128 lhsYZX = _mm_shuffle_ps(lhs_, lhs_, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 lhsZXY = _mm_shuffle_ps(lhs_, lhs_, _MM_SHUFFLE(3, 1, 0, 2));
+    const __m128 rhsYZX = _mm_shuffle_ps(rhs_, rhs_, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 rhsZXY = _mm_shuffle_ps(rhs_, rhs_, _MM_SHUFFLE(3, 1, 0, 2));
+
+    return _mm_sub_ps(_mm_mul_ps(lhsYZX, rhsZXY), _mm_mul_ps(lhsZXY, rhsYZX));
+}
+
+/**
+ * @brief 두 벡터의 내적을 계산합니다.
+ */
+static float Dot(const __m128 lhs_, const __m128 rhs_) noexcept
+{
+    __m128 sum = _mm_mul_ps(lhs_, rhs_);
+    sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+
+    return _mm_cvtss_f32(sum);
+}
+#endif
+
+/**
+ * @brief 모델 행렬 하나의 법선 행렬을 계산하여 열 당 4개의 float로 기록합니다.
+ *
+ * 여인수 행렬은 (역행렬의 전치) * 행렬식이므로, 행렬식이 0인 납작한 모델도 방향이 올바른 법선을 얻도록
+ * 그 경우에는 나누지 않고 여인수 행렬을 그대로 사용합니다. (셰이더에서 법선을 정규화합니다)
+ */
+static void ComputeOne(const glm::mat4& model_, const bool isUniformScale_, float* const output_) noexcept
+{
+#ifdef NORMAL_MATRIX_USE_SSE2
+    const float* const model = glm::value_ptr(model_);
+    const __m128       mask  = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+    const __m128 column0 = _mm_and_ps(_mm_loadu_ps(model + 0), mask);
+    const __m128 column1 = _mm_and_ps(_mm_loadu_ps(model + 4), mask);
+    const __m128 column2 = _mm_and_ps(_mm_loadu_ps(model + 8), mask);
+
+    if (isUniformScale_)
+    {
+        // 균일 크기 s와 회전 R에 대해 (sR)^-T = R / s = (sR) / s^2 입니다.
+        const float  lengthSquared = Dot(column0, column0);
+        const __m128 scale         = _mm_set1_ps(lengthSquared != 0.0f ? 1.0f / lengthSquared : 1.0f);
+
+        _mm_storeu_ps(output_ + 0, _mm_mul_ps(column0, scale));
+        _mm_storeu_ps(output_ + 4, _mm_mul_ps(column1, scale));
+        _mm_storeu_ps(output_ + 8, _mm_mul_ps(column2, scale));
+        return;
+    }
+
+    const __m128 cofactor0 = Cross(column1, column2);
+    const __m128 cofactor1 = Cross(column2, column0);
+    const __m128 cofactor2 = Cross(column0, column1);
+
+    const float  determinant = Dot(column0, cofactor0);
+    const __m128 scale       = _mm_set1_ps(determinant != 0.0f ? 1.0f / determinant : 1.0f);
+
+    _mm_storeu_ps(output_ + 0, _mm_mul_ps(cofactor0, scale));
+    _mm_storeu_ps(output_ + 4, _mm_mul_ps(cofactor1, scale));
+    _mm_storeu_ps(output_ + 8, _mm_mul_ps(cofactor2, scale));
+#else
+    const glm::vec3 column0 = glm::vec3(model_[0]);
+    const glm::vec3 column1 = glm::vec3(model_[1]);
+    const glm::vec3 column2 = glm::vec3(model_[2]);
+
+    glm::vec3 columns[3];
+    float     scale = 1.0f;
+
+    if (isUniformScale_)
+    {
+        columns[0] = column0;
+        columns[1] = column1;
+        columns[2] = column2;
+
+        const float lengthSquared = glm::dot(column0, column0);
+        scale = lengthSquared != 0.0f ? 1.0f / lengthSquared : 1.0f;
+    }
+    else
+    {
+        columns[0] = glm::cross(column1, column2);
+        columns[1] = glm::cross(column2, column0);
+        columns[2] = glm::cross(column0, column1);
+
+        const float determinant = glm::dot(column0, columns[0]);
+        scale = determinant != 0.0f ? 1.0f / determinant : 1.0f;
+    }
+
+    for (int index = 0; index < 3; ++index)
+    {
+        output_[index * 4 + 0] = columns[index].x * scale;
+        output_[index * 4 + 1] = columns[index].y * scale;
+        output_[index * 4 + 2] = columns[index].z * scale;
+        output_[index * 4 + 3] = 0.0f;
+    }
+#endif
+}
+
+glm::mat3 NormalMatrix::Compute(const glm::mat4& model_, const bool isUniformScale_) noexcept
+{
+    glm::mat3x4 normal;
+    ComputeOne(model_, isUniformScale_, glm::value_ptr(normal));
+
+    return glm::mat3(normal);
+}
+
+void NormalMatrix::Compute(const std::span<const glm::mat4> models_,
+                           const std::span<glm::mat3x4>     normals_,
+                           const bool                       isUniformScale_) noexcept
+{
+    const std::size_t count = std::min(models_.size(), normals_.size());
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        ComputeOne(models_[index], isUniformScale_, glm::value_ptr(normals_[index]));
+    }
+}
@@ -1,12 +1,16 @@
 #include "Object.h"
 
 #include "Mesh.h"
+#include "NormalMatrix.h"
 #include "Shader.h"
 
 Object::Object(const Transform& transform_, Mesh* const mesh_) noexcept
 	: transform(transform_)
 	, mesh(mesh_)
+	, model(1.0f)
+	, normalMatrix(1.0f)
 {
+	UpdateMatrices();
 }
 
 void Object::OnUpdate(const float deltaTime_) noexcept
@@ -26,6 +30,13 @@ void Object::Update(const float deltaTime_) noexcept
 	OnUpdate(deltaTime_);
 }
 
+void Object::UpdateMatrices() noexcept
+{
+	// 법선 행렬은 정점마다 역행렬을 구하지 않도록 객체 당 한 번 CPU에서 계산합니다.
+	model        = transform.GetModel();
+	normalMatrix = NormalMatrix::Compute(model, transform.IsUniformScale());
+}
+
 void Object::Render() const noexcept
 {
 	if (!mesh)
@@ -33,7 +44,8 @@ void Object::Render() const noexcept
 		return;
 	}
 
-	Shader::SetUniformMatrix4x4("uModel", transform.GetModel());
+	Shader::SetUniformMatrix4x4("uModel", model);
+	Shader::SetUniformMatrix3x3("uNormalMatrix", normalMatrix);
 	mesh->Render(GL_TRIANGLES);
 
 	OnRender();
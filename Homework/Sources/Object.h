@@ -35,6 +35,13 @@ class Object
      */
     void Update(const float deltaTime_) noexcept;
 
+    /**
+     * @brief 현재 트랜스폼으로 모델 행렬과 법선 행렬을 다시 계산합니다.
+     *
+     * 위치 보정까지 끝난 뒤 프레임 당 한 번 호출하며, Render는 여기서 계산한 행렬을 그대로 사용합니다.
+     */
+    void UpdateMatrices() noexcept;
+
     /**
      * @brief 해당 객체를 그립니다.
      */
@@ -135,6 +142,16 @@ class Object
      * @brief 해당 오브젝트의 메쉬.
      */
     Mesh* mesh;
+
+    /**
+     * @brief 마지막으로 계산한 모델 행렬.
+     */
+    glm::mat4 model;
+
+    /**
+     * @brief 마지막으로 계산한 법선 행렬.
+     */
+    glm::mat3 normalMatrix;
 };
 
 inline constexpr glm::vec3 Object::GetPosition() const noexcept
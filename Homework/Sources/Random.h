@@ -8,6 +8,16 @@
 class Random final
 {
 public:
+	/**
+	 * @brief 난수 생성기의 시드를 다시 정합니다. 같은 시드 이후에는 같은 난수열이 나옵니다.
+	 * 
+	 * @param seed_ 시드
+	 */
+	static inline void Seed(const std::uint32_t seed_) noexcept
+	{
+		gen.seed(seed_);
+	}
+
 	/**
 	 * @brief 정수형 난수를 반환합니다.
 	 * 
@@ -2,18 +2,124 @@
 
 #include "Resources.h"
 
+/**
+ * @brief 프로그램 바이너리 캐시 파일의 헤더. 헤더 뒤에는 glGetProgramBinary가 반환한 바이너리가 이어집니다.
+ */
+struct ProgramCacheHeader final
+{
+    char          magic[4];
+    std::uint32_t version;
+    std::uint32_t format;
+    std::uint32_t size;
+};
+
+static constexpr char          PROGRAM_CACHE_MAGIC[4] = { 'P', 'R', 'G', 'B' };
+static constexpr std::uint32_t PROGRAM_CACHE_VERSION  = 1;
+
+static constexpr const char* VERTEX_SHADER_PATH   = "Resources/Shaders/Vertex.vert";
+static constexpr const char* FRAGMENT_SHADER_PATH = "Resources/Shaders/Fragment.frag";
+static constexpr const char* SHADER_CACHE_PATH    = "Cache/Shaders";
+
 bool Shader::Initialize() noexcept
 {
-	GLuint vertexShader   = CompileShader(GL_VERTEX_SHADER,   "Resources/Shaders/Vertex.vert");
-	GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, "Resources/Shaders/Fragment.frag");
+    using Clock = std::chrono::steady_clock;
 
-    programID = glCreateProgram();
-    glAttachShader(programID, vertexShader);
-    glAttachShader(programID, fragmentShader);
-    glLinkProgram(programID);
+    const auto toMilliseconds = [] (const Clock::duration duration_) -> double
+    {
+        return std::chrono::duration<double, std::milli>(duration_).count();
+    };
+
+    const Clock::time_point start = Clock::now();
+
+    const std::string& vertexSource   = Resources::GetShader(VERTEX_SHADER_PATH);
+    const std::string& fragmentSource = Resources::GetShader(FRAGMENT_SHADER_PATH);
+    if (vertexSource.empty() || fragmentSource.empty())
+    {
+        return false;
+    }
 
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    const bool isBinarySupported = formatCount > 0;
+
+    // 캐시 키는 소스와 드라이버 문자열의 해시입니다. 드라이버가 바뀌면 새로 컴파일합니다.
+    const auto getString = [] (const GLenum name_) -> std::string_view
+    {
+        const GLubyte* const value = glGetString(name_);
+        return value != nullptr ? reinterpret_cast<const char*>(value) : "";
+    };
+
+    std::string key = std::format("{}|{}|{}", getString(GL_VENDOR), getString(GL_RENDERER), getString(GL_VERSION));
+    key += '\0';
+    key += vertexSource;
+    key += '\0';
+    key += fragmentSource;
+
+    std::error_code error;
+    std::filesystem::create_directories(SHADER_CACHE_PATH, error);
+
+    const std::filesystem::path cachePath = std::filesystem::path(SHADER_CACHE_PATH) / std::format("{:016x}.bin", std::hash<std::string>{}(key));
+
+    programID = isBinarySupported ? LoadBinary(cachePath) : 0;
+
+    const bool isCached = programID != 0;
+    if (!isCached)
+    {
+        // 지원한다면 두 셰이더가 드라이버 스레드에서 동시에 컴파일되도록 컴파일러 스레드 수 제한을 풉니다.
+        if (glfwExtensionSupported("GL_KHR_parallel_shader_compile"))
+        {
+            using MaxShaderCompilerThreads = void (APIENTRY*)(GLuint);
+
+            const auto maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreads>(glfwGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+            if (maxShaderCompilerThreads != nullptr)
+            {
+                maxShaderCompilerThreads(std::numeric_limits<GLuint>::max());
+            }
+        }
+
+        const GLuint vertexShader   = CompileShader(GL_VERTEX_SHADER,   vertexSource);
+        const GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, fragmentSource);
+
+        programID = glCreateProgram();
+        glAttachShader(programID, vertexShader);
+        glAttachShader(programID, fragmentShader);
+        if (isBinarySupported)
+        {
+            glProgramParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        glLinkProgram(programID);
+
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(programID, GL_LINK_STATUS, &linkStatus);
+        if (linkStatus != GL_TRUE)
+        {
+            const bool isVertexCompiled   = CheckShader(vertexShader,   VERTEX_SHADER_PATH);
+            const bool isFragmentCompiled = CheckShader(fragmentShader, FRAGMENT_SHADER_PATH);
+            if (isVertexCompiled && isFragmentCompiled)
+            {
+                char infoLog[512];
+                glGetProgramInfoLog(programID, 512, nullptr, infoLog);
+                spdlog::error("Shader link failed: {}", infoLog);
+            }
+
+            glDeleteShader(vertexShader);
+            glDeleteShader(fragmentShader);
+            glDeleteProgram(programID);
+            programID = 0;
+
+            return false;
+        }
+
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+
+        if (isBinarySupported)
+        {
+            SaveBinary(cachePath);
+        }
+    }
+
+    spdlog::info("Shader initialize: {} in {:.2f} ms", isCached ? "cached" : "compiled", toMilliseconds(Clock::now() - start));
 
     glUseProgram(programID);
     isUsing = true;
@@ -29,11 +135,10 @@ void Shader::Release() noexcept
     }
 }
 
-GLuint Shader::CompileShader(GLenum           type_,
-							 std::string_view path_) noexcept
+GLuint Shader::CompileShader(GLenum             type_,
+							 const std::string& source_) noexcept
 {
-    const std::string code = Resources::GetShader(path_);
-    const GLchar* src      = code.c_str();
+    const GLchar* src = source_.c_str();
 
     GLuint shader = glCreateShader(type_);
     glShaderSource(shader, 1, &src, nullptr);
@@ -42,6 +147,100 @@ GLuint Shader::CompileShader(GLenum           type_,
     return shader;
 }
 
+bool Shader::CheckShader(GLuint           shader_,
+                         std::string_view path_) noexcept
+{
+    GLint compileStatus = GL_FALSE;
+    glGetShaderiv(shader_, GL_COMPILE_STATUS, &compileStatus);
+    if (compileStatus == GL_TRUE)
+    {
+        return true;
+    }
+
+    char infoLog[512];
+    glGetShaderInfoLog(shader_, 512, nullptr, infoLog);
+    spdlog::error("Shader compile failed ({}): {}", path_, infoLog);
+
+    return false;
+}
+
+GLuint Shader::LoadBinary(const std::filesystem::path& cachePath_) noexcept
+{
+    std::ifstream ifs(cachePath_, std::ios::binary);
+    if (!ifs.is_open())
+    {
+        return 0;
+    }
+
+    ProgramCacheHeader header;
+    if (!ifs.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, PROGRAM_CACHE_MAGIC, sizeof(PROGRAM_CACHE_MAGIC)) != 0 ||
+        header.version != PROGRAM_CACHE_VERSION)
+    {
+        return 0;
+    }
+
+    std::vector<char> binary(header.size);
+    if (!ifs.read(binary.data(), static_cast<std::streamsize>(binary.size())))
+    {
+        return 0;
+    }
+
+    // 드라이버가 바이너리를 거부할 수도 있으므로 링크 상태를 확인합니다.
+    const GLuint program = glCreateProgram();
+    glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    if (linkStatus != GL_TRUE)
+    {
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    return program;
+}
+
+void Shader::SaveBinary(const std::filesystem::path& cachePath_) noexcept
+{
+    GLint length = 0;
+    glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        return;
+    }
+
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum            format = 0;
+    glGetProgramBinary(programID, length, nullptr, &format, binary.data());
+
+    ProgramCacheHeader header = { };
+    std::memcpy(header.magic, PROGRAM_CACHE_MAGIC, sizeof(PROGRAM_CACHE_MAGIC));
+    header.version = PROGRAM_CACHE_VERSION;
+    header.format  = format;
+    header.size    = static_cast<std::uint32_t>(binary.size());
+
+    std::filesystem::path temporaryPath = cachePath_;
+    temporaryPath += ".tmp";
+
+    std::ofstream ofs(temporaryPath, std::ios::binary | std::ios::trunc);
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofs.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+    ofs.close();
+
+    std::error_code error;
+    if (ofs)
+    {
+        std::filesystem::rename(temporaryPath, cachePath_, error);
+    }
+
+    if (!ofs || error)
+    {
+        spdlog::warn("Shader cache write failed: {}", cachePath_.string());
+        std::filesystem::remove(temporaryPath, error);
+    }
+}
+
 bool Shader::isUsing = false;
 
 GLuint Shader::programID = 0;
\ No newline at end of file
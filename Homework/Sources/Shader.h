@@ -82,6 +82,15 @@ class Shader final
     static inline void SetUniformMatrix4x4(const char* const name_,
                                            const glm::mat4& value_) noexcept;
 
+    /**
+     * @brief 3x3 행렬 유니폼 변수를 설정합니다.
+     *
+     * @param name_  유니폼 변수 이름.
+     * @param value_ 설정할 값.
+     */
+    static inline void SetUniformMatrix3x3(const char* const name_,
+                                           const glm::mat3& value_) noexcept;
+
 private:
 #pragma region Deleted Functions
     Shader() = delete;
@@ -100,7 +109,7 @@ class Shader final
 #pragma endregion
 
 	/**
-	 * @brief 셰이더를 컴파일합니다.
+	 * @brief 셰이더를 생성하고 컴파일을 요청합니다. (결과는 링크 후에 확인합니다)
      * 
 	 * @param type_   컴파일 타입
 	 * @param source_ 컴파일할 세이더 소스
@@ -108,8 +117,36 @@ class Shader final
 	 * @return GLuint 셰이더
 	 */
 	[[nodiscard]]
-    static GLuint CompileShader(GLenum           type_,
-		                        std::string_view source_) noexcept;
+    static GLuint CompileShader(GLenum             type_,
+		                        const std::string& source_) noexcept;
+
+    /**
+     * @brief 셰이더의 컴파일 결과를 확인하고 실패 시 로그를 출력합니다.
+     *
+     * @param shader_ 셰이더
+     * @param path_   셰이더 파일 경로
+     *
+     * @return bool 컴파일에 성공했다면 true.
+     */
+    static bool CheckShader(GLuint           shader_,
+                            std::string_view path_) noexcept;
+
+    /**
+     * @brief 캐시 파일에서 프로그램 바이너리를 불러옵니다.
+     *
+     * @param cachePath_ 캐시 파일 경로
+     *
+     * @return GLuint 프로그램 ID. 캐시가 없거나 드라이버가 거부하면 0.
+     */
+    [[nodiscard]]
+    static GLuint LoadBinary(const std::filesystem::path& cachePath_) noexcept;
+
+    /**
+     * @brief 링크된 프로그램의 바이너리를 캐시 파일에 기록합니다.
+     *
+     * @param cachePath_ 캐시 파일 경로
+     */
+    static void SaveBinary(const std::filesystem::path& cachePath_) noexcept;
 
     /**
      * @brief 셰이더가 사용 중인지 여부.
@@ -161,4 +198,10 @@ inline void Shader::SetUniformMatrix4x4(const char* name_, const glm::mat4& valu
 {
     const GLint location = glGetUniformLocation(programID, name_);
     glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value_));
+}
+
+inline void Shader::SetUniformMatrix3x3(const char* name_, const glm::mat3& value_) noexcept
+{
+    const GLint location = glGetUniformLocation(programID, name_);
+    glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value_));
 }
\ No newline at end of file
@@ -53,6 +53,14 @@ struct Transform final
 	 */
 	[[nodiscard]]
 	inline glm::mat4 GetModel() const noexcept;
+
+	/**
+	 * @brief 해당 트랜스폼과 모든 부모의 크기가 축마다 같은지 확인합니다.
+	 * 
+	 * @return bool 크기가 균일하다면 true
+	 */
+	[[nodiscard]]
+	inline bool IsUniformScale() const noexcept;
 };
 
 inline glm::mat4 Transform::GetModel() const noexcept
@@ -70,4 +78,14 @@ inline glm::mat4 Transform::GetModel() const noexcept
 	}
 
 	return model;
+}
+
+inline bool Transform::IsUniformScale() const noexcept
+{
+	if (scale.x != scale.y || scale.y != scale.z)
+	{
+		return false;
+	}
+
+	return parent == nullptr || parent->IsUniformScale();
 }
\ No newline at end of file
@@ -0,0 +1,759 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ThreadPool.h"
+
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define MATRIX_USE_AVX2
+#include <immintrin.h>
+#endif
+
+// 행 우선(row-major)으로 저장된 행렬에 대한 연산들. 정적 크기/동적 크기 행렬이 함께 사용합니다.
+namespace MatrixKernel
+{
+    // 곱셈 블록 크기. 오른쪽 행렬의 BLOCK_K x BLOCK_N 블록(float 기준 128KB)이 L2에 머무는 동안 왼쪽 행렬의 모든 행을 지나갑니다.
+    constexpr std::size_t BLOCK_K = 128;
+    constexpr std::size_t BLOCK_N = 256;
+
+    // 전치 블록 크기. 두 블록이 함께 L1에 들어갑니다.
+    constexpr std::size_t BLOCK_TRANSPOSE = 32;
+
+    // 스레드 하나가 맡는 곱셈 타일의 행 수. AVX2 커널의 4행 단위로 나누어떨어집니다.
+    constexpr std::size_t TILE_ROWS = 64;
+
+    // 스레드 하나가 맡는 덧셈/뺄셈 타일의 원소 수.
+    constexpr std::size_t TILE_ELEMENTS = 1 << 16;
+
+    // 이보다 작은 연산은 작업을 나누는 비용이 더 크므로 호출한 스레드에서 바로 계산합니다.
+    constexpr std::size_t PARALLEL_MULTIPLY_THRESHOLD = 128 * 128 * 128;
+    constexpr std::size_t PARALLEL_ELEMENTS_THRESHOLD = 256 * 256;
+
+    // 이 크기 이상의 정사각 행렬 곱셈은 Strassen 알고리즘으로, 한 변이 STRASSEN_LEAF 이하가 되면 블록 곱셈으로 계산합니다.
+    constexpr std::size_t STRASSEN_THRESHOLD = 2048;
+    constexpr std::size_t STRASSEN_LEAF      = 1024;
+
+    // [0, count_)를 스레드 풀에 나누어 실행합니다. 작업량이 threshold_보다 작다면 호출한 스레드에서 차례대로 실행합니다.
+    template <typename Function>
+    void Dispatch(const std::size_t count_,
+                  const std::size_t work_,
+                  const std::size_t threshold_,
+                  Function&&        function_) noexcept
+    {
+        if (work_ < threshold_)
+        {
+            for (std::size_t index = 0; index < count_; ++index)
+            {
+                function_(index);
+            }
+
+            return;
+        }
+
+        ThreadPool::Instance().ParallelFor(count_, function_);
+    }
+
+    // res_[rowBegin_, rowEnd_) x [colBegin_, colEnd_) += lhs_[.., k] * rhs_[k, ..] (k는 [kBegin_, kEnd_))
+    // 가장 안쪽 루프가 연속된 메모리를 지나므로 컴파일러가 벡터화합니다.
+    template <typename T>
+    void MultiplyAccumulate(const T* const    lhs_,
+                            const T* const    rhs_,
+                            T* const          res_,
+                            const std::size_t inner_,
+                            const std::size_t cols_,
+                            const std::size_t rowBegin_,
+                            const std::size_t rowEnd_,
+                            const std::size_t colBegin_,
+                            const std::size_t colEnd_,
+                            const std::size_t kBegin_,
+                            const std::size_t kEnd_) noexcept
+    {
+        for (std::size_t row = rowBegin_; row < rowEnd_; ++row)
+        {
+            T* const resRow = res_ + row * cols_;
+
+            for (std::size_t k = kBegin_; k < kEnd_; ++k)
+            {
+                const T        value  = lhs_[row * inner_ + k];
+                const T* const rhsRow = rhs_ + k * cols_;
+
+                for (std::size_t col = colBegin_; col < colEnd_; ++col)
+                {
+                    resRow[col] += value * rhsRow[col];
+                }
+            }
+        }
+    }
+
+#ifdef MATRIX_USE_AVX2
+    // 4행 x 16열 결과를 레지스터 8개에 모아 두고 k 방향으로 누적합니다. 나머지 행/열은 MultiplyAccumulate가 처리합니다.
+    inline void MultiplyAccumulateAVX2(const float* const lhs_,
+                                       const float* const rhs_,
+                                       float* const       res_,
+                                       const std::size_t  inner_,
+                                       const std::size_t  cols_,
+                                       const std::size_t  rowBegin_,
+                                       const std::size_t  rowEnd_,
+                                       const std::size_t  colBegin_,
+                                       const std::size_t  colEnd_,
+                                       const std::size_t  kBegin_,
+                                       const std::size_t  kEnd_) noexcept
+    {
+        const std::size_t rowTileEnd = rowBegin_ + (rowEnd_ - rowBegin_) / 4 * 4;
+        const std::size_t colTileEnd = colBegin_ + (colEnd_ - colBegin_) / 16 * 16;
+
+        for (std::size_t row = rowBegin_; row < rowTileEnd; row += 4)
+        {
+            for (std::size_t col = colBegin_; col < colTileEnd; col += 16)
+            {
+                float* const c0 = res_ + (row + 0) * cols_ + col;
+                float* const c1 = res_ + (row + 1) * cols_ + col;
+                float* const c2 = res_ + (row + 2) * cols_ + col;
+                float* const c3 = res_ + (row + 3) * cols_ + col;
+
+                __m256 acc00 = _mm256_loadu_ps(c0), acc01 = _mm256_loadu_ps(c0 + 8);
+                __m256 acc10 = _mm256_loadu_ps(c1), acc11 = _mm256_loadu_ps(c1 + 8);
+                __m256 acc20 = _mm256_loadu_ps(c2), acc21 = _mm256_loadu_ps(c2 + 8);
+                __m256 acc30 = _mm256_loadu_ps(c3), acc31 = _mm256_loadu_ps(c3 + 8);
+
+                const float* a = lhs_ + row * inner_;
+
+                for (std::size_t k = kBegin_; k < kEnd_; ++k)
+                {
+                    const __m256 b0 = _mm256_loadu_ps(rhs_ + k * cols_ + col);
+                    const __m256 b1 = _mm256_loadu_ps(rhs_ + k * cols_ + col + 8);
+
+                    __m256 a0 = _mm256_broadcast_ss(a + k);
+                    acc00 = _mm256_fmadd_ps(a0, b0, acc00);
+                    acc01 = _mm256_fmadd_ps(a0, b1, acc01);
+
+                    a0    = _mm256_broadcast_ss(a + inner_ + k);
+                    acc10 = _mm256_fmadd_ps(a0, b0, acc10);
+                    acc11 = _mm256_fmadd_ps(a0, b1, acc11);
+
+                    a0    = _mm256_broadcast_ss(a + inner_ * 2 + k);
+                    acc20 = _mm256_fmadd_ps(a0, b0, acc20);
+                    acc21 = _mm256_fmadd_ps(a0, b1, acc21);
+
+                    a0    = _mm256_broadcast_ss(a + inner_ * 3 + k);
+                    acc30 = _mm256_fmadd_ps(a0, b0, acc30);
+                    acc31 = _mm256_fmadd_ps(a0, b1, acc31);
+                }
+
+                _mm256_storeu_ps(c0, acc00); _mm256_storeu_ps(c0 + 8, acc01);
+                _mm256_storeu_ps(c1, acc10); _mm256_storeu_ps(c1 + 8, acc11);
+                _mm256_storeu_ps(c2, acc20); _mm256_storeu_ps(c2 + 8, acc21);
+                _mm256_storeu_ps(c3, acc30); _mm256_storeu_ps(c3 + 8, acc31);
+            }
+        }
+
+        MultiplyAccumulate(lhs_, rhs_, res_, inner_, cols_, rowBegin_,  rowTileEnd, colTileEnd, colEnd_, kBegin_, kEnd_);
+        MultiplyAccumulate(lhs_, rhs_, res_, inner_, cols_, rowTileEnd, rowEnd_,    colBegin_,  colEnd_, kBegin_, kEnd_);
+    }
+#endif
+
+    // res_(rows_ x cols_) = lhs_(rows_ x inner_) * rhs_(inner_ x cols_)
+    // 결과를 TILE_ROWS x BLOCK_N 타일로 나누어 스레드마다 서로 다른 타일을 채우므로 동기화가 필요 없습니다.
+    template <typename T>
+    void Multiply(const T* const    lhs_,
+                  const T* const    rhs_,
+                  T* const          res_,
+                  const std::size_t rows_,
+                  const std::size_t inner_,
+                  const std::size_t cols_) noexcept
+    {
+        std::fill(res_, res_ + rows_ * cols_, T{});
+
+        const std::size_t rowTiles = (rows_ + TILE_ROWS - 1) / TILE_ROWS;
+        const std::size_t colTiles = (cols_ + BLOCK_N - 1) / BLOCK_N;
+
+        Dispatch(rowTiles * colTiles, rows_ * inner_ * cols_, PARALLEL_MULTIPLY_THRESHOLD, [&](const std::size_t tile_)
+        {
+            const std::size_t rowBegin = tile_ % rowTiles * TILE_ROWS;
+            const std::size_t rowEnd   = std::min(rowBegin + TILE_ROWS, rows_);
+            const std::size_t colBegin = tile_ / rowTiles * BLOCK_N;
+            const std::size_t colEnd   = std::min(colBegin + BLOCK_N, cols_);
+
+            for (std::size_t kBlock = 0; kBlock < inner_; kBlock += BLOCK_K)
+            {
+                const std::size_t kEnd = std::min(kBlock + BLOCK_K, inner_);
+
+#ifdef MATRIX_USE_AVX2
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    MultiplyAccumulateAVX2(lhs_, rhs_, res_, inner_, cols_, rowBegin, rowEnd, colBegin, colEnd, kBlock, kEnd);
+                    continue;
+                }
+#endif
+                MultiplyAccumulate(lhs_, rhs_, res_, inner_, cols_, rowBegin, rowEnd, colBegin, colEnd, kBlock, kEnd);
+            }
+        });
+    }
+
+    // res_[i] = operation_(lhs_[i], rhs_[i])
+    template <typename T, typename Operation>
+    void Transform(const T* const    lhs_,
+                   const T* const    rhs_,
+                   T* const          res_,
+                   const std::size_t count_,
+                   Operation         operation_) noexcept
+    {
+        Dispatch((count_ + TILE_ELEMENTS - 1) / TILE_ELEMENTS, count_, PARALLEL_ELEMENTS_THRESHOLD, [&](const std::size_t tile_)
+        {
+            const std::size_t begin = tile_ * TILE_ELEMENTS;
+            const std::size_t end   = std::min(begin + TILE_ELEMENTS, count_);
+
+            std::transform(lhs_ + begin, lhs_ + end, rhs_ + begin, res_ + begin, operation_);
+        });
+    }
+
+    template <typename T>
+    void Add(const T* const lhs_, const T* const rhs_, T* const res_, const std::size_t count_) noexcept
+    {
+        Transform(lhs_, rhs_, res_, count_, std::plus<T>());
+    }
+
+    template <typename T>
+    void Subtract(const T* const lhs_, const T* const rhs_, T* const res_, const std::size_t count_) noexcept
+    {
+        Transform(lhs_, rhs_, res_, count_, std::minus<T>());
+    }
+
+    // res_(size_ x size_) = lhs_ * rhs_ (Strassen)
+    // 곱셈 7번과 덧셈 18번으로 한 단계를 나눕니다. 7개의 곱은 서로 독립이므로 스레드 풀에 나누어 계산하고,
+    // 각 곱 안의 블록 곱셈도 다시 타일로 나뉩니다. 한 변이 홀수이거나 STRASSEN_LEAF 이하라면 블록 곱셈으로 계산합니다.
+    template <typename T>
+    void MultiplyStrassen(const T* const    lhs_,
+                          const T* const    rhs_,
+                          T* const          res_,
+                          const std::size_t size_) noexcept
+    {
+        if (size_ <= STRASSEN_LEAF || size_ % 2 != 0)
+        {
+            Multiply(lhs_, rhs_, res_, size_, size_, size_);
+            return;
+        }
+
+        const std::size_t half = size_ / 2;
+        const std::size_t area = half * half;
+
+        // 사분면 (row_, col_)의 시작 위치. 행 사이의 간격은 size_입니다.
+        const auto quadrant = [size_, half](const T* const mat_, const std::size_t row_, const std::size_t col_)
+        {
+            return mat_ + row_ * half * size_ + col_ * half;
+        };
+
+        // dst_ = a_ + sign_ * b_. b_가 없다면 a_를 복사합니다.
+        const auto combine = [half, size_](const T* const a_, const T* const b_, const int sign_, T* const dst_)
+        {
+            for (std::size_t row = 0; row < half; ++row)
+            {
+                const T* const a   = a_ + row * size_;
+                T* const       dst = dst_ + row * half;
+
+                if (b_ == nullptr)
+                {
+                    std::copy(a, a + half, dst);
+                    continue;
+                }
+
+                const T* const b = b_ + row * size_;
+                for (std::size_t col = 0; col < half; ++col)
+                {
+                    dst[col] = sign_ > 0 ? a[col] + b[col] : a[col] - b[col];
+                }
+            }
+        };
+
+        const T* const a11 = quadrant(lhs_, 0, 0);
+        const T* const a12 = quadrant(lhs_, 0, 1);
+        const T* const a21 = quadrant(lhs_, 1, 0);
+        const T* const a22 = quadrant(lhs_, 1, 1);
+        const T* const b11 = quadrant(rhs_, 0, 0);
+        const T* const b12 = quadrant(rhs_, 0, 1);
+        const T* const b21 = quadrant(rhs_, 1, 0);
+        const T* const b22 = quadrant(rhs_, 1, 1);
+
+        struct Operand final
+        {
+            const T* a;
+            const T* b;
+            int      sign;
+        };
+
+        // M1 = (A11 + A22)(B11 + B22), M2 = (A21 + A22)B11, M3 = A11(B12 - B22), M4 = A22(B21 - B11),
+        // M5 = (A11 + A12)B22,         M6 = (A21 - A11)(B11 + B12), M7 = (A12 - A22)(B21 + B22)
+        const std::array<std::pair<Operand, Operand>, 7> products = {{
+            { { a11, a22,     1 }, { b11, b22,      1 } },
+            { { a21, a22,     1 }, { b11, nullptr,  1 } },
+            { { a11, nullptr, 1 }, { b12, b22,     -1 } },
+            { { a22, nullptr, 1 }, { b21, b11,     -1 } },
+            { { a11, a12,     1 }, { b22, nullptr,  1 } },
+            { { a21, a11,    -1 }, { b11, b12,      1 } },
+            { { a12, a22,    -1 }, { b21, b22,      1 } },
+        }};
+
+        std::vector<T> m(area * products.size());
+
+        ThreadPool::Instance().ParallelFor(products.size(), [&](const std::size_t index_)
+        {
+            const auto& [left, right] = products[index_];
+
+            std::vector<T> operands(area * 2);
+            combine(left.a,  left.b,  left.sign,  operands.data());
+            combine(right.a, right.b, right.sign, operands.data() + area);
+
+            MultiplyStrassen(operands.data(), operands.data() + area, m.data() + area * index_, half);
+        });
+
+        const T* const m1 = m.data();
+        const T* const m2 = m1 + area;
+        const T* const m3 = m2 + area;
+        const T* const m4 = m3 + area;
+        const T* const m5 = m4 + area;
+        const T* const m6 = m5 + area;
+        const T* const m7 = m6 + area;
+
+        // C11 = M1 + M4 - M5 + M7, C12 = M3 + M5, C21 = M2 + M4, C22 = M1 - M2 + M3 + M6
+        Dispatch(half, size_ * size_, PARALLEL_ELEMENTS_THRESHOLD, [&](const std::size_t row_)
+        {
+            T* const c11 = res_ + row_ * size_;
+            T* const c12 = c11 + half;
+            T* const c21 = res_ + (row_ + half) * size_;
+            T* const c22 = c21 + half;
+
+            for (std::size_t col = 0, index = row_ * half; col < half; ++col, ++index)
+            {
+                c11[col] = m1[index] + m4[index] - m5[index] + m7[index];
+                c12[col] = m3[index] + m5[index];
+                c21[col] = m2[index] + m4[index];
+                c22[col] = m1[index] - m2[index] + m3[index] + m6[index];
+            }
+        });
+    }
+
+    // 정수는 Bareiss 알고리즘(분수 없는 LU 분해)으로 정확하게, 실수는 부분 피벗 LU 분해로 O(n^3)에 계산합니다.
+    template <typename T>
+    [[nodiscard]]
+    T Determinant(const T* const mat_, const std::size_t size_) noexcept
+    {
+        if (size_ == 0)
+        {
+            return T{ 1 };
+        }
+
+        if constexpr (std::is_integral_v<T>)
+        {
+            std::vector<long long> work(mat_, mat_ + size_ * size_);
+            long long              sign     = 1;
+            long long              previous = 1;
+
+            for (std::size_t k = 0; k + 1 < size_; ++k)
+            {
+                if (work[k * size_ + k] == 0)
+                {
+                    std::size_t pivot = k + 1;
+                    while (pivot < size_ && work[pivot * size_ + k] == 0)
+                    {
+                        ++pivot;
+                    }
+
+                    if (pivot == size_)
+                    {
+                        return T{ 0 };
+                    }
+
+                    std::swap_ranges(work.begin() + k * size_, work.begin() + (k + 1) * size_, work.begin() + pivot * size_);
+                    sign = -sign;
+                }
+
+                const long long diagonal = work[k * size_ + k];
+                for (std::size_t row = k + 1; row < size_; ++row)
+                {
+                    const long long factor = work[row * size_ + k];
+                    for (std::size_t col = k + 1; col < size_; ++col)
+                    {
+                        // Bareiss: 이전 피벗으로 항상 나누어떨어집니다.
+                        work[row * size_ + col] = (work[row * size_ + col] * diagonal - factor * work[k * size_ + col]) / previous;
+                    }
+                }
+
+                previous = diagonal;
+            }
+
+            return static_cast<T>(sign * work[size_ * size_ - 1]);
+        }
+        else
+        {
+            std::vector<T> work(mat_, mat_ + size_ * size_);
+            T              determinant = T{ 1 };
+
+            for (std::size_t k = 0; k < size_; ++k)
+            {
+                std::size_t pivot = k;
+                for (std::size_t row = k + 1; row < size_; ++row)
+                {
+                    if (std::abs(work[row * size_ + k]) > std::abs(work[pivot * size_ + k]))
+                    {
+                        pivot = row;
+                    }
+                }
+
+                if (work[pivot * size_ + k] == T{ 0 })
+                {
+                    return T{ 0 };
+                }
+
+                if (pivot != k)
+                {
+                    std::swap_ranges(work.begin() + k * size_, work.begin() + (k + 1) * size_, work.begin() + pivot * size_);
+                    determinant = -determinant;
+                }
+
+                const T diagonal = work[k * size_ + k];
+                determinant *= diagonal;
+
+                for (std::size_t row = k + 1; row < size_; ++row)
+                {
+                    const T factor = work[row * size_ + k] / diagonal;
+                    for (std::size_t col = k + 1; col < size_; ++col)
+                    {
+                        work[row * size_ + col] -= factor * work[k * size_ + col];
+                    }
+                }
+            }
+
+            return determinant;
+        }
+    }
+
+    // dst_(cols_ x rows_) = src_(rows_ x cols_)^T
+    // 행 블록마다 dst_의 서로 다른 열을 채우므로 행 블록 단위로 나누어 실행합니다.
+    template <typename T>
+    void Transpose(const T* const    src_,
+                   T* const          dst_,
+                   const std::size_t rows_,
+                   const std::size_t cols_) noexcept
+    {
+        const std::size_t rowBlocks = (rows_ + BLOCK_TRANSPOSE - 1) / BLOCK_TRANSPOSE;
+
+        Dispatch(rowBlocks, rows_ * cols_, PARALLEL_ELEMENTS_THRESHOLD, [&](const std::size_t block_)
+        {
+            const std::size_t rowBlock = block_ * BLOCK_TRANSPOSE;
+            const std::size_t rowEnd   = std::min(rowBlock + BLOCK_TRANSPOSE, rows_);
+
+            for (std::size_t colBlock = 0; colBlock < cols_; colBlock += BLOCK_TRANSPOSE)
+            {
+                const std::size_t colEnd = std::min(colBlock + BLOCK_TRANSPOSE, cols_);
+
+                for (std::size_t row = rowBlock; row < rowEnd; ++row)
+                {
+                    for (std::size_t col = colBlock; col < colEnd; ++col)
+                    {
+                        dst_[col * rows_ + row] = src_[row * cols_ + col];
+                    }
+                }
+            }
+        });
+    }
+
+    // 정사각 행렬을 제자리에서 전치합니다. 대각 블록은 자기 안에서, 나머지 블록은 대칭 블록과 맞바꿉니다.
+    // 행 블록 i는 블록 (i, j)와 (j, i) (j >= i)만 건드리므로, 행 블록마다 나누어 실행해도 겹치지 않습니다.
+    template <typename T>
+    void TransposeInPlace(T* const mat_, const std::size_t size_) noexcept
+    {
+        const std::size_t rowBlocks = (size_ + BLOCK_TRANSPOSE - 1) / BLOCK_TRANSPOSE;
+
+        Dispatch(rowBlocks, size_ * size_, PARALLEL_ELEMENTS_THRESHOLD, [&](const std::size_t block_)
+        {
+            const std::size_t rowBlock = block_ * BLOCK_TRANSPOSE;
+            const std::size_t rowEnd   = std::min(rowBlock + BLOCK_TRANSPOSE, size_);
+
+            for (std::size_t row = rowBlock; row < rowEnd; ++row)
+            {
+                for (std::size_t col = row + 1; col < rowEnd; ++col)
+                {
+                    std::swap(mat_[row * size_ + col], mat_[col * size_ + row]);
+                }
+            }
+
+            for (std::size_t colBlock = rowEnd; colBlock < size_; colBlock += BLOCK_TRANSPOSE)
+            {
+                const std::size_t colEnd = std::min(colBlock + BLOCK_TRANSPOSE, size_);
+
+                for (std::size_t row = rowBlock; row < rowEnd; ++row)
+                {
+                    for (std::size_t col = colBlock; col < colEnd; ++col)
+                    {
+                        std::swap(mat_[row * size_ + col], mat_[col * size_ + row]);
+                    }
+                }
+            }
+        });
+    }
+}
+
+// 크기가 컴파일 시간에 정해지는 밀집 행렬.
+template <typename T, std::size_t Rows, std::size_t Cols>
+class Matrix final
+{
+public:
+    [[nodiscard]]
+    static constexpr std::size_t GetRows() noexcept
+    {
+        return Rows;
+    }
+
+    [[nodiscard]]
+    static constexpr std::size_t GetCols() noexcept
+    {
+        return Cols;
+    }
+
+    [[nodiscard]]
+    constexpr T& operator()(const std::size_t row_, const std::size_t col_) noexcept
+    {
+        return elements[row_ * Cols + col_];
+    }
+
+    [[nodiscard]]
+    constexpr const T& operator()(const std::size_t row_, const std::size_t col_) const noexcept
+    {
+        return elements[row_ * Cols + col_];
+    }
+
+    [[nodiscard]]
+    constexpr T* Data() noexcept
+    {
+        return elements.data();
+    }
+
+    [[nodiscard]]
+    constexpr const T* Data() const noexcept
+    {
+        return elements.data();
+    }
+
+    [[nodiscard]]
+    constexpr Matrix operator+(const Matrix& other_) const noexcept
+    {
+        Matrix res;
+        if (std::is_constant_evaluated())
+        {
+            std::transform(elements.begin(), elements.end(), other_.elements.begin(), res.elements.begin(), std::plus<T>());
+            return res;
+        }
+
+        MatrixKernel::Add(Data(), other_.Data(), res.Data(), Rows * Cols);
+        return res;
+    }
+
+    [[nodiscard]]
+    constexpr Matrix operator-(const Matrix& other_) const noexcept
+    {
+        Matrix res;
+        if (std::is_constant_evaluated())
+        {
+            std::transform(elements.begin(), elements.end(), other_.elements.begin(), res.elements.begin(), std::minus<T>());
+            return res;
+        }
+
+        MatrixKernel::Subtract(Data(), other_.Data(), res.Data(), Rows * Cols);
+        return res;
+    }
+
+    [[nodiscard]]
+    constexpr Matrix operator+(const T value_) const noexcept
+    {
+        Matrix res;
+        std::transform(elements.begin(), elements.end(), res.elements.begin(), [value_](const T element_) { return element_ + value_; });
+        return res;
+    }
+
+    [[nodiscard]]
+    constexpr Matrix operator-(const T value_) const noexcept
+    {
+        return *this + (-value_);
+    }
+
+    template <std::size_t OtherCols>
+    [[nodiscard]]
+    Matrix<T, Rows, OtherCols> operator*(const Matrix<T, Cols, OtherCols>& other_) const noexcept
+    {
+        Matrix<T, Rows, OtherCols> res;
+        MatrixKernel::Multiply(Data(), other_.Data(), res.Data(), Rows, Cols, OtherCols);
+        return res;
+    }
+
+    [[nodiscard]]
+    Matrix<T, Cols, Rows> Transposed() const noexcept
+    {
+        Matrix<T, Cols, Rows> res;
+        MatrixKernel::Transpose(Data(), res.Data(), Rows, Cols);
+        return res;
+    }
+
+    void Transpose() noexcept requires (Rows == Cols)
+    {
+        MatrixKernel::TransposeInPlace(Data(), Rows);
+    }
+
+    [[nodiscard]]
+    T Determinant() const noexcept requires (Rows == Cols)
+    {
+        return MatrixKernel::Determinant(Data(), Rows);
+    }
+
+    [[nodiscard]]
+    constexpr T Min() const noexcept
+    {
+        return *std::min_element(elements.begin(), elements.end());
+    }
+
+    [[nodiscard]]
+    constexpr T Max() const noexcept
+    {
+        return *std::max_element(elements.begin(), elements.end());
+    }
+
+private:
+    std::array<T, Rows * Cols> elements = {};
+};
+
+// 크기가 실행 시간에 정해지는 밀집 행렬.
+template <typename T>
+class DynamicMatrix final
+{
+public:
+    explicit DynamicMatrix(const std::size_t rows_ = 0, const std::size_t cols_ = 0) noexcept
+        : rows(rows_)
+        , cols(cols_)
+        , elements(rows_ * cols_, T{})
+    {
+    }
+
+    [[nodiscard]]
+    std::size_t GetRows() const noexcept
+    {
+        return rows;
+    }
+
+    [[nodiscard]]
+    std::size_t GetCols() const noexcept
+    {
+        return cols;
+    }
+
+    [[nodiscard]]
+    T& operator()(const std::size_t row_, const std::size_t col_) noexcept
+    {
+        return elements[row_ * cols + col_];
+    }
+
+    [[nodiscard]]
+    const T& operator()(const std::size_t row_, const std::size_t col_) const noexcept
+    {
+        return elements[row_ * cols + col_];
+    }
+
+    [[nodiscard]]
+    T* Data() noexcept
+    {
+        return elements.data();
+    }
+
+    [[nodiscard]]
+    const T* Data() const noexcept
+    {
+        return elements.data();
+    }
+
+    [[nodiscard]]
+    DynamicMatrix operator+(const DynamicMatrix& other_) const noexcept
+    {
+        assert(rows == other_.rows && cols == other_.cols);
+
+        DynamicMatrix res(rows, cols);
+        MatrixKernel::Add(Data(), other_.Data(), res.Data(), elements.size());
+        return res;
+    }
+
+    [[nodiscard]]
+    DynamicMatrix operator-(const DynamicMatrix& other_) const noexcept
+    {
+        assert(rows == other_.rows && cols == other_.cols);
+
+        DynamicMatrix res(rows, cols);
+        MatrixKernel::Subtract(Data(), other_.Data(), res.Data(), elements.size());
+        return res;
+    }
+
+    // 충분히 큰 정사각 행렬끼리의 곱은 Strassen 알고리즘으로 계산합니다.
+    [[nodiscard]]
+    DynamicMatrix operator*(const DynamicMatrix& other_) const noexcept
+    {
+        assert(cols == other_.rows);
+
+        DynamicMatrix res(rows, other_.cols);
+        if (rows == cols && cols == other_.cols && rows >= MatrixKernel::STRASSEN_THRESHOLD)
+        {
+            MatrixKernel::MultiplyStrassen(Data(), other_.Data(), res.Data(), rows);
+            return res;
+        }
+
+        MatrixKernel::Multiply(Data(), other_.Data(), res.Data(), rows, cols, other_.cols);
+        return res;
+    }
+
+    [[nodiscard]]
+    DynamicMatrix Transposed() const noexcept
+    {
+        DynamicMatrix res(cols, rows);
+        MatrixKernel::Transpose(Data(), res.Data(), rows, cols);
+        return res;
+    }
+
+    // 정사각 행렬은 제자리에서, 아니라면 블록 단위로 복사하여 전치합니다.
+    void Transpose() noexcept
+    {
+        if (rows == cols)
+        {
+            MatrixKernel::TransposeInPlace(Data(), rows);
+            return;
+        }
+
+        *this = Transposed();
+    }
+
+    [[nodiscard]]
+    T Determinant() const noexcept
+    {
+        assert(rows == cols);
+        return MatrixKernel::Determinant(Data(), rows);
+    }
+
+    [[nodiscard]]
+    T Min() const noexcept
+    {
+        return *std::min_element(elements.begin(), elements.end());
+    }
+
+    [[nodiscard]]
+    T Max() const noexcept
+    {
+        return *std::max_element(elements.begin(), elements.end());
+    }
+
+private:
+    std::size_t    rows;
+    std::size_t    cols;
+    std::vector<T> elements;
+};
@@ -1,15 +1,24 @@
 #include <algorithm>
-#include <cstring>
+#include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <ctime>
+#include <format>
 #include <iostream>
+#include <random>
+#include <string_view>
+#include <thread>
+
+#include "Matrix.h"
 
 constexpr std::size_t MAT_SIZE = 4;
 
-int matrix1[MAT_SIZE][MAT_SIZE] = {};
-int matrix2[MAT_SIZE][MAT_SIZE] = {};
+using Mat = Matrix<int, MAT_SIZE, MAT_SIZE>;
+
+Mat matrix1;
+Mat matrix2;
 
-void Init(int mat_[MAT_SIZE][MAT_SIZE]) noexcept
+void Init(Mat& mat_) noexcept
 {
     static bool isInitialized = false;
     if (!isInitialized)
@@ -22,12 +31,12 @@ void Init(int mat_[MAT_SIZE][MAT_SIZE]) noexcept
     {
         for (std::size_t col = 0; col < MAT_SIZE; ++col)
         {
-            mat_[row][col] = std::rand() % 9 + 1;
+            mat_(row, col) = std::rand() % 9 + 1;
         }
     }
 }
 
-void Print(const int mat_[MAT_SIZE][MAT_SIZE], const int target_ = -1) noexcept
+void Print(const Mat& mat_, const int target_ = -1) noexcept
 {
     for (std::size_t row = 0; row < MAT_SIZE; ++row)
     {
@@ -35,9 +44,9 @@ void Print(const int mat_[MAT_SIZE][MAT_SIZE], const int target_ = -1) noexcept
         {
             if (target_ != -1)
             {
-                if (mat_[row][col] % target_ == 0)
+                if (mat_(row, col) % target_ == 0)
                 {
-                    std::cout << mat_[row][col] << ' ';
+                    std::cout << mat_(row, col) << ' ';
                 }
                 else
                 {
@@ -47,124 +56,167 @@ void Print(const int mat_[MAT_SIZE][MAT_SIZE], const int target_ = -1) noexcept
                 continue;
             }
 
-            std::cout << mat_[row][col] << ' ';
+            std::cout << mat_(row, col) << ' ';
         }
 
         std::cout << '\n';
     }
 }
 
-void Add(const int lhs_[MAT_SIZE][MAT_SIZE],
-         const int rhs_[MAT_SIZE][MAT_SIZE],
-         int       res_[MAT_SIZE][MAT_SIZE]) noexcept
+void Benchmark() noexcept
 {
-    for (std::size_t row = 0; row < MAT_SIZE; ++row)
-    {
-        for (std::size_t col = 0; col < MAT_SIZE; ++col)
-        {
-            res_[row][col] = lhs_[row][col] + rhs_[row][col];
-        }
-    }
-}
+    std::mt19937                          random(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
 
-void Subtract(const int lhs_[MAT_SIZE][MAT_SIZE],
-              const int rhs_[MAT_SIZE][MAT_SIZE],
-              int       res_[MAT_SIZE][MAT_SIZE]) noexcept
-{
-    for (std::size_t row = 0; row < MAT_SIZE; ++row)
+    for (const std::size_t size : { 256, 512, 1024, 2048, 4096 })
     {
-        for (std::size_t col = 0; col < MAT_SIZE; ++col)
+        DynamicMatrix<float> lhs(size, size);
+        DynamicMatrix<float> rhs(size, size);
+        std::generate(lhs.Data(), lhs.Data() + size * size, [&] { return distribution(random); });
+        std::generate(rhs.Data(), rhs.Data() + size * size, [&] { return distribution(random); });
+
+        const auto start = std::chrono::steady_clock::now();
+        const DynamicMatrix<float> res = lhs * rhs;
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        const double gflops = 2.0 * size * size * size / elapsed.count() * 1e-9;
+        std::cout << std::format("Multiply {0}x{0}: {1:.1f} ms, {2:.2f} GFLOP/s", size, elapsed.count() * 1000.0, gflops);
+
+        // 작은 크기는 단순 삼중 루프와 비교하여 결과를 확인합니다.
+        if (size <= 512)
         {
-            res_[row][col] = lhs_[row][col] - rhs_[row][col];
+            float maxError = 0.0f;
+            for (std::size_t row = 0; row < size; ++row)
+            {
+                for (std::size_t col = 0; col < size; ++col)
+                {
+                    float expected = 0.0f;
+                    for (std::size_t k = 0; k < size; ++k)
+                    {
+                        expected += lhs(row, k) * rhs(k, col);
+                    }
+
+                    maxError = std::max(maxError, std::abs(expected - res(row, col)));
+                }
+            }
+
+            std::cout << std::format(", max error {:.2e}", maxError);
         }
+
+        std::cout << '\n';
     }
-}
 
-void Multiply(const int lhs_[MAT_SIZE][MAT_SIZE],
-              const int rhs_[MAT_SIZE][MAT_SIZE],
-              int       res_[MAT_SIZE][MAT_SIZE]) noexcept
-{
-    for (std::size_t row = 0; row < MAT_SIZE; ++row)
     {
-        for (std::size_t col = 0; col < MAT_SIZE; ++col)
+        // 무작위 행렬의 행렬식은 double 범위를 넘으므로, 단위 행렬에 작은 잡음을 더해 유한한 값을 얻습니다.
+        DynamicMatrix<double> mat(1024, 1024);
+        for (std::size_t row = 0; row < 1024; ++row)
         {
-            res_[row][col] = 0;
-
-            for (std::size_t k = 0; k < MAT_SIZE; ++k)
+            for (std::size_t col = 0; col < 1024; ++col)
             {
-                res_[row][col] += lhs_[row][k] * rhs_[k][col];
+                mat(row, col) = (row == col ? 1.0 : 0.0) + distribution(random) * 0.01;
             }
         }
-    }
-}
 
-int Determinant(const int mat_[MAT_SIZE][MAT_SIZE]) noexcept
-{
-    return mat_[0][0] * (mat_[1][1] * (mat_[2][2] * mat_[3][3] - mat_[2][3] * mat_[3][2]) -
-                         mat_[1][2] * (mat_[2][1] * mat_[3][3] - mat_[2][3] * mat_[3][1]) +
-                         mat_[1][3] * (mat_[2][1] * mat_[3][2] - mat_[2][2] * mat_[3][1]))
+        const auto start = std::chrono::steady_clock::now();
+        const double determinant = mat.Determinant();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
 
-         - mat_[0][1] * (mat_[1][0] * (mat_[2][2] * mat_[3][3] - mat_[2][3] * mat_[3][2]) -
-                         mat_[1][2] * (mat_[2][0] * mat_[3][3] - mat_[2][3] * mat_[3][0]) +
-                         mat_[1][3] * (mat_[2][0] * mat_[3][2] - mat_[2][2] * mat_[3][0]))
+        std::cout << std::format("Determinant 1024x1024 (LU): {:.1f} ms, det = {:.3e}\n", elapsed.count(), determinant);
+    }
+    {
+        DynamicMatrix<float> mat(4096, 4096);
+        std::generate(mat.Data(), mat.Data() + 4096 * 4096, [&] { return distribution(random); });
 
-         + mat_[0][2] * (mat_[1][0] * (mat_[2][1] * mat_[3][3] - mat_[2][3] * mat_[3][1]) -
-                         mat_[1][1] * (mat_[2][0] * mat_[3][3] - mat_[2][3] * mat_[3][0]) +
-                         mat_[1][3] * (mat_[2][0] * mat_[3][1] - mat_[2][1] * mat_[3][0]))
+        const auto start = std::chrono::steady_clock::now();
+        mat.Transpose();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
 
-         - mat_[0][3] * (mat_[1][0] * (mat_[2][1] * mat_[3][2] - mat_[2][2] * mat_[3][1]) -
-                         mat_[1][1] * (mat_[2][0] * mat_[3][2] - mat_[2][2] * mat_[3][0]) +
-                         mat_[1][2] * (mat_[2][0] * mat_[3][1] - mat_[2][1] * mat_[3][0]));
+        std::cout << std::format("Transpose 4096x4096 (in place): {:.1f} ms\n", elapsed.count());
+    }
 }
 
-void Transpose(const int mat_[MAT_SIZE][MAT_SIZE],
-               int       res_[MAT_SIZE][MAT_SIZE]) noexcept
+// 같은 연산을 스레드 1개와 모든 하드웨어 스레드로 한 번씩 실행하여 걸린 시간과 속도 향상을 출력합니다.
+template <typename Function>
+void CompareThreads(const std::string_view name_, Function&& function_) noexcept
 {
-    for (std::size_t row = 0; row < MAT_SIZE; ++row)
+    const std::size_t threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    double elapsed[2] = {};
+    for (std::size_t index = 0; index < 2; ++index)
     {
-        for (std::size_t col = 0; col < MAT_SIZE; ++col)
-        {
-            res_[col][row] = mat_[row][col];
-        }
+        ThreadPool::Instance().Resize(index == 0 ? 1 : threadCount);
+
+        const auto start = std::chrono::steady_clock::now();
+        function_();
+        elapsed[index] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
     }
+
+    std::cout << std::format("{:<32} 1 thread {:8.1f} ms, {} threads {:8.1f} ms, speedup x{:.2f}\n",
+                             name_,
+                             elapsed[0],
+                             threadCount,
+                             elapsed[1],
+                             elapsed[0] / elapsed[1]);
 }
 
-[[nodiscard]]
-int FindMin(const int mat_[MAT_SIZE][MAT_SIZE]) noexcept
+void BenchmarkThreads() noexcept
 {
-    int res = mat_[0][0];
-    for (std::size_t row = 0; row < MAT_SIZE; ++row)
+    std::mt19937                          random(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    for (const std::size_t size : { 1024, 2048, 4096 })
     {
-        for (std::size_t col = 0; col < MAT_SIZE; ++col)
+        DynamicMatrix<float> lhs(size, size);
+        DynamicMatrix<float> rhs(size, size);
+        DynamicMatrix<float> res(size, size);
+        std::generate(lhs.Data(), lhs.Data() + size * size, [&] { return distribution(random); });
+        std::generate(rhs.Data(), rhs.Data() + size * size, [&] { return distribution(random); });
+
+        CompareThreads(std::format("Multiply {0}x{0}", size), [&]
+        {
+            MatrixKernel::Multiply(lhs.Data(), rhs.Data(), res.Data(), size, size, size);
+        });
+
+        if (size >= MatrixKernel::STRASSEN_THRESHOLD)
         {
-            if (res > mat_[row][col])
+            const DynamicMatrix<float> blocked = res;
+
+            CompareThreads(std::format("Multiply {0}x{0} (Strassen)", size), [&]
+            {
+                MatrixKernel::MultiplyStrassen(lhs.Data(), rhs.Data(), res.Data(), size);
+            });
+
+            // Strassen은 덧셈/뺄셈 순서가 달라 반올림 오차가 조금 더 큽니다.
+            float maxError = 0.0f;
+            for (std::size_t index = 0; index < size * size; ++index)
             {
-                res = mat_[row][col];
+                maxError = std::max(maxError, std::abs(blocked.Data()[index] - res.Data()[index]));
             }
+
+            std::cout << std::format("{:<32} max error {:.2e}\n", "", maxError);
         }
+
+        CompareThreads(std::format("Add {0}x{0}", size), [&] { res = lhs + rhs; });
+        CompareThreads(std::format("Subtract {0}x{0}", size), [&] { res = lhs - rhs; });
+        CompareThreads(std::format("Transpose {0}x{0}", size), [&] { res = lhs.Transposed(); });
+        CompareThreads(std::format("Transpose {0}x{0} (in place)", size), [&] { lhs.Transpose(); });
     }
-    return res;
+
+    ThreadPool::Instance().Resize(std::thread::hardware_concurrency());
 }
 
-[[nodiscard]]
-int FindMax(const int mat_[MAT_SIZE][MAT_SIZE]) noexcept
+int main(int argc, char* argv[])
 {
-    int res = mat_[0][0];
-    for (std::size_t row = 0; row < MAT_SIZE; ++row)
+    // --bench: 스레드 수에 따른 속도 차이만 출력하고 종료합니다.
+    for (int index = 1; index < argc; ++index)
     {
-        for (std::size_t col = 0; col < MAT_SIZE; ++col)
+        if (std::string_view(argv[index]) == "--bench")
         {
-            if (res < mat_[row][col])
-            {
-                res = mat_[row][col];
-            }
+            BenchmarkThreads();
+            return 0;
         }
     }
-    return res;
-}
 
-int main()
-{
     std::cout << "====[1st Matrix]====\n";
     Init(matrix1);
     Print(matrix1);
@@ -212,8 +264,7 @@ int main()
         {
             case 'm':
             {
-                int res[MAT_SIZE][MAT_SIZE] = {};
-                Multiply(matrix1, matrix2, res);
+                const Mat res = matrix1 * matrix2;
 
                 std::cout << "====[Result Matrix]====\n";
                 Print(res);
@@ -222,8 +273,7 @@ int main()
             }
             case 'a':
             {
-                int res[MAT_SIZE][MAT_SIZE] = {};
-                Add(matrix1, matrix2, res);
+                const Mat res = matrix1 + matrix2;
 
                 std::cout << "====[Result Matrix]====\n";
                 Print(res);
@@ -232,8 +282,7 @@ int main()
             }
             case 'd':
             {
-                int res[MAT_SIZE][MAT_SIZE] = {};
-                Subtract(matrix1, matrix2, res);
+                const Mat res = matrix1 - matrix2;
 
                 std::cout << "====[Result Matrix]====\n";
                 Print(res);
@@ -242,8 +291,8 @@ int main()
             }
             case 'r':
             {
-                const int det1 = Determinant(matrix1);
-                const int det2 = Determinant(matrix2);
+                const int det1 = matrix1.Determinant();
+                const int det2 = matrix2.Determinant();
 
                 std::cout << "====[Determinants]====\n";
                 std::cout << "det(mat1): " << det1 << '\n';
@@ -254,11 +303,11 @@ int main()
             case 't':
             {
                 {
-                    int res1[MAT_SIZE][MAT_SIZE] = {};
-                    int res2[MAT_SIZE][MAT_SIZE] = {};
+                    Mat res1 = matrix1;
+                    Mat res2 = matrix2;
 
-                    Transpose(matrix1, res1);
-                    Transpose(matrix2, res2);
+                    res1.Transpose();
+                    res2.Transpose();
 
                     std::cout << "====[Transposed Matrix 1]====\n";
                     Print(res1);
@@ -267,8 +316,8 @@ int main()
                     Print(res2);
                 }
                 {
-                    const int det1 = Determinant(matrix1);
-                    const int det2 = Determinant(matrix2);
+                    const int det1 = matrix1.Determinant();
+                    const int det2 = matrix2.Determinant();
 
                     std::cout << "====[Determinants]====\n";
                     std::cout << "det(mat1): " << det1 << '\n';
@@ -282,25 +331,17 @@ int main()
                 static bool trigger = false;
                 trigger = !trigger;
 
-                static int subMatrix1[MAT_SIZE][MAT_SIZE] = {};
-                static int subMatrix2[MAT_SIZE][MAT_SIZE] = {};
+                static Mat subMatrix1;
+                static Mat subMatrix2;
 
                 if (trigger)
                 {
-                    std::memcpy(subMatrix1, matrix1, sizeof(int) * MAT_SIZE * MAT_SIZE);
-                    std::memcpy(subMatrix2, matrix2, sizeof(int) * MAT_SIZE * MAT_SIZE);
+                    subMatrix1 = matrix1;
+                    subMatrix2 = matrix2;
 
-                    const int matrix1Max = FindMin(matrix1);
-                    const int matrix2Max = FindMin(matrix2);
+                    matrix1 = matrix1 - matrix1.Min();
+                    matrix2 = matrix2 - matrix2.Min();
 
-                    for (std::size_t row = 0; row < MAT_SIZE; ++row)
-                    {
-                        for (std::size_t col = 0; col < MAT_SIZE; ++col)
-                        {
-                            matrix1[row][col] -= matrix1Max;
-                            matrix2[row][col] -= matrix2Max;
-                        }
-                    }
                     std::cout << "====[1st Matrix - Min Extracted]====\n";
                     Print(matrix1);
 
@@ -309,8 +350,8 @@ int main()
                 }
                 else
                 {
-                    std::memcpy(matrix1, subMatrix1, sizeof(int) * MAT_SIZE * MAT_SIZE);
-                    std::memcpy(matrix2, subMatrix2, sizeof(int) * MAT_SIZE * MAT_SIZE);
+                    matrix1 = subMatrix1;
+                    matrix2 = subMatrix2;
 
                     std::cout << "====[1st Matrix]====\n";
                     Print(matrix1);
@@ -326,25 +367,16 @@ int main()
                 static bool trigger = false;
                 trigger = !trigger;
 
-                static int subMatrix1[MAT_SIZE][MAT_SIZE] = {};
-                static int subMatrix2[MAT_SIZE][MAT_SIZE] = {};
+                static Mat subMatrix1;
+                static Mat subMatrix2;
 
                 if (trigger)
                 {
-                    std::memcpy(subMatrix1, matrix1, sizeof(int) * MAT_SIZE * MAT_SIZE);
-                    std::memcpy(subMatrix2, matrix2, sizeof(int) * MAT_SIZE * MAT_SIZE);
+                    subMatrix1 = matrix1;
+                    subMatrix2 = matrix2;
 
-                    const int mat1Max = FindMax(matrix1);
-                    const int mat2Max = FindMax(matrix2);
-
-                    for (std::size_t row = 0; row < MAT_SIZE; ++row)
-                    {
-                        for (std::size_t col = 0; col < MAT_SIZE; ++col)
-                        {
-                            matrix1[row][col] += mat1Max;
-                            matrix2[row][col] += mat2Max;
-                        }
-                    }
+                    matrix1 = matrix1 + matrix1.Max();
+                    matrix2 = matrix2 + matrix2.Max();
 
                     std::cout << "====[1st Matrix - Max Extracted]====\n";
                     Print(matrix1);
@@ -354,8 +386,8 @@ int main()
                 }
                 else
                 {
-                    std::memcpy(matrix1, subMatrix1, sizeof(int) * MAT_SIZE * MAT_SIZE);
-                    std::memcpy(matrix2, subMatrix2, sizeof(int) * MAT_SIZE * MAT_SIZE);
+                    matrix1 = subMatrix1;
+                    matrix2 = subMatrix2;
 
                     std::cout << "====[1st Matrix]====\n";
                     Print(matrix1);
@@ -366,6 +398,11 @@ int main()
 
                 break;
             }
+            case 'b':
+            {
+                Benchmark();
+                break;
+            }
             case 's':
             {
                 Init(matrix1);
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 행렬 연산의 타일을 나누어 실행하는 스레드 풀.
+// ParallelFor를 호출한 스레드도 직접 인덱스를 가져가 실행하므로, 작업 안에서 다시 ParallelFor를 호출해도 교착되지 않습니다.
+class ThreadPool final
+{
+public:
+    explicit ThreadPool(const std::size_t threadCount_ = std::thread::hardware_concurrency()) noexcept
+        : isStopping(false)
+    {
+        Start(threadCount_);
+    }
+
+    ~ThreadPool() noexcept
+    {
+        Stop();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    [[nodiscard]]
+    static ThreadPool& Instance() noexcept
+    {
+        static ThreadPool instance;
+        return instance;
+    }
+
+    // 호출한 스레드를 포함한 스레드 수.
+    [[nodiscard]]
+    std::size_t GetThreadCount() const noexcept
+    {
+        return workers.size() + 1;
+    }
+
+    // 스레드 수를 바꿉니다. 1이라면 모든 작업이 호출한 스레드에서 실행됩니다.
+    void Resize(const std::size_t threadCount_) noexcept
+    {
+        Stop();
+        Start(threadCount_);
+    }
+
+    // [0, count_)의 각 인덱스에 대해 function_을 한 번씩 실행하고, 모두 끝날 때까지 기다립니다.
+    template <typename Function>
+    void ParallelFor(const std::size_t count_, Function&& function_) noexcept
+    {
+        if (workers.empty() || count_ <= 1)
+        {
+            for (std::size_t index = 0; index < count_; ++index)
+            {
+                function_(index);
+            }
+
+            return;
+        }
+
+        struct Batch final
+        {
+            std::atomic<std::size_t>         next      = 0;
+            std::atomic<std::size_t>         remaining = 0;
+            std::size_t                      count     = 0;
+            std::function<void(std::size_t)> function;
+        };
+
+        const std::shared_ptr<Batch> batch = std::make_shared<Batch>();
+        batch->remaining = count_;
+        batch->count     = count_;
+        batch->function  = [&function_](const std::size_t index_) { function_(index_); };
+
+        // 인덱스는 실행 직전에 가져가므로, 아직 시작하지 않은 인덱스는 언제나 호출한 스레드가 처리할 수 있습니다.
+        const auto run = [batch]
+        {
+            for (std::size_t index = batch->next.fetch_add(1); index < batch->count; index = batch->next.fetch_add(1))
+            {
+                batch->function(index);
+
+                if (batch->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    batch->remaining.notify_all();
+                }
+            }
+        };
+
+        {
+            std::scoped_lock lock(mutex);
+
+            const std::size_t helperCount = std::min(workers.size(), count_ - 1);
+            for (std::size_t helper = 0; helper < helperCount; ++helper)
+            {
+                tasks.emplace_back(run);
+            }
+        }
+        condition.notify_all();
+
+        run();
+
+        // 다른 스레드가 실행 중인 인덱스만 남았으므로 끝나기를 기다립니다.
+        for (std::size_t remaining = batch->remaining.load(std::memory_order_acquire); remaining != 0; remaining = batch->remaining.load(std::memory_order_acquire))
+        {
+            batch->remaining.wait(remaining);
+        }
+    }
+
+private:
+    void Start(const std::size_t threadCount_) noexcept
+    {
+        isStopping = false;
+
+        const std::size_t workerCount = std::max<std::size_t>(threadCount_, 1) - 1;
+        workers.reserve(workerCount);
+
+        for (std::size_t worker = 0; worker < workerCount; ++worker)
+        {
+            workers.emplace_back([this]
+            {
+                while (true)
+                {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock lock(mutex);
+                        condition.wait(lock, [this] { return isStopping || !tasks.empty(); });
+
+                        if (tasks.empty())
+                        {
+                            return;
+                        }
+
+                        task = std::move(tasks.front());
+                        tasks.pop_front();
+                    }
+
+                    task();
+                }
+            });
+        }
+    }
+
+    void Stop() noexcept
+    {
+        {
+            std::scoped_lock lock(mutex);
+            isStopping = true;
+        }
+        condition.notify_all();
+
+        workers.clear();
+    }
+
+    std::mutex                        mutex;
+    std::condition_variable           condition;
+    std::deque<std::function<void()>> tasks;
+    std::vector<std::jthread>         workers;
+    bool                              isStopping;
+};
@@ -0,0 +1,321 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__AVX2__)
+#define TEXT_USE_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define TEXT_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// 매핑된 텍스트 버퍼를 여러 스레드로 나누어 훑는 데 쓰는 연산들.
+namespace TextKernel
+{
+    // 한 스레드가 한 번에 맡는 바이트 수. 출력 버퍼도 이 크기 단위로 만들어 순서대로 내보냅니다.
+    constexpr std::size_t CHUNK_BYTES = 4 << 20;
+
+    [[nodiscard]]
+    inline std::size_t GetThreadCount() noexcept
+    {
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // function_(part)를 [0, partCount_)의 각 part에 대해 서로 다른 스레드에서 실행하고, 모두 끝날 때까지 기다립니다.
+    template <typename Function>
+    void ParallelFor(const std::size_t partCount_, Function&& function_) noexcept
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(partCount_ > 0 ? partCount_ - 1 : 0);
+
+        for (std::size_t part = 1; part < partCount_; ++part)
+        {
+            threads.emplace_back([&function_, part] { function_(part); });
+        }
+
+        if (partCount_ > 0)
+        {
+            function_(0);
+        }
+    }
+
+    // data_[begin_, end_)에 있는 모든 '\n'의 바로 다음 위치를 offsets_ 뒤에 차례대로 추가합니다.
+    // 32(또는 16)바이트씩 비교하여 얻은 비트 마스크에서 켜진 비트만 꺼내므로, 줄바꿈이 아닌 바이트는 따로 보지 않습니다.
+    inline void FindNewlines(const char* const          data_,
+                             const std::size_t          begin_,
+                             const std::size_t          end_,
+                             std::vector<std::uint64_t>& offsets_) noexcept
+    {
+        std::size_t position = begin_;
+
+#if defined(TEXT_USE_AVX2)
+        const __m256i newline = _mm256_set1_epi8('\n');
+        for (; position + 32 <= end_; position += 32)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data_ + position));
+            for (std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline))); mask != 0; mask &= mask - 1)
+            {
+                offsets_.push_back(position + std::countr_zero(mask) + 1);
+            }
+        }
+#elif defined(TEXT_USE_SSE2)
+        const __m128i newline = _mm_set1_epi8('\n');
+        for (; position + 16 <= end_; position += 16)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data_ + position));
+            for (std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline))); mask != 0; mask &= mask - 1)
+            {
+                offsets_.push_back(position + std::countr_zero(mask) + 1);
+            }
+        }
+#endif
+
+        for (; position < end_; ++position)
+        {
+            if (data_[position] == '\n')
+            {
+                offsets_.push_back(position + 1);
+            }
+        }
+    }
+}
+
+// 읽기 전용으로 매핑한 텍스트. 줄을 바꾸는 명령은 버퍼를 고치지 않고 TextPipeline에 쌓입니다.
+class MappedText final
+{
+public:
+    MappedText() noexcept = default;
+
+    ~MappedText() noexcept
+    {
+        Close();
+    }
+
+    MappedText(const MappedText&) = delete;
+    MappedText& operator=(const MappedText&) = delete;
+
+    [[nodiscard]]
+    bool Open(const std::filesystem::path& path_) noexcept
+    {
+        Close();
+
+#ifdef _WIN32
+        file = CreateFileW(path_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            Close();
+            return false;
+        }
+
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+        if (size > 0)
+        {
+            mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            data    = mapping != nullptr ? static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+            if (data == nullptr)
+            {
+                Close();
+                return false;
+            }
+        }
+#else
+        const int descriptor = open(path_.c_str(), O_RDONLY);
+        if (descriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat status = {};
+        if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode))
+        {
+            close(descriptor);
+            return false;
+        }
+
+        size = static_cast<std::size_t>(status.st_size);
+        if (size > 0)
+        {
+            void* const address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (address == MAP_FAILED)
+            {
+                close(descriptor);
+                size = 0;
+                return false;
+            }
+
+            data = static_cast<const char*>(address);
+            madvise(address, size, MADV_SEQUENTIAL);
+        }
+
+        // 매핑은 파일 디스크립터를 닫아도 유지됩니다.
+        close(descriptor);
+#endif
+
+        isOpen = true;
+        IndexLines();
+        return true;
+    }
+
+    void Close() noexcept
+    {
+#ifdef _WIN32
+        if (data != nullptr)
+        {
+            UnmapViewOfFile(data);
+        }
+
+        if (mapping != nullptr)
+        {
+            CloseHandle(mapping);
+            mapping = nullptr;
+        }
+
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+            file = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (data != nullptr)
+        {
+            munmap(const_cast<char*>(data), size);
+        }
+#endif
+
+        data   = nullptr;
+        size   = 0;
+        isOpen = false;
+        lineOffsets.assign(1, 0);
+    }
+
+    [[nodiscard]]
+    bool IsOpen() const noexcept
+    {
+        return isOpen;
+    }
+
+    [[nodiscard]]
+    const char* Data() const noexcept
+    {
+        return data;
+    }
+
+    [[nodiscard]]
+    std::size_t GetSize() const noexcept
+    {
+        return size;
+    }
+
+    [[nodiscard]]
+    std::size_t GetLineCount() const noexcept
+    {
+        return lineOffsets.size() - 1;
+    }
+
+    // 줄 끝의 "\n"(또는 "\r\n")을 뺀 내용.
+    [[nodiscard]]
+    std::string_view GetLine(const std::size_t line_) const noexcept
+    {
+        const auto [begin, end] = GetLineRange(line_);
+        return std::string_view(data + begin, end - begin);
+    }
+
+    // offset_ 이후에 시작하는 첫 줄. offset_이 파일 끝이라면 GetLineCount()입니다.
+    [[nodiscard]]
+    std::size_t FindLine(const std::size_t offset_) const noexcept
+    {
+        return static_cast<std::size_t>(std::lower_bound(lineOffsets.begin(), lineOffsets.end() - 1, offset_) - lineOffsets.begin());
+    }
+
+private:
+    [[nodiscard]]
+    std::pair<std::size_t, std::size_t> GetLineRange(const std::size_t line_) const noexcept
+    {
+        const std::size_t begin = lineOffsets[line_];
+        std::size_t       end   = lineOffsets[line_ + 1];
+
+        if (end > begin && data[end - 1] == '\n')
+        {
+            --end;
+        }
+
+        if (end > begin && data[end - 1] == '\r')
+        {
+            --end;
+        }
+
+        return { begin, end };
+    }
+
+    // 파일을 스레드 수만큼 나누어 줄바꿈을 찾고, 구간별 결과를 이어 붙여 줄 시작 위치 목록을 만듭니다.
+    void IndexLines() noexcept
+    {
+        const std::size_t partCount = std::clamp<std::size_t>(size / TextKernel::CHUNK_BYTES, 1, TextKernel::GetThreadCount());
+
+        std::vector<std::vector<std::uint64_t>> parts(partCount);
+        TextKernel::ParallelFor(partCount, [&](const std::size_t part_)
+        {
+            TextKernel::FindNewlines(data, size * part_ / partCount, size * (part_ + 1) / partCount, parts[part_]);
+        });
+
+        std::size_t lineCount = 1;
+        for (const std::vector<std::uint64_t>& part : parts)
+        {
+            lineCount += part.size();
+        }
+
+        lineOffsets.clear();
+        lineOffsets.reserve(lineCount + 1);
+        lineOffsets.push_back(0);
+
+        for (const std::vector<std::uint64_t>& part : parts)
+        {
+            lineOffsets.insert(lineOffsets.end(), part.begin(), part.end());
+        }
+
+        // 마지막 줄이 줄바꿈으로 끝나지 않더라도 한 줄로 셉니다.
+        if (lineOffsets.back() != size)
+        {
+            lineOffsets.push_back(size);
+        }
+    }
+
+    const char* data   = nullptr;
+    std::size_t size   = 0;
+    bool        isOpen = false;
+
+#ifdef _WIN32
+    HANDLE file    = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+
+    // 줄 i는 [lineOffsets[i], lineOffsets[i + 1])이며 끝의 줄바꿈을 포함합니다. 마지막 값은 파일 크기입니다.
+    std::vector<std::uint64_t> lineOffsets = { 0 };
+};
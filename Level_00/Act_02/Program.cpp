@@ -1,22 +1,175 @@
 ﻿#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
 #include <vector>
-#include <sstream>
+
+#include "MappedText.h"
+#include "TextPipeline.h"
+
+MappedText text;
+
+// 줄을 바꾸는 명령(e, f, g)이 쌓이는 파이프라인. 줄을 읽을 때마다 적용됩니다.
+TextPipeline pipeline;
+
+// 켜져 있다면 줄을 바꾸는 명령이 결과를 출력하지 않고 파이프라인에 쌓기만 합니다. 'p'로 출력하거나 's'로 저장합니다.
+bool isLazy = false;
+
+// 묶음마다 출력을 모아 두는 버퍼. 명령 사이에 재사용합니다.
+std::vector<std::string> outputs;
+
+// 명령이 파일 전체를 처리하는 데 걸린 시간과 처리량을 출력합니다.
+// 표준 오류로 출력하므로, 큰 파일의 결과를 표준 출력으로 돌려 받아도 섞이지 않습니다.
+template <typename Function>
+void Measure(const std::string_view name_, Function&& function_) noexcept
+{
+    const auto start = std::chrono::steady_clock::now();
+    function_();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    const double gigabytes = static_cast<double>(text.GetSize()) * 1e-9;
+    std::cerr << std::format("[{}] {:.3f} GB, {} lines in {:.1f} ms ({:.2f} GB/s)\n",
+                             name_,
+                             gigabytes,
+                             text.GetLineCount(),
+                             elapsed.count() * 1000.0,
+                             elapsed.count() > 0.0 ? gigabytes / elapsed.count() : 0.0);
+}
+
+// 모든 줄을 스레드 수만큼의 연속된 구간으로 나누어 function_(lineBegin, lineEnd)를 실행합니다.
+template <typename Function>
+void ForEachLines(Function&& function_) noexcept
+{
+    const std::size_t lineCount = text.GetLineCount();
+    const std::size_t partCount = std::clamp<std::size_t>(text.GetSize() / TextKernel::CHUNK_BYTES, 1, TextKernel::GetThreadCount());
+
+    TextKernel::ParallelFor(partCount, [&](const std::size_t part_)
+    {
+        function_(lineCount * part_ / partCount, lineCount * (part_ + 1) / partCount);
+    });
+}
+
+// 파일을 CHUNK_BYTES 크기의 줄 묶음으로 나누고, 스레드 수만큼의 묶음을 동시에 처리한 뒤 stream_에 순서대로 씁니다.
+// function_(lineBegin, lineEnd, output)은 자기 묶음의 결과를 output 뒤에 붙입니다.
+// output은 묶음마다 비우고 다시 쓰므로 줄마다 메모리를 할당하지 않습니다.
+template <typename Function>
+void Process(std::ostream& stream_, Function&& function_) noexcept
+{
+    const std::size_t threadCount = TextKernel::GetThreadCount();
+    const std::size_t chunkCount  = std::max<std::size_t>(text.GetSize() / TextKernel::CHUNK_BYTES, 1);
+
+    outputs.resize(threadCount);
+
+    for (std::size_t batch = 0; batch < chunkCount; batch += threadCount)
+    {
+        const std::size_t partCount = std::min(threadCount, chunkCount - batch);
+
+        TextKernel::ParallelFor(partCount, [&](const std::size_t part_)
+        {
+            const std::size_t chunk = batch + part_;
+
+            outputs[part_].clear();
+            function_(text.FindLine(text.GetSize() * chunk / chunkCount),
+                      text.FindLine(text.GetSize() * (chunk + 1) / chunkCount),
+                      outputs[part_]);
+        });
+
+        for (std::size_t part = 0; part < partCount; ++part)
+        {
+            stream_.write(outputs[part].data(), static_cast<std::streamsize>(outputs[part].size()));
+        }
+    }
+
+    stream_.flush();
+}
+
+// std::stringstream >> std::string처럼 공백 문자로 나눈 단어마다 function_(word)를 호출합니다.
+template <typename Function>
+void ForEachWord(const std::string_view line_, Function&& function_) noexcept
+{
+    std::size_t position = 0;
+
+    while (true)
+    {
+        while (position < line_.size() && std::isspace(static_cast<unsigned char>(line_[position])))
+        {
+            ++position;
+        }
+
+        if (position == line_.size())
+        {
+            return;
+        }
+
+        const std::size_t begin = position;
+        while (position < line_.size() && !std::isspace(static_cast<unsigned char>(line_[position])))
+        {
+            ++position;
+        }
+
+        function_(line_.substr(begin, position - begin));
+    }
+}
+
+bool EqualsIgnoreCase(const std::string_view lhs_, const std::string_view rhs_) noexcept
+{
+    return std::ranges::equal(lhs_, rhs_, [](const unsigned char a_, const unsigned char b_)
+    {
+        return std::tolower(a_) == std::tolower(b_);
+    });
+}
+
+// 줄에 파이프라인을 적용한 내용을 line_에 담습니다. line_은 호출한 쪽에서 재사용합니다.
+void ReadLine(const std::size_t index_, std::string& line_) noexcept
+{
+    line_.clear();
+    pipeline.Apply(text.GetLine(index_), line_);
+}
+
+// view_를 적용한 모든 줄을 stream_에 씁니다. 쌓인 변환이 실제로 적용되는 곳입니다.
+void Print(std::ostream& stream_, const TextPipeline& view_) noexcept
+{
+    Process(stream_, [&view_](const std::size_t lineBegin_, const std::size_t lineEnd_, std::string& output_)
+    {
+        for (std::size_t line = lineBegin_; line < lineEnd_; ++line)
+        {
+            view_.Apply(text.GetLine(line), output_);
+            output_.push_back('\n');
+        }
+    });
+}
+
+// 줄을 바꾸는 명령을 마친 뒤 호출합니다. 지연 모드가 아니라면 바뀐 내용을 출력합니다.
+void Commit(const std::string_view name_) noexcept
+{
+    if (isLazy)
+    {
+        std::cerr << std::format("[{}] queued, {} transforms in {} pass(es)\n", name_, pipeline.GetTransformCount(), pipeline.GetPassCount());
+        return;
+    }
+
+    Measure(name_, [] { Print(std::cout, pipeline); });
+}
 
 int main()
 {
-    std::string   input;
-    std::ifstream file;
+    std::string input;
 
     while (true)
     {
         std::cout << "Enter the file path: ";
         std::getline(std::cin, input);
 
-        file.open(input);
-        if (not file)
+        bool isOpen = false;
+        Measure("open", [&] { isOpen = text.Open(input); });
+
+        if (not isOpen)
         {
             std::cout << "Failed to open the file: " << input << '\n';
             continue;
@@ -25,54 +178,52 @@ int main()
         break;
     }
 
-    std::string              temp;
-    std::vector<std::string> lines;
-
-    while (std::getline(file, temp))
-    {
-        lines.push_back(temp);
-    }
-
-    for (const std::string& line : lines)
+    // 처음에는 매핑된 버퍼를 그대로 출력합니다.
+    std::cout.write(text.Data(), static_cast<std::streamsize>(text.GetSize()));
+    if (text.GetSize() > 0 && text.Data()[text.GetSize() - 1] != '\n')
     {
-        std::cout << line << '\n';
+        std::cout << '\n';
     }
     std::cout.flush();
 
     bool isRunning = true;
     while (isRunning)
     {
-        switch (getchar())
+        const int command = getchar();
+
+        switch (command)
         {
             case 'a':
             {
                 static bool trigger = false;
                 trigger = !trigger;
 
-                for (const auto& iter1 : lines)
+                // 대문자 변환은 쌓인 변환의 표에 합쳐지므로 따로 훑지 않습니다.
+                TextPipeline view = pipeline;
+                if (trigger)
                 {
-                    for (const auto iter2 : iter1)
-                    {
-                        if (trigger)
-                        {
-                            std::cout << static_cast<char>(std::toupper(iter2));
-                            continue;
-                        }
-
-                        std::cout << iter2;
-                    }
-                    std::cout << '\n'; // Add newline after each line
+                    view.ToUpper();
                 }
-                std::cout.flush();
+
+                Measure("a", [&] { Print(std::cout, view); });
                 break;
             }
             case 'b':
             {
-                for (const std::string& line : lines)
+                Measure("b", []
                 {
-                    std::size_t wordCount = std::ranges::count(line, ' ');
-                    std::cout << line << " (" << wordCount + 1 << ")\n";
-                }
+                    Process(std::cout, [](const std::size_t lineBegin_, const std::size_t lineEnd_, std::string& output_)
+                    {
+                        for (std::size_t line = lineBegin_; line < lineEnd_; ++line)
+                        {
+                            const std::size_t begin = output_.size();
+                            pipeline.Apply(text.GetLine(line), output_);
+
+                            const std::size_t wordCount = std::count(output_.begin() + begin, output_.end(), ' ');
+                            std::format_to(std::back_inserter(output_), " ({})\n", wordCount + 1);
+                        }
+                    });
+                });
 
                 break;
             }
@@ -81,34 +232,40 @@ int main()
                 static bool trigger = false;
                 trigger = !trigger;
 
-                for (const std::string& line : lines)
+                if (!trigger)
+                {
+                    Measure("c", [] { Print(std::cout, pipeline); });
+                    break;
+                }
+
+                Measure("c", []
                 {
-                    if (trigger)
+                    Process(std::cout, [](const std::size_t lineBegin_, const std::size_t lineEnd_, std::string& output_)
                     {
-                        std::stringstream ss(line);
-                        std::string       word;
-                        std::size_t       upperCount = 0;
+                        std::string content;
 
-                        while (ss >> word)
+                        for (std::size_t line = lineBegin_; line < lineEnd_; ++line)
                         {
-                            if (std::isupper(word[0]))
-                            {
-                                std::cout << "\033[33m" << word << "\033[0m ";
-                                ++upperCount;
-                            }
-                            else
+                            std::size_t upperCount = 0;
+
+                            ReadLine(line, content);
+                            ForEachWord(content, [&](const std::string_view word_)
                             {
-                                std::cout << word << ' ';
-                            }
-                        }
+                                if (std::isupper(static_cast<unsigned char>(word_[0])))
+                                {
+                                    output_.append("\033[33m").append(word_).append("\033[0m ");
+                                    ++upperCount;
+                                }
+                                else
+                                {
+                                    output_.append(word_).push_back(' ');
+                                }
+                            });
 
-                        std::cout << "(" << upperCount << ")\n";
-                    }
-                    else
-                    {
-                        std::cout << line << '\n';
-                    }
-                }
+                            std::format_to(std::back_inserter(output_), "({})\n", upperCount);
+                        }
+                    });
+                });
                 break;
             }
             case 'd':
@@ -116,20 +273,13 @@ int main()
                 static bool trigger = false;
                 trigger = !trigger;
 
-                for (const std::string& line : lines)
+                TextPipeline view = pipeline;
+                if (trigger)
                 {
-                    if (trigger)
-                    {
-                        std::string subLine = line;
-                        std::ranges::reverse(subLine);
-                        std::cout << subLine << '\n';
-                    }
-                    else
-                    {
-                        std::cout << line << '\n';
-                    }
+                    view.Reverse();
                 }
 
+                Measure("d", [&] { Print(std::cout, view); });
                 break;
             }
             case 'e':
@@ -137,96 +287,40 @@ int main()
                 static bool trigger = false;
                 trigger = !trigger;
 
-                for (std::string& r : lines)
-                {
-                    std::ranges::replace(r, trigger ? ' ' : '/', trigger ? '/' : ' ');
-                    std::cout << r << '\n'; // 수정된 내용 출력
-                }
+                pipeline.Replace(trigger ? ' ' : '/', trigger ? '/' : ' ');
+                Commit("e"); // 수정된 내용 출력
 
                 break;
             }
             case 'f':
             {
-                static bool trigger = false;
-                trigger = !trigger;
-
-                for (auto& iter1 : lines)
-                {
-                    bool trigger2 = false;
-                    for (auto& iter2 : iter1)
-                    {
-                        if (iter2 == ' ' || iter2 == '/')
-                        {
-                            trigger2 = true;
-                        }
-                    }
-
-                    if (trigger2)
-                    {
-                        std::ranges::reverse(iter1);
-                    }
-
-                    std::cout << iter1 << '\n';
-                }
+                pipeline.ReverseIf(" /");
+                Commit("f");
 
                 break;
             }
             case 'g':
             {
-                static bool trigger= false;
+                static bool trigger = false;
                 trigger = !trigger;
 
-                static std::vector<std::string> temp;
+                // 되돌릴 때는 버퍼 대신 파이프라인만 저장해 둔 것으로 바꿉니다.
+                static TextPipeline temp;
 
                 if (trigger)
                 {
                     char targetChar, replacementChar;
                     std::cin >> targetChar >> replacementChar;
 
-                    temp = lines;
-
-                    for (std::string& line : lines)
-                    {
-                        std::ranges::replace(line, targetChar, replacementChar);
-                        std::cout << line << '\n';
-                    }
-
-                    // for (auto& line : lines)
-                    // {
-                    //     std::string temp = line;
-
-                    //     for (auto& character : temp)
-                    //     {
-                    //         if (std::isupper(character) && std::tolower(character) == std::tolower(targetChar))
-                    //         {
-                    //             std::cout << static_cast<char>(std::toupper(replacementChar));
-                    //         }
-                    //         else if (std::islower(character) && std::tolower(character) == std::tolower(targetChar))
-                    //         {
-                    //             std::cout << static_cast<char>(std::tolower(replacementChar));
-                    //         }
-                    //         else
-                    //         {
-                    //             std::cout << character;
-                    //         }
-                    //     }
-                    //     std::cout << '\n';
-                    // }
+                    temp = pipeline;
+                    pipeline.Replace(targetChar, replacementChar);
                 }
                 else
                 {
-                    lines = temp;
-                    for (const std::string& line : lines)
-                    {
-                        std::cout << line << '\n';
-                    }
-
-                    // for (auto& line : lines)
-                    // {
-                    //     std::cout << line << '\n';
-                    // }
+                    pipeline = temp;
                 }
 
+                Commit("g");
                 break;
             }
             case 'h':
@@ -234,19 +328,35 @@ int main()
                 static bool trigger = false;
                 trigger = !trigger;
 
-                for (auto& line : lines)
+                if (!trigger)
+                {
+                    Measure("h", [] { Print(std::cout, pipeline); });
+                    break;
+                }
+
+                Measure("h", []
                 {
-                    for (auto& character : line)
+                    Process(std::cout, [](const std::size_t lineBegin_, const std::size_t lineEnd_, std::string& output_)
                     {
-                        std::cout << character;
+                        std::string content;
 
-                        if (trigger && std::isdigit(character))
+                        for (std::size_t line = lineBegin_; line < lineEnd_; ++line)
                         {
-                            std::cout << '\n';
+                            ReadLine(line, content);
+
+                            for (const char character : content)
+                            {
+                                output_.push_back(character);
+
+                                if (std::isdigit(static_cast<unsigned char>(character)))
+                                {
+                                    output_.push_back('\n');
+                                }
+                            }
+                            output_.push_back('\n');
                         }
-                    }
-                    std::cout << '\n';
-                }
+                    });
+                });
 
                 break;
             }
@@ -264,109 +374,175 @@ int main()
 
                 struct Test
                 {
-                    std::string content;
+                    std::size_t line;
                     std::size_t alphabetCount;
                 };
 
-                std::vector<Test> tests;
-
-                for (auto& line : lines)
+                Measure("i", []
                 {
-                    for (auto character : line)
+                    // 1. 줄마다 알파벳 수를 병렬로 셉니다. 치환은 알파벳 여부를 바꿀 수 있으므로 변환한 줄에서 셉니다.
+                    std::vector<std::size_t> alphabetCounts(text.GetLineCount());
+
+                    ForEachLines([&](const std::size_t lineBegin_, const std::size_t lineEnd_)
                     {
-                        if (std::isalpha(character))
+                        std::string content;
+
+                        for (std::size_t line = lineBegin_; line < lineEnd_; ++line)
                         {
-                            if (tests.empty() || tests.back().content != line)
-                            {
-                                tests.push_back({ line, 1 });
-                            }
-                            else
+                            ReadLine(line, content);
+                            alphabetCounts[line] = std::ranges::count_if(content, [](const unsigned char c)
                             {
-                                ++tests.back().alphabetCount;
-                            }
+                                return std::isalpha(c);
+                            });
                         }
-                    }
-                }
+                    });
 
-                switch (sortType)
-                {
-                    case Ascending:
-                    {
-                        std::ranges::sort(tests.begin(), tests.end(),
-                            [](const Test& a, const Test& b) {
-                                return a.alphabetCount < b.alphabetCount;
-                            });
-                        break;
-                    }
-                    case Descending:
-                    {
-                        std::ranges::sort(tests.begin(), tests.end(),
-                            [](const Test& a, const Test& b) {
-                                return a.alphabetCount > b.alphabetCount;
-                            });
-                        break;
-                    }
-                    case None:
+                    // 2. 알파벳이 있는 줄만 모읍니다. 바로 앞 줄과 내용이 같다면 한 줄로 합쳐 셉니다.
+                    std::vector<Test> tests;
+                    std::string       previous;
+                    std::string       current;
+
+                    for (std::size_t line = 0; line < alphabetCounts.size(); ++line)
                     {
-                        break;
+                        if (alphabetCounts[line] == 0)
+                        {
+                            continue;
+                        }
+
+                        ReadLine(line, current);
+                        if (tests.empty() || previous != current)
+                        {
+                            tests.push_back({ line, alphabetCounts[line] });
+                            std::swap(previous, current);
+                        }
+                        else
+                        {
+                            tests.back().alphabetCount += alphabetCounts[line];
+                        }
                     }
-                }
 
-                for (const auto& [content, alphabetCount] : tests)
-                {
-                    if (sortType != None)
+                    switch (sortType)
                     {
-                        std::cout << content << " (" << alphabetCount << ")\n";
+                        case Ascending:
+                        {
+                            std::ranges::sort(tests.begin(), tests.end(),
+                                [](const Test& a, const Test& b) {
+                                    return a.alphabetCount < b.alphabetCount;
+                                });
+                            break;
+                        }
+                        case Descending:
+                        {
+                            std::ranges::sort(tests.begin(), tests.end(),
+                                [](const Test& a, const Test& b) {
+                                    return a.alphabetCount > b.alphabetCount;
+                                });
+                            break;
+                        }
+                        case None:
+                        {
+                            break;
+                        }
                     }
-                    else
+
+                    std::string output;
+                    output.reserve(TextKernel::CHUNK_BYTES);
+
+                    for (const auto& [line, alphabetCount] : tests)
                     {
-                        std::cout << content << '\n';
+                        pipeline.Apply(text.GetLine(line), output);
+
+                        if (sortType != None)
+                        {
+                            std::format_to(std::back_inserter(output), " ({})\n", alphabetCount);
+                        }
+                        else
+                        {
+                            output.push_back('\n');
+                        }
+
+                        if (output.size() >= TextKernel::CHUNK_BYTES)
+                        {
+                            std::cout.write(output.data(), static_cast<std::streamsize>(output.size()));
+                            output.clear();
+                        }
                     }
-                }
+
+                    std::cout.write(output.data(), static_cast<std::streamsize>(output.size()));
+                    std::cout.flush();
+                });
 
                 break;
             }
             case 'j':
             {
-                std::string targetWord;
-                std::size_t wordCount  = 0;
+                std::string              targetWord;
+                std::atomic<std::size_t> wordCount = 0;
                 std::cin >> targetWord;
 
-                for (const std::string& line : lines)
+                Measure("j", [&]
                 {
-                    std::stringstream ss(line);
-                    std::string word;
-
-                    while (ss >> word)
+                    Process(std::cout, [&](const std::size_t lineBegin_, const std::size_t lineEnd_, std::string& output_)
                     {
-                        std::string temp1 = word;
-                        std::ranges::transform(temp1 , temp1.begin(), [](const unsigned char c)
-                        {
-                            return std::tolower(c);
-                        });
-
-                        std::string temp2 = targetWord;
-                        std::ranges::transform(temp2, temp2.begin(), [](const unsigned char c)
-                        {
-                            return std::tolower(c);
-                        });
+                        std::string content;
+                        std::size_t count = 0;
 
-                        if (temp1 == temp2)
+                        for (std::size_t line = lineBegin_; line < lineEnd_; ++line)
                         {
-                            std::cout << "\033[32m" << word << "\033[0m ";
-                            wordCount++;
-                            continue;
+                            ReadLine(line, content);
+                            ForEachWord(content, [&](const std::string_view word_)
+                            {
+                                if (EqualsIgnoreCase(word_, targetWord))
+                                {
+                                    output_.append("\033[32m").append(word_).append("\033[0m ");
+                                    ++count;
+                                    return;
+                                }
+
+                                output_.append(word_).push_back(' ');
+                            });
+                            output_.push_back('\n');
                         }
 
-                        std::cout << word << " ";
-                    }
-                    std::cout << '\n';
-                }
+                        wordCount += count;
+                    });
+                });
 
                 std::cout << "targetWord: " << wordCount << '\n';
 
                 break;
             }
+            case 'l':
+            {
+                isLazy = !isLazy;
+                std::cout << "Lazy mode: " << (isLazy ? "on" : "off") << '\n';
+
+                break;
+            }
+            case 'p':
+            {
+                std::cerr << std::format("[p] {} transforms in {} pass(es)\n", pipeline.GetTransformCount(), pipeline.GetPassCount());
+                Measure("p", [] { Print(std::cout, pipeline); });
+
+                break;
+            }
+            case 's':
+            {
+                std::string path;
+                std::cin >> path;
+
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                if (not file)
+                {
+                    std::cout << "Failed to open the file: " << path << '\n';
+                    break;
+                }
+
+                Measure("s", [&] { Print(file, pipeline); });
+                std::cout << "Saved to " << path << '\n';
+
+                break;
+            }
             case 'q':
             {
                 isRunning = false;
@@ -379,6 +555,6 @@ int main()
         }
     }
 
-    file.close();
+    text.Close();
     return 0;
 }
\ No newline at end of file
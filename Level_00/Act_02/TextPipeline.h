@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 줄 단위 변환들을 쌓아 두었다가, 줄을 출력하거나 저장할 때 한 번에 적용하는 지연 파이프라인.
+//
+// 문자 단위 변환(치환, 대문자)은 256칸 표 하나로 합성됩니다. 뒤집기는 문자 치환과 순서를 바꿔도 결과가 같고,
+// "어떤 문자를 포함하면 뒤집기"의 조건도 문자의 순서와 무관하므로 원래 문자에 대한 조건으로 옮길 수 있습니다.
+// 따라서 변환을 몇 개 쌓든 줄마다 표를 한 번 훑고, 뒤집을 횟수의 홀짝에 따라 한 번 뒤집으면 됩니다.
+class TextPipeline final
+{
+public:
+    TextPipeline() noexcept
+    {
+        Reset();
+    }
+
+    // 모든 변환을 지웁니다.
+    void Reset() noexcept
+    {
+        passes.assign(1, Pass());
+        transformCount = 0;
+    }
+
+    [[nodiscard]]
+    bool IsIdentity() const noexcept
+    {
+        return passes.size() == 1 && passes.front().IsIdentity();
+    }
+
+    // 지금까지 쌓인 변환의 수.
+    [[nodiscard]]
+    std::size_t GetTransformCount() const noexcept
+    {
+        return transformCount;
+    }
+
+    // 줄마다 훑는 횟수. 조건부 뒤집기가 MAX_CONDITIONS개를 넘을 때만 늘어납니다.
+    [[nodiscard]]
+    std::size_t GetPassCount() const noexcept
+    {
+        return IsIdentity() ? 0 : passes.size();
+    }
+
+    // 모든 from_을 to_로 바꿉니다.
+    void Replace(const char from_, const char to_) noexcept
+    {
+        Pass& pass = passes.back();
+        std::ranges::replace(pass.table, static_cast<unsigned char>(from_), static_cast<unsigned char>(to_));
+        pass.UpdateMapped();
+
+        ++transformCount;
+    }
+
+    void ToUpper() noexcept
+    {
+        Pass& pass = passes.back();
+        for (unsigned char& value : pass.table)
+        {
+            value = static_cast<unsigned char>(std::toupper(value));
+        }
+        pass.UpdateMapped();
+
+        ++transformCount;
+    }
+
+    void Reverse() noexcept
+    {
+        passes.back().isReversed = !passes.back().isReversed;
+
+        ++transformCount;
+    }
+
+    // chars_ 중 하나라도 포함하는 줄만 뒤집습니다.
+    void ReverseIf(const std::string_view chars_) noexcept
+    {
+        ++transformCount;
+
+        // 이 시점까지의 치환을 거쳐 chars_ 중 하나가 되는 원래 문자들의 집합.
+        std::bitset<256> condition;
+        for (std::size_t value = 0; value < 256; ++value)
+        {
+            condition[value] = chars_.find(static_cast<char>(passes.back().table[value])) != std::string_view::npos;
+        }
+
+        if (condition.none())
+        {
+            return;
+        }
+
+        // 같은 조건으로 두 번 뒤집으면 원래대로 돌아옵니다.
+        std::vector<std::bitset<256>>& conditions = passes.back().conditions;
+        if (const auto iter = std::ranges::find(conditions, condition); iter != conditions.end())
+        {
+            conditions.erase(iter);
+            passes.back().UpdateConditionBits();
+            return;
+        }
+
+        // 조건 비트가 가득 찼다면 새 패스를 시작합니다. 새 패스의 표는 항등이므로 조건을 그대로 씁니다.
+        if (conditions.size() == MAX_CONDITIONS)
+        {
+            passes.emplace_back();
+            ReverseIf(chars_);
+            --transformCount;
+            return;
+        }
+
+        conditions.push_back(condition);
+        passes.back().UpdateConditionBits();
+    }
+
+    // line_에 모든 변환을 적용한 결과를 output_ 뒤에 붙입니다. 여러 스레드에서 동시에 호출해도 됩니다.
+    void Apply(const std::string_view line_, std::string& output_) const noexcept
+    {
+        const std::size_t begin = output_.size();
+        output_.append(line_);
+
+        char* const first = output_.data() + begin;
+        char* const last  = first + line_.size();
+
+        for (const Pass& pass : passes)
+        {
+            pass.Apply(first, last);
+        }
+    }
+
+private:
+    // 한 패스가 담을 수 있는 조건부 뒤집기의 수. 문자마다 조건 비트를 64비트 하나에 모읍니다.
+    static constexpr std::size_t MAX_CONDITIONS = 64;
+
+    // 줄을 한 번 훑으며 적용하는 변환 묶음.
+    struct Pass final
+    {
+        Pass() noexcept
+        {
+            std::iota(table.begin(), table.end(), static_cast<unsigned char>(0));
+        }
+
+        [[nodiscard]]
+        bool IsIdentity() const noexcept
+        {
+            return !isReversed && !isMapped && conditions.empty();
+        }
+
+        void UpdateMapped() noexcept
+        {
+            isMapped = false;
+            for (std::size_t value = 0; value < 256; ++value)
+            {
+                isMapped = isMapped || table[value] != value;
+            }
+        }
+
+        void UpdateConditionBits() noexcept
+        {
+            conditionBits.fill(0);
+
+            for (std::size_t condition = 0; condition < conditions.size(); ++condition)
+            {
+                for (std::size_t value = 0; value < 256; ++value)
+                {
+                    if (conditions[condition][value])
+                    {
+                        conditionBits[value] |= std::uint64_t{ 1 } << condition;
+                    }
+                }
+            }
+        }
+
+        void Apply(char* const first_, char* const last_) const noexcept
+        {
+            std::uint64_t hits = 0;
+
+            if (isMapped || !conditions.empty())
+            {
+                for (char* iter = first_; iter != last_; ++iter)
+                {
+                    const unsigned char value = static_cast<unsigned char>(*iter);
+
+                    hits  |= conditionBits[value];
+                    *iter  = static_cast<char>(table[value]);
+                }
+            }
+
+            // 조건을 만족한 뒤집기의 수가 홀수일 때만 실제로 뒤집힙니다.
+            if (isReversed != (std::popcount(hits) % 2 == 1))
+            {
+                std::reverse(first_, last_);
+            }
+        }
+
+        // 원래 문자 -> 이 패스의 모든 치환을 거친 문자.
+        std::array<unsigned char, 256> table;
+
+        // 원래 문자 -> 그 문자를 포함하면 뒤집히는 조건들의 비트.
+        std::array<std::uint64_t, 256> conditionBits = {};
+
+        // 조건부 뒤집기마다, 뒤집기를 일으키는 원래 문자의 집합.
+        std::vector<std::bitset<256>> conditions;
+
+        // 표가 항등이 아닌지 여부.
+        bool isMapped = false;
+
+        // 조건 없는 뒤집기가 홀수 번 쌓였는지 여부.
+        bool isReversed = false;
+    };
+
+    std::vector<Pass> passes;
+    std::size_t       transformCount = 0;
+};
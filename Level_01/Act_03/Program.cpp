@@ -1,12 +1,150 @@
-﻿#include <ctime>
+﻿#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
 #include <format>
 #include <iostream>
+#include <limits>
 #include <vector>
 
 #include <glad/glad.h>
 #include <glfw/glfw3.h>
 #include <glm/glm.hpp>
 
+/**
+ * @class QuadBatch
+ *
+ * @brief 축 정렬 사각형들을 모아 한 번의 인스턴스 드로우로 그립니다.
+ *
+ * 사각형은 (최소 좌표, 최대 좌표, 색상) 인스턴스로 CPU 스테이징 배열에 추가되고,
+ * Flush 시 한 번 업로드된 뒤 채우기/외곽선 모드 별로 각각 한 번의 인스턴스 드로우로 그려집니다.
+ * 좌표계는 좌하단이 원점인 픽셀 좌표입니다.
+ */
+class QuadBatch final
+{
+public:
+    /**
+     * @brief 그리기 모드를 정의합니다.
+     */
+    enum class Mode : unsigned char
+    {
+        /**
+         * @brief 내부를 채웁니다.
+         */
+        Fill,
+
+        /**
+         * @brief 외곽선만 그립니다.
+         */
+        Outline,
+    };
+
+    /**
+     * @brief 생성자.
+     *
+     * @param viewSize_ 화면 크기.
+     */
+    explicit QuadBatch(const glm::vec2& viewSize_) noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~QuadBatch() noexcept;
+
+    QuadBatch(const QuadBatch&) = delete;
+    QuadBatch& operator=(const QuadBatch&) = delete;
+
+    /**
+     * @brief 사각형을 추가합니다.
+     *
+     * @param min_   최소 좌표.
+     * @param max_   최대 좌표.
+     * @param color_ 색상.
+     * @param mode_  그리기 모드.
+     */
+    inline void Add(const glm::vec2& min_,
+                    const glm::vec2& max_,
+                    const glm::vec4& color_,
+                    const Mode       mode_ = Mode::Fill) noexcept
+    {
+        (mode_ == Mode::Fill ? fills : outlines).push_back({ min_, max_, color_ });
+    }
+
+    /**
+     * @brief 불투명한 사각형을 추가합니다.
+     *
+     * @param min_   최소 좌표.
+     * @param max_   최대 좌표.
+     * @param color_ 색상.
+     * @param mode_  그리기 모드.
+     */
+    inline void Add(const glm::vec2& min_,
+                    const glm::vec2& max_,
+                    const glm::vec3& color_,
+                    const Mode       mode_ = Mode::Fill) noexcept
+    {
+        Add(min_, max_, glm::vec4(color_, 1.0f), mode_);
+    }
+
+    /**
+     * @brief 스테이징 배열의 용량을 미리 확보합니다.
+     *
+     * @param count_ 확보할 사각형 개수.
+     */
+    void Reserve(std::size_t count_) noexcept;
+
+    /**
+     * @brief 추가된 모든 사각형을 업로드하고 그린 뒤 비웁니다.
+     */
+    void Flush() noexcept;
+private:
+    /**
+     * @brief 사각형 하나의 인스턴스 데이터.
+     */
+    struct Instance
+    {
+        glm::vec2 min;
+        glm::vec2 max;
+        glm::vec4 color;
+    };
+
+    /**
+     * @brief 셰이더 프로그램 ID.
+     */
+    GLuint program = 0;
+
+    /**
+     * @brief 정점 배열 객체.
+     */
+    GLuint vao = 0;
+
+    /**
+     * @brief 인스턴스 버퍼 객체.
+     */
+    GLuint vbo = 0;
+
+    /**
+     * @brief 인스턴스 버퍼에 담을 수 있는 사각형 개수.
+     */
+    std::size_t capacity = 0;
+
+    /**
+     * @brief 외곽선 모드 유니폼 위치.
+     */
+    GLint outlineLocation = -1;
+
+    /**
+     * @brief 채우기 모드 사각형들.
+     */
+    std::vector<Instance> fills;
+
+    /**
+     * @brief 외곽선 모드 사각형들.
+     */
+    std::vector<Instance> outlines;
+};
+
 /**
  * @struct Rect
  *
@@ -16,6 +154,56 @@ struct Rect
 {
     static constexpr float SCALE_MULTIPLIER = 25.0f;
 
+    /**
+     * @brief 최소 좌표를 반환합니다.
+     *
+     * @return glm::vec2 최소 좌표.
+     */
+    [[nodiscard]]
+    constexpr inline glm::vec2 GetMin() const noexcept
+    {
+        return min;
+    }
+
+    /**
+     * @brief 최대 좌표를 반환합니다.
+     *
+     * @return glm::vec2 최대 좌표.
+     */
+    [[nodiscard]]
+    constexpr inline glm::vec2 GetMax() const noexcept
+    {
+        return max;
+    }
+
+    /**
+     * @brief 지정한 점이 사각형 안에 있는지 여부를 반환합니다. (경계 포함)
+     *
+     * @param point_ 지정할 점.
+     *
+     * @return bool 포함 여부.
+     */
+    [[nodiscard]]
+    constexpr inline bool Contains(const glm::vec2& point_) const noexcept
+    {
+        return (point_.x >= min.x && point_.x <= max.x) &&
+               (point_.y >= min.y && point_.y <= max.y);
+    }
+
+    /**
+     * @brief 지정한 사각형과 겹치거나 맞닿아 있는지 여부를 반환합니다.
+     *
+     * @param other_ 지정할 사각형.
+     *
+     * @return bool 접촉 여부.
+     */
+    [[nodiscard]]
+    constexpr inline bool IsTouching(const Rect& other_) const noexcept
+    {
+        return !((max.x < other_.min.x || min.x > other_.max.x) ||
+                 (max.y < other_.min.y || min.y > other_.max.y));
+    }
+
     /**
      * @brief 최소 좌표.
      */
@@ -32,6 +220,281 @@ struct Rect
     glm::vec3 color;
 };
 
+/**
+ * @class RectStore
+ *
+ * @brief 사각형들을 슬롯 맵과 균일 격자로 관리하여 O(1) 삭제와 셀 단위 충돌 질의를 제공합니다.
+ *
+ * 사각형은 연속된 배열에 빽빽하게 저장되어 순회와 렌더링에 유리하며, 삭제 시에는 마지막 원소를 빈 자리로 옮깁니다.
+ * 외부에서는 세대 번호가 붙은 핸들로 사각형을 가리키므로 다른 사각형이 추가/삭제되어도 핸들은 무효화되지 않습니다.
+ * 각 사각형은 자신이 걸쳐 있는 격자 셀들에 등록되어, 점/영역 질의는 전체가 아닌 해당 셀들만 검사합니다.
+ */
+class RectStore final
+{
+public:
+    /**
+     * @struct Handle
+     *
+     * @brief 저장된 사각형을 가리키는 핸들.
+     */
+    struct Handle
+    {
+        /**
+         * @brief 슬롯 인덱스.
+         */
+        std::uint32_t index = INVALID_INDEX;
+
+        /**
+         * @brief 슬롯의 세대 번호.
+         */
+        std::uint32_t generation = 0;
+
+        /**
+         * @brief 핸들이 무언가를 가리키고 있는지 여부를 반환합니다.
+         *
+         * @return bool 유효 여부.
+         */
+        [[nodiscard]]
+        constexpr inline bool IsValid() const noexcept
+        {
+            return index != INVALID_INDEX;
+        }
+
+        bool operator==(const Handle&) const = default;
+    };
+
+    /**
+     * @brief 생성자.
+     *
+     * @param min_      격자가 덮는 영역의 최소 좌표.
+     * @param max_      격자가 덮는 영역의 최대 좌표.
+     * @param cellSize_ 셀 한 변의 길이.
+     */
+    explicit RectStore(const glm::vec2& min_,
+                       const glm::vec2& max_,
+                       const float      cellSize_) noexcept;
+
+    /**
+     * @brief 사각형을 추가합니다.
+     *
+     * @param rect_ 추가할 사각형.
+     *
+     * @return Handle 추가된 사각형의 핸들.
+     */
+    Handle Insert(const Rect& rect_) noexcept;
+
+    /**
+     * @brief 사각형을 삭제합니다. 이미 삭제된 핸들은 무시합니다.
+     *
+     * @param handle_ 삭제할 사각형의 핸들.
+     */
+    void Erase(const Handle handle_) noexcept;
+
+    /**
+     * @brief 사각형의 위치나 크기가 바뀐 뒤 등록된 셀을 갱신합니다.
+     *
+     * @param handle_ 갱신할 사각형의 핸들.
+     */
+    void Update(const Handle handle_) noexcept;
+
+    /**
+     * @brief 모든 사각형을 삭제합니다. 기존 핸들은 모두 무효화됩니다.
+     */
+    void Clear() noexcept;
+
+    /**
+     * @brief 지정한 개수만큼의 저장 공간을 미리 확보합니다.
+     *
+     * @param count_ 확보할 사각형 개수.
+     */
+    void Reserve(const std::size_t count_) noexcept;
+
+    /**
+     * @brief 핸들이 가리키는 사각형을 반환합니다.
+     *
+     * @param handle_ 사각형의 핸들.
+     *
+     * @return Rect* 사각형. 삭제된 핸들이라면 nullptr.
+     */
+    [[nodiscard]]
+    Rect* Get(const Handle handle_) noexcept;
+
+    /**
+     * @brief 지정한 영역과 겹치는 셀들에서 조건을 만족하는 첫 사각형을 찾습니다.
+     *
+     * @param min_       영역의 최소 좌표.
+     * @param max_       영역의 최대 좌표.
+     * @param predicate_ 후보 사각형과 핸들을 받아 일치 여부를 반환하는 조건.
+     *
+     * @return Handle 찾은 사각형의 핸들. 없다면 유효하지 않은 핸들.
+     */
+    template <typename Predicate>
+    [[nodiscard]]
+    Handle Find(const glm::vec2& min_,
+                const glm::vec2& max_,
+                Predicate&&      predicate_) const noexcept
+    {
+        const CellRange range = ComputeRange(min_, max_);
+
+        for (int y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int x = range.minX; x <= range.maxX; ++x)
+            {
+                for (const std::uint32_t slot : cells[static_cast<std::size_t>(y) * columns + x])
+                {
+                    const Handle handle = { slot, slots[slot].generation };
+
+                    if (predicate_(rects[slots[slot].dense], handle))
+                    {
+                        return handle;
+                    }
+                }
+            }
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief 저장된 사각형의 개수를 반환합니다.
+     *
+     * @return std::size_t 사각형의 개수.
+     */
+    [[nodiscard]]
+    inline std::size_t Size() const noexcept
+    {
+        return rects.size();
+    }
+
+    [[nodiscard]]
+    inline std::vector<Rect>::const_iterator begin() const noexcept
+    {
+        return rects.begin();
+    }
+
+    [[nodiscard]]
+    inline std::vector<Rect>::const_iterator end() const noexcept
+    {
+        return rects.end();
+    }
+private:
+    /**
+     * @brief 유효하지 않은 인덱스.
+     */
+    static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @struct Slot
+     *
+     * @brief 핸들과 빽빽한 배열 사이의 간접 참조.
+     */
+    struct Slot
+    {
+        /**
+         * @brief 사용 중이라면 빽빽한 배열의 인덱스, 비어 있다면 다음 빈 슬롯의 인덱스.
+         */
+        std::uint32_t dense;
+
+        /**
+         * @brief 세대 번호. 슬롯이 해제될 때마다 증가합니다.
+         */
+        std::uint32_t generation;
+    };
+
+    /**
+     * @struct CellRange
+     *
+     * @brief 사각형이 걸쳐 있는 셀의 범위. (양 끝 포함)
+     */
+    struct CellRange
+    {
+        int minX = 0;
+        int minY = 0;
+        int maxX = -1;
+        int maxY = -1;
+
+        bool operator==(const CellRange&) const = default;
+    };
+
+    /**
+     * @brief 지정한 영역이 걸쳐 있는 셀의 범위를 계산합니다.
+     *
+     * @param min_ 영역의 최소 좌표.
+     * @param max_ 영역의 최대 좌표.
+     *
+     * @return CellRange 셀의 범위.
+     */
+    [[nodiscard]]
+    CellRange ComputeRange(const glm::vec2& min_,
+                           const glm::vec2& max_) const noexcept;
+
+    /**
+     * @brief 지정한 범위의 셀들에 슬롯을 추가합니다.
+     */
+    void Link(const std::uint32_t slot_, const CellRange& range_) noexcept;
+
+    /**
+     * @brief 지정한 범위의 셀들에서 슬롯을 제거합니다.
+     */
+    void Unlink(const std::uint32_t slot_, const CellRange& range_) noexcept;
+
+    /**
+     * @brief 핸들이 가리키는 슬롯이 사용 중인지 여부를 반환합니다.
+     */
+    [[nodiscard]]
+    bool IsAlive(const Handle handle_) const noexcept;
+
+    /**
+     * @brief 빽빽하게 저장된 사각형들.
+     */
+    std::vector<Rect> rects;
+
+    /**
+     * @brief 사각형 별 소유 슬롯. (rects와 같은 순서)
+     */
+    std::vector<std::uint32_t> owners;
+
+    /**
+     * @brief 사각형 별 등록된 셀 범위. (rects와 같은 순서)
+     */
+    std::vector<CellRange> ranges;
+
+    /**
+     * @brief 슬롯들.
+     */
+    std::vector<Slot> slots;
+
+    /**
+     * @brief 첫 번째 빈 슬롯의 인덱스.
+     */
+    std::uint32_t freeHead;
+
+    /**
+     * @brief 격자가 덮는 영역의 최소 좌표.
+     */
+    glm::vec2 origin;
+
+    /**
+     * @brief 셀 한 변의 길이의 역수.
+     */
+    float inverseCellSize;
+
+    /**
+     * @brief 가로 셀 개수.
+     */
+    int columns;
+
+    /**
+     * @brief 세로 셀 개수.
+     */
+    int rows;
+
+    /**
+     * @brief 셀 별로 등록된 슬롯들. (행 우선)
+     */
+    std::vector<std::vector<std::uint32_t>> cells;
+};
+
 /**
  * @brief 윈도우가 그려질 때 호출됩니다.
  */
@@ -102,10 +565,15 @@ constexpr unsigned char CONTEXT_MAJOR_VERSION = 4;
  */
 constexpr unsigned char CONTEXT_MINOR_VERSION = 5;
 
+/**
+ * @brief 사각형 격자의 셀 한 변의 길이.
+ */
+static constexpr float RECT_CELL_SIZE = 50.0f;
+
 /**
  * @brief 사각형들.
  */
-static std::vector<Rect> rects;
+static RectStore rects({ 0.0f, 0.0f }, { WINDOW_WIDTH, WINDOW_HEIGHT }, RECT_CELL_SIZE);
 
 /**
  * @brief 최대 사각형 개수.
@@ -125,7 +593,12 @@ static std::size_t currentCreateCounts = 0;
 /**
  * @brief 현재 선택 중인 사각형.
  */
-static Rect* currentRect = nullptr;
+static RectStore::Handle currentRect;
+
+/**
+ * @brief 사각형 일괄 렌더러.
+ */
+static QuadBatch* quadBatch = nullptr;
 
 int main(int, char**)
 {
@@ -139,7 +612,7 @@ int main(int, char**)
 
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, CONTEXT_MAJOR_VERSION);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, CONTEXT_MINOR_VERSION);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
 
     GLFWwindow* window = glfwCreateWindow(WINDOW_WIDTH,
@@ -167,33 +640,375 @@ int main(int, char**)
     glfwSetMouseButtonCallback(window, OnButtonInteracted);
     glfwSetCursorPosCallback(window, OnCursorMoved);
 
+    quadBatch = new QuadBatch({ WINDOW_WIDTH, WINDOW_HEIGHT });
+
     static double lastTime = glfwGetTime();
     while (!glfwWindowShouldClose(window))
     {
         glfwPollEvents();
         {
-            glMatrixMode(GL_PROJECTION);
-            glLoadIdentity();
-            glOrtho(0, WINDOW_WIDTH, 0, WINDOW_HEIGHT, -1, 1);
-
-            glMatrixMode(GL_MODELVIEW);
-            glLoadIdentity();
-
             glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
             glClear(GL_COLOR_BUFFER_BIT);
 
             for (const auto& [min, max, color] : rects)
             {
-                glColor3f(color.r, color.g, color.b);
-                glRectf(min.x, min.y, max.x, max.y);
+                quadBatch->Add(min, max, color);
             }
+
+            quadBatch->Flush();
         }
         glfwSwapBuffers(window);
     }
 
+    delete quadBatch;
+
     return EXIT_SUCCESS;
 }
 
+RectStore::RectStore(const glm::vec2& min_,
+                     const glm::vec2& max_,
+                     const float      cellSize_) noexcept
+    : freeHead(INVALID_INDEX)
+    , origin(min_)
+    , inverseCellSize(1.0f / cellSize_)
+    , columns(std::max(1, static_cast<int>(std::ceil((max_.x - min_.x) / cellSize_))))
+    , rows(std::max(1, static_cast<int>(std::ceil((max_.y - min_.y) / cellSize_))))
+    , cells(static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows))
+{
+
+}
+
+RectStore::Handle RectStore::Insert(const Rect& rect_) noexcept
+{
+    std::uint32_t slot;
+
+    if (freeHead != INVALID_INDEX)
+    {
+        slot     = freeHead;
+        freeHead = slots[slot].dense;
+    }
+    else
+    {
+        slot = static_cast<std::uint32_t>(slots.size());
+        slots.push_back({ 0, 0 });
+    }
+
+    slots[slot].dense = static_cast<std::uint32_t>(rects.size());
+
+    const CellRange range = ComputeRange(rect_.GetMin(), rect_.GetMax());
+
+    rects.push_back(rect_);
+    owners.push_back(slot);
+    ranges.push_back(range);
+
+    Link(slot, range);
+
+    return { slot, slots[slot].generation };
+}
+
+void RectStore::Erase(const Handle handle_) noexcept
+{
+    if (!IsAlive(handle_))
+    {
+        return;
+    }
+
+    const std::uint32_t dense = slots[handle_.index].dense;
+    const std::uint32_t last  = static_cast<std::uint32_t>(rects.size() - 1);
+
+    Unlink(handle_.index, ranges[dense]);
+
+    // 마지막 사각형을 빈 자리로 옮겨 배열을 빽빽하게 유지합니다.
+    if (dense != last)
+    {
+        rects[dense]  = rects[last];
+        owners[dense] = owners[last];
+        ranges[dense] = ranges[last];
+
+        slots[owners[dense]].dense = dense;
+    }
+
+    rects.pop_back();
+    owners.pop_back();
+    ranges.pop_back();
+
+    slots[handle_.index].dense = freeHead;
+    ++slots[handle_.index].generation;
+    freeHead = handle_.index;
+}
+
+void RectStore::Update(const Handle handle_) noexcept
+{
+    if (!IsAlive(handle_))
+    {
+        return;
+    }
+
+    const std::uint32_t dense = slots[handle_.index].dense;
+    const CellRange     range = ComputeRange(rects[dense].GetMin(), rects[dense].GetMax());
+
+    if (range == ranges[dense])
+    {
+        return;
+    }
+
+    Unlink(handle_.index, ranges[dense]);
+    Link(handle_.index, range);
+
+    ranges[dense] = range;
+}
+
+void RectStore::Clear() noexcept
+{
+    // 슬롯은 재사용하되 세대를 올려 이전 핸들이 새 사각형을 가리키지 않도록 합니다.
+    for (const std::uint32_t slot : owners)
+    {
+        slots[slot].dense = freeHead;
+        ++slots[slot].generation;
+        freeHead = slot;
+    }
+
+    rects.clear();
+    owners.clear();
+    ranges.clear();
+
+    for (std::vector<std::uint32_t>& cell : cells)
+    {
+        cell.clear();
+    }
+}
+
+void RectStore::Reserve(const std::size_t count_) noexcept
+{
+    rects.reserve(count_);
+    owners.reserve(count_);
+    ranges.reserve(count_);
+    slots.reserve(count_);
+}
+
+Rect* RectStore::Get(const Handle handle_) noexcept
+{
+    if (!IsAlive(handle_))
+    {
+        return nullptr;
+    }
+
+    return &rects[slots[handle_.index].dense];
+}
+
+RectStore::CellRange RectStore::ComputeRange(const glm::vec2& min_,
+                                             const glm::vec2& max_) const noexcept
+{
+    // 격자 밖의 좌표는 가장자리 셀로 모읍니다.
+    const auto toCell = [this](const float value_, const float origin_, const int count_) -> int
+    {
+        const int cell = static_cast<int>(std::floor((value_ - origin_) * inverseCellSize));
+        return std::clamp(cell, 0, count_ - 1);
+    };
+
+    CellRange range;
+    range.minX = toCell(min_.x, origin.x, columns);
+    range.minY = toCell(min_.y, origin.y, rows);
+    range.maxX = toCell(max_.x, origin.x, columns);
+    range.maxY = toCell(max_.y, origin.y, rows);
+
+    return range;
+}
+
+void RectStore::Link(const std::uint32_t slot_, const CellRange& range_) noexcept
+{
+    for (int y = range_.minY; y <= range_.maxY; ++y)
+    {
+        for (int x = range_.minX; x <= range_.maxX; ++x)
+        {
+            cells[static_cast<std::size_t>(y) * columns + x].push_back(slot_);
+        }
+    }
+}
+
+void RectStore::Unlink(const std::uint32_t slot_, const CellRange& range_) noexcept
+{
+    for (int y = range_.minY; y <= range_.maxY; ++y)
+    {
+        for (int x = range_.minX; x <= range_.maxX; ++x)
+        {
+            std::vector<std::uint32_t>& cell = cells[static_cast<std::size_t>(y) * columns + x];
+
+            if (const auto iter = std::ranges::find(cell, slot_); iter != cell.end())
+            {
+                *iter = cell.back();
+                cell.pop_back();
+            }
+        }
+    }
+}
+
+bool RectStore::IsAlive(const Handle handle_) const noexcept
+{
+    return handle_.index < slots.size() &&
+           slots[handle_.index].generation == handle_.generation;
+}
+
+QuadBatch::QuadBatch(const glm::vec2& viewSize_) noexcept
+{
+    // 인스턴스 하나 당 4개의 정점을 gl_VertexID로 모서리에 대응시킵니다.
+    constexpr const char* const vertexSource = R"(#version 450 core
+        layout (location = 0) in vec2 aMin;
+        layout (location = 1) in vec2 aMax;
+        layout (location = 2) in vec4 aColor;
+
+        uniform vec2 u_ViewSize;
+        uniform bool u_Outline;
+
+        out vec4 vColor;
+
+        const vec2 FILL_CORNERS[4]    = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(0.0, 1.0), vec2(1.0, 1.0));
+        const vec2 OUTLINE_CORNERS[4] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));
+
+        void main()
+        {
+            const vec2 corner   = u_Outline ? OUTLINE_CORNERS[gl_VertexID] : FILL_CORNERS[gl_VertexID];
+            const vec2 position = mix(aMin, aMax, corner);
+
+            gl_Position = vec4(position / u_ViewSize * 2.0 - 1.0, 0.0, 1.0);
+            vColor      = aColor;
+        })";
+
+    constexpr const char* const fragmentSource = R"(#version 450 core
+        in vec4 vColor;
+
+        out vec4 FragColor;
+
+        void main()
+        {
+            FragColor = vColor;
+        })";
+
+    GLint success;
+    char infoLog[512];
+
+    const GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexSource, nullptr);
+    glCompileShader(vertexShader);
+    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(vertexShader, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Vertex shader compilation failed: " << infoLog << '\n';
+    }
+
+    const GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentSource, nullptr);
+    glCompileShader(fragmentShader);
+    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(fragmentShader, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Fragment shader compilation failed: " << infoLog << '\n';
+    }
+
+    program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        glGetProgramInfoLog(program, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Shader program linking failed: " << infoLog << '\n';
+    }
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    glUseProgram(program);
+    glUniform2f(glGetUniformLocation(program, "u_ViewSize"), viewSize_.x, viewSize_.y);
+    outlineLocation = glGetUniformLocation(program, "u_Outline");
+
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, min)));
+    glEnableVertexAttribArray(0);
+    glVertexAttribDivisor(0, 1);
+
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, max)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, color)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+QuadBatch::~QuadBatch() noexcept
+{
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteProgram(program);
+}
+
+void QuadBatch::Reserve(const std::size_t count_) noexcept
+{
+    fills.reserve(count_);
+}
+
+void QuadBatch::Flush() noexcept
+{
+    const std::size_t count = fills.size() + outlines.size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    if (count > capacity)
+    {
+        capacity = count;
+    }
+
+    // 이전 프레임이 아직 읽고 있을 수 있으므로 저장 공간을 고아로 만든 뒤 한 번에 기록합니다.
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(capacity * sizeof(Instance)), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(fills.size() * sizeof(Instance)), fills.data());
+    glBufferSubData(GL_ARRAY_BUFFER,
+                    static_cast<GLintptr>(fills.size() * sizeof(Instance)),
+                    static_cast<GLsizeiptr>(outlines.size() * sizeof(Instance)),
+                    outlines.data());
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glUseProgram(program);
+    glBindVertexArray(vao);
+
+    if (!fills.empty())
+    {
+        glUniform1i(outlineLocation, GL_FALSE);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(fills.size()));
+    }
+
+    if (!outlines.empty())
+    {
+        glUniform1i(outlineLocation, GL_TRUE);
+        glDrawArraysInstancedBaseInstance(GL_LINE_LOOP,
+                                          0,
+                                          4,
+                                          static_cast<GLsizei>(outlines.size()),
+                                          static_cast<GLuint>(fills.size()));
+    }
+
+    glBindVertexArray(0);
+
+    fills.clear();
+    outlines.clear();
+}
+
 void OnKeyInteracted(GLFWwindow* window_,
                      int         key_,
                      int         scancode_,
@@ -210,7 +1025,7 @@ void OnKeyInteracted(GLFWwindow* window_,
         case 'a': [[fallthrough]];
         case 'A':
         {
-            if (rects.size() >= MAX_RECT_COUNTS ||
+            if (rects.Size() >= MAX_RECT_COUNTS ||
                 currentCreateCounts + 1 > CREATE_RECT_COUNTS)
             {
                 return;
@@ -226,7 +1041,7 @@ void OnKeyInteracted(GLFWwindow* window_,
                                       static_cast<float>(std::rand() % 256) / 255.0f,
                                       static_cast<float>(std::rand() % 256) / 255.0f };
 
-            rects.push_back({ min, max, color });
+            rects.Insert({ min, max, color });
             currentCreateCounts++;
 
             std::cout << std::format("[Info] new rectangle created at ({:.1f}, {:.1f}) ", currentPosition.x, currentPosition.y);
@@ -260,87 +1075,70 @@ void OnButtonInteracted(GLFWwindow* window_,
     double mouseY;
     glfwGetCursorPos(window_, &mouseX, &mouseY);
 
-    float fixedY = static_cast<float>(height - mouseY);
+    const glm::vec2 point = { static_cast<float>(mouseX), static_cast<float>(height - mouseY) };
+
+    // 커서 아래의 사각형은 커서가 속한 셀만 검사하여 찾습니다.
+    const auto isUnderCursor = [&point](const Rect& rect_, RectStore::Handle)
+    {
+        return rect_.Contains(point);
+    };
 
     if (button_ == GLFW_MOUSE_BUTTON_LEFT)
     {
         if (action_ == GLFW_PRESS)
         {
-            for (auto& rect : rects)
+            currentRect = rects.Find(point, point, isUnderCursor);
+            if (currentRect.IsValid())
             {
-                if ((mouseX >= rect.min.x && mouseX <= rect.max.x) &&
-                    (fixedY >= rect.min.y && fixedY <= rect.max.y))
-                {
-                    currentRect = &rect;
-                    std::cout << "[Info] The rectangle selected!\n";
-                    break;
-                }
+                std::cout << "[Info] The rectangle selected!\n";
             }
         }
         else if (action_ == GLFW_RELEASE)
         {
-            auto toErase = rects.end();
-
-            for (auto iter = rects.begin(); iter != rects.end(); ++iter)
+            Rect* const current = rects.Get(currentRect);
+            if (current == nullptr)
             {
-                if (&(*iter) == currentRect)
-                {
-                    continue;
-                }
-
-                if (!((currentRect->max.x < iter->min.x || currentRect->min.x > iter->max.x) ||
-                      (currentRect->max.y < iter->min.y || currentRect->min.y > iter->max.y)))
-                {
-                    const glm::vec2 newMin   = { std::min(currentRect->min.x, iter->min.x),
-                                                 std::min(currentRect->min.y, iter->min.y) };
-                    const glm::vec2 newMax   = { std::max(currentRect->max.x, iter->max.x),
-                                                 std::max(currentRect->max.y, iter->max.y) };
-                    const glm::vec3 newColor = { static_cast<float>(std::rand() % 256) / 255.0f,
-                                                 static_cast<float>(std::rand() % 256) / 255.0f,
-                                                 static_cast<float>(std::rand() % 256) / 255.0f };
-
-                    currentRect->min   = newMin;
-                    currentRect->max   = newMax;
-                    currentRect->color = newColor;
-
-                    toErase = iter;
-                    break;
-                }
+                return;
             }
 
-            if (toErase != rects.end())
+            const RectStore::Handle other = rects.Find(current->min, current->max, [&current](const Rect& rect_, RectStore::Handle)
             {
-                rects.erase(toErase);
+                return &rect_ != current && current->IsTouching(rect_);
+            });
+
+            if (const Rect* const target = rects.Get(other))
+            {
+                current->min   = { std::min(current->min.x, target->min.x),
+                                   std::min(current->min.y, target->min.y) };
+                current->max   = { std::max(current->max.x, target->max.x),
+                                   std::max(current->max.y, target->max.y) };
+                current->color = { static_cast<float>(std::rand() % 256) / 255.0f,
+                                   static_cast<float>(std::rand() % 256) / 255.0f,
+                                   static_cast<float>(std::rand() % 256) / 255.0f };
+
+                rects.Update(currentRect);
+                rects.Erase(other);
             }
 
-            currentRect = nullptr;
+            currentRect = {};
         }
     }
     else if (button_ == GLFW_MOUSE_BUTTON_RIGHT)
     {
         if (action_ == GLFW_PRESS)
         {
-            if (rects.size() + 2 >= MAX_RECT_COUNTS)
+            if (rects.Size() + 2 >= MAX_RECT_COUNTS)
             {
                 std::cerr << "[Oops!] If you divide rectangle, overflow!\n";
                 return;
             }
 
-            auto toErase = rects.end();
+            const RectStore::Handle toDivide = rects.Find(point, point, isUnderCursor);
 
-            for (auto iter = rects.begin(); iter != rects.end(); ++iter)
+            if (const Rect* const target = rects.Get(toDivide))
             {
-                if ((mouseX >= iter->min.x && mouseX <= iter->max.x) &&
-                    (fixedY >= iter->min.y && fixedY <= iter->max.y))
-                {
-                    toErase = iter;
-                    break;
-                }
-            }
-
-            if (toErase != rects.end())
-            {
-                const Rect original = *toErase;
+                const Rect original = *target;
+                rects.Erase(toDivide);
 
                 const float width  = original.max.x - original.min.x;
                 const float height = original.max.y - original.min.y;
@@ -349,7 +1147,7 @@ void OnButtonInteracted(GLFWwindow* window_,
                 {
                     const float midX = original.min.x + width / 2.0f;
 
-                    rects.push_back({
+                    rects.Insert({
                         {original.min.x, original.min.y},
                         {midX, original.max.y},
                         {static_cast<float>(std::rand() % 256) / 255.0f,
@@ -357,7 +1155,7 @@ void OnButtonInteracted(GLFWwindow* window_,
                          static_cast<float>(std::rand() % 256) / 255.0f}
                     });
 
-                    rects.push_back({
+                    rects.Insert({
                         {midX, original.min.y},
                         {original.max.x, original.max.y},
                         {static_cast<float>(std::rand() % 256) / 255.0f,
@@ -369,7 +1167,7 @@ void OnButtonInteracted(GLFWwindow* window_,
                 {
                     const float midY = original.min.y + height / 2.0f;
 
-                    rects.push_back({
+                    rects.Insert({
                         {original.min.x, original.min.y},
                         {original.max.x, midY},
                         {static_cast<float>(std::rand() % 256) / 255.0f,
@@ -377,7 +1175,7 @@ void OnButtonInteracted(GLFWwindow* window_,
                          static_cast<float>(std::rand() % 256) / 255.0f}
                     });
 
-                    rects.push_back({
+                    rects.Insert({
                         {original.min.x, midY},
                         {original.max.x, original.max.y},
                         {static_cast<float>(std::rand() % 256) / 255.0f,
@@ -387,7 +1185,6 @@ void OnButtonInteracted(GLFWwindow* window_,
                 }
 
                 std::cout << "[Info] Rectangle divided into two new rectangles!\n";
-                rects.erase(toErase);
             }
         }
     }
@@ -397,7 +1194,8 @@ void OnCursorMoved(GLFWwindow* window_,
                    double      x_,
                    double      y_)
 {
-    if (currentRect == nullptr)
+    Rect* const current = rects.Get(currentRect);
+    if (current == nullptr)
     {
         return;
     }
@@ -409,11 +1207,13 @@ void OnCursorMoved(GLFWwindow* window_,
     float fixedX = static_cast<float>(x_);
     float fixedY = static_cast<float>(height - y_);
 
-    const float rectWidth  = currentRect->max.x - currentRect->min.x;
-    const float rectHeight = currentRect->max.y - currentRect->min.y;
+    const float rectWidth  = current->max.x - current->min.x;
+    const float rectHeight = current->max.y - current->min.y;
+
+    current->min = { fixedX - rectWidth / 2.0f, fixedY - rectHeight / 2.0f };
+    current->max = { fixedX + rectWidth / 2.0f, fixedY + rectHeight / 2.0f };
 
-    currentRect->min = { fixedX - rectWidth / 2.0f, fixedY - rectHeight / 2.0f };
-    currentRect->max = { fixedX + rectWidth / 2.0f, fixedY + rectHeight / 2.0f };
+    rects.Update(currentRect);
 
     std::cout << std::format("[Info] Current Position: ({:.1f}, {:.1f})\n", fixedX, fixedY);
 }
\ No newline at end of file
@@ -1,10 +1,145 @@
-﻿#include <iostream>
+﻿#include <cstddef>
+#include <ctime>
+#include <iostream>
 #include <vector>
 
 #include <glad/glad.h>
 #include <glfw/glfw3.h>
 #include <glm/glm.hpp>
 
+/**
+ * @class QuadBatch
+ *
+ * @brief 축 정렬 사각형들을 모아 한 번의 인스턴스 드로우로 그립니다.
+ *
+ * 사각형은 (최소 좌표, 최대 좌표, 색상) 인스턴스로 CPU 스테이징 배열에 추가되고,
+ * Flush 시 한 번 업로드된 뒤 채우기/외곽선 모드 별로 각각 한 번의 인스턴스 드로우로 그려집니다.
+ * 좌표계는 좌하단이 원점인 픽셀 좌표입니다.
+ */
+class QuadBatch final
+{
+public:
+    /**
+     * @brief 그리기 모드를 정의합니다.
+     */
+    enum class Mode : unsigned char
+    {
+        /**
+         * @brief 내부를 채웁니다.
+         */
+        Fill,
+
+        /**
+         * @brief 외곽선만 그립니다.
+         */
+        Outline,
+    };
+
+    /**
+     * @brief 생성자.
+     *
+     * @param viewSize_ 화면 크기.
+     */
+    explicit QuadBatch(const glm::vec2& viewSize_) noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~QuadBatch() noexcept;
+
+    QuadBatch(const QuadBatch&) = delete;
+    QuadBatch& operator=(const QuadBatch&) = delete;
+
+    /**
+     * @brief 사각형을 추가합니다.
+     *
+     * @param min_   최소 좌표.
+     * @param max_   최대 좌표.
+     * @param color_ 색상.
+     * @param mode_  그리기 모드.
+     */
+    inline void Add(const glm::vec2& min_,
+                    const glm::vec2& max_,
+                    const glm::vec4& color_,
+                    const Mode       mode_ = Mode::Fill) noexcept
+    {
+        (mode_ == Mode::Fill ? fills : outlines).push_back({ min_, max_, color_ });
+    }
+
+    /**
+     * @brief 불투명한 사각형을 추가합니다.
+     *
+     * @param min_   최소 좌표.
+     * @param max_   최대 좌표.
+     * @param color_ 색상.
+     * @param mode_  그리기 모드.
+     */
+    inline void Add(const glm::vec2& min_,
+                    const glm::vec2& max_,
+                    const glm::vec3& color_,
+                    const Mode       mode_ = Mode::Fill) noexcept
+    {
+        Add(min_, max_, glm::vec4(color_, 1.0f), mode_);
+    }
+
+    /**
+     * @brief 스테이징 배열의 용량을 미리 확보합니다.
+     *
+     * @param count_ 확보할 사각형 개수.
+     */
+    void Reserve(std::size_t count_) noexcept;
+
+    /**
+     * @brief 추가된 모든 사각형을 업로드하고 그린 뒤 비웁니다.
+     */
+    void Flush() noexcept;
+private:
+    /**
+     * @brief 사각형 하나의 인스턴스 데이터.
+     */
+    struct Instance
+    {
+        glm::vec2 min;
+        glm::vec2 max;
+        glm::vec4 color;
+    };
+
+    /**
+     * @brief 셰이더 프로그램 ID.
+     */
+    GLuint program = 0;
+
+    /**
+     * @brief 정점 배열 객체.
+     */
+    GLuint vao = 0;
+
+    /**
+     * @brief 인스턴스 버퍼 객체.
+     */
+    GLuint vbo = 0;
+
+    /**
+     * @brief 인스턴스 버퍼에 담을 수 있는 사각형 개수.
+     */
+    std::size_t capacity = 0;
+
+    /**
+     * @brief 외곽선 모드 유니폼 위치.
+     */
+    GLint outlineLocation = -1;
+
+    /**
+     * @brief 채우기 모드 사각형들.
+     */
+    std::vector<Instance> fills;
+
+    /**
+     * @brief 외곽선 모드 사각형들.
+     */
+    std::vector<Instance> outlines;
+};
+
 /**
  * @struct Rect
  *
@@ -186,6 +321,16 @@ static bool shouldChangeColor = false;
  */
 static int followTargetIndex = -1;
 
+/**
+ * @brief 'p' 명령어로 한 번에 생성할 사각형 개수.
+ */
+static constexpr std::size_t STRESS_RECT_COUNTS = 1'000'000;
+
+/**
+ * @brief 사각형 일괄 렌더러.
+ */
+static QuadBatch* quadBatch = nullptr;
+
 int main(int    argc_,
          char** argv_)
 {
@@ -199,7 +344,7 @@ int main(int    argc_,
 
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, CONTEXT_MAJOR_VERSION);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, CONTEXT_MINOR_VERSION);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
 
     GLFWwindow* window = glfwCreateWindow(WINDOW_WIDTH,
@@ -227,6 +372,8 @@ int main(int    argc_,
     glfwSetMouseButtonCallback(window, OnButtonInteracted);
     glfwSetCursorPosCallback(window, OnCursorMoved);
 
+    quadBatch = new QuadBatch({ WINDOW_WIDTH, WINDOW_HEIGHT });
+
     static double lastTime = glfwGetTime();
     while (!glfwWindowShouldClose(window))
     {
@@ -244,32 +391,182 @@ int main(int    argc_,
         glfwSwapBuffers(window);
     }
 
+    delete quadBatch;
+
     return 0;
 }
 
-void Draw(const Rect& rect_,
-          bool        shouldFill_) noexcept
+QuadBatch::QuadBatch(const glm::vec2& viewSize_) noexcept
 {
-    glBegin(shouldFill_ ? GL_QUADS : GL_LINE_LOOP);
+    // 인스턴스 하나 당 4개의 정점을 gl_VertexID로 모서리에 대응시킵니다.
+    constexpr const char* const vertexSource = R"(#version 450 core
+        layout (location = 0) in vec2 aMin;
+        layout (location = 1) in vec2 aMax;
+        layout (location = 2) in vec4 aColor;
+
+        uniform vec2 u_ViewSize;
+        uniform bool u_Outline;
+
+        out vec4 vColor;
+
+        const vec2 FILL_CORNERS[4]    = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(0.0, 1.0), vec2(1.0, 1.0));
+        const vec2 OUTLINE_CORNERS[4] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));
+
+        void main()
+        {
+            const vec2 corner   = u_Outline ? OUTLINE_CORNERS[gl_VertexID] : FILL_CORNERS[gl_VertexID];
+            const vec2 position = mix(aMin, aMax, corner);
+
+            gl_Position = vec4(position / u_ViewSize * 2.0 - 1.0, 0.0, 1.0);
+            vColor      = aColor;
+        })";
+
+    constexpr const char* const fragmentSource = R"(#version 450 core
+        in vec4 vColor;
+
+        out vec4 FragColor;
+
+        void main()
+        {
+            FragColor = vColor;
+        })";
+
+    GLint success;
+    char infoLog[512];
+
+    const GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexSource, nullptr);
+    glCompileShader(vertexShader);
+    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(vertexShader, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Vertex shader compilation failed: " << infoLog << '\n';
+    }
+
+    const GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentSource, nullptr);
+    glCompileShader(fragmentShader);
+    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(fragmentShader, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Fragment shader compilation failed: " << infoLog << '\n';
+    }
+
+    program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
     {
-        glColor3f(rect_.color.r,rect_.color.g, rect_.color.b);
-        glVertex2f(rect_.min.x, rect_.min.y);
-        glVertex2f(rect_.max.x, rect_.min.y);
-        glVertex2f(rect_.max.x, rect_.max.y);
-        glVertex2f(rect_.min.x, rect_.max.y);
+        glGetProgramInfoLog(program, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Shader program linking failed: " << infoLog << '\n';
     }
-    glEnd();
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    glUseProgram(program);
+    glUniform2f(glGetUniformLocation(program, "u_ViewSize"), viewSize_.x, viewSize_.y);
+    outlineLocation = glGetUniformLocation(program, "u_Outline");
+
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, min)));
+    glEnableVertexAttribArray(0);
+    glVertexAttribDivisor(0, 1);
+
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, max)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, color)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void OnRender() noexcept
+QuadBatch::~QuadBatch() noexcept
 {
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    glOrtho(0.0, WINDOW_WIDTH, 0.0, WINDOW_HEIGHT, -1, 1);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteProgram(program);
+}
+
+void QuadBatch::Reserve(const std::size_t count_) noexcept
+{
+    fills.reserve(count_);
+}
+
+void QuadBatch::Flush() noexcept
+{
+    const std::size_t count = fills.size() + outlines.size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    if (count > capacity)
+    {
+        capacity = count;
+    }
+
+    // 이전 프레임이 아직 읽고 있을 수 있으므로 저장 공간을 고아로 만든 뒤 한 번에 기록합니다.
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(capacity * sizeof(Instance)), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(fills.size() * sizeof(Instance)), fills.data());
+    glBufferSubData(GL_ARRAY_BUFFER,
+                    static_cast<GLintptr>(fills.size() * sizeof(Instance)),
+                    static_cast<GLsizeiptr>(outlines.size() * sizeof(Instance)),
+                    outlines.data());
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glUseProgram(program);
+    glBindVertexArray(vao);
+
+    if (!fills.empty())
+    {
+        glUniform1i(outlineLocation, GL_FALSE);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(fills.size()));
+    }
+
+    if (!outlines.empty())
+    {
+        glUniform1i(outlineLocation, GL_TRUE);
+        glDrawArraysInstancedBaseInstance(GL_LINE_LOOP,
+                                          0,
+                                          4,
+                                          static_cast<GLsizei>(outlines.size()),
+                                          static_cast<GLuint>(fills.size()));
+    }
+
+    glBindVertexArray(0);
+
+    fills.clear();
+    outlines.clear();
+}
 
-    glMatrixMode(GL_MODELVIEW);
-    glLoadIdentity();
+void Draw(const Rect& rect_,
+          bool        shouldFill_) noexcept
+{
+    quadBatch->Add(rect_.min,
+                   rect_.max,
+                   rect_.color,
+                   shouldFill_ ? QuadBatch::Mode::Fill : QuadBatch::Mode::Outline);
+}
 
+void OnRender() noexcept
+{
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
 
@@ -282,6 +579,8 @@ void OnRender() noexcept
     {
         Draw(*(newRect), false);
     }
+
+    quadBatch->Flush();
 }
 
 void OnUpdate() noexcept
@@ -341,6 +640,11 @@ void OnUpdate() noexcept
     {
         static std::vector<glm::vec2> sizeDirections(rects.size(), glm::vec2(-1.0f, -1.0f));
 
+        if (sizeDirections.size() != rects.size())
+        {
+            sizeDirections.resize(rects.size(), glm::vec2(-1.0f, -1.0f));
+        }
+
         for (std::size_t index = 0; index < rects.size(); ++index)
         {
             const glm::vec2 center = (rects[index].min + rects[index].max) * 0.5f;
@@ -502,6 +806,29 @@ void OnKeyInteracted(GLFWwindow* window_,
             followTargetIndex = followTargetIndex == -1 ? std::rand() % rects.size() : -1;
             break;
         }
+        case 'p': [[fallthrough]];
+        case 'P':
+        {
+            rects.reserve(rects.size() + STRESS_RECT_COUNTS);
+            originalPositions.reserve(originalPositions.size() + STRESS_RECT_COUNTS);
+
+            for (std::size_t count = 0; count < STRESS_RECT_COUNTS; ++count)
+            {
+                const glm::vec2 center = { static_cast<float>(std::rand() % WINDOW_WIDTH),
+                                           static_cast<float>(std::rand() % WINDOW_HEIGHT) };
+                const glm::vec2 half   = { static_cast<float>(std::rand() % 8 + 2),
+                                           static_cast<float>(std::rand() % 8 + 2) };
+                const glm::vec3 color  = { static_cast<float>(std::rand() % 256) / 255.0f,
+                                           static_cast<float>(std::rand() % 256) / 255.0f,
+                                           static_cast<float>(std::rand() % 256) / 255.0f };
+
+                rects.push_back({ center - half, center + half, color });
+                originalPositions.push_back(center);
+            }
+
+            std::cout << "[Info] Total rectangles: " << rects.size() << '\n';
+            break;
+        }
         case 's': [[fallthrough]];
         case 'S':
         {
@@ -1,4 +1,5 @@
-﻿#include <cstdlib>
+﻿#include <cstddef>
+#include <cstdlib>
 #include <ctime>
 #include <iostream>
 #include <vector>
@@ -10,6 +11,139 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/epsilon.hpp>
 
+/**
+ * @class QuadBatch
+ *
+ * @brief 축 정렬 사각형들을 모아 한 번의 인스턴스 드로우로 그립니다.
+ *
+ * 사각형은 (최소 좌표, 최대 좌표, 색상) 인스턴스로 CPU 스테이징 배열에 추가되고,
+ * Flush 시 한 번 업로드된 뒤 채우기/외곽선 모드 별로 각각 한 번의 인스턴스 드로우로 그려집니다.
+ * 좌표계는 좌하단이 원점인 픽셀 좌표입니다.
+ */
+class QuadBatch final
+{
+public:
+    /**
+     * @brief 그리기 모드를 정의합니다.
+     */
+    enum class Mode : unsigned char
+    {
+        /**
+         * @brief 내부를 채웁니다.
+         */
+        Fill,
+
+        /**
+         * @brief 외곽선만 그립니다.
+         */
+        Outline,
+    };
+
+    /**
+     * @brief 생성자.
+     *
+     * @param viewSize_ 화면 크기.
+     */
+    explicit QuadBatch(const glm::vec2& viewSize_) noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~QuadBatch() noexcept;
+
+    QuadBatch(const QuadBatch&) = delete;
+    QuadBatch& operator=(const QuadBatch&) = delete;
+
+    /**
+     * @brief 사각형을 추가합니다.
+     *
+     * @param min_   최소 좌표.
+     * @param max_   최대 좌표.
+     * @param color_ 색상.
+     * @param mode_  그리기 모드.
+     */
+    inline void Add(const glm::vec2& min_,
+                    const glm::vec2& max_,
+                    const glm::vec4& color_,
+                    const Mode       mode_ = Mode::Fill) noexcept
+    {
+        (mode_ == Mode::Fill ? fills : outlines).push_back({ min_, max_, color_ });
+    }
+
+    /**
+     * @brief 불투명한 사각형을 추가합니다.
+     *
+     * @param min_   최소 좌표.
+     * @param max_   최대 좌표.
+     * @param color_ 색상.
+     * @param mode_  그리기 모드.
+     */
+    inline void Add(const glm::vec2& min_,
+                    const glm::vec2& max_,
+                    const glm::vec3& color_,
+                    const Mode       mode_ = Mode::Fill) noexcept
+    {
+        Add(min_, max_, glm::vec4(color_, 1.0f), mode_);
+    }
+
+    /**
+     * @brief 스테이징 배열의 용량을 미리 확보합니다.
+     *
+     * @param count_ 확보할 사각형 개수.
+     */
+    void Reserve(std::size_t count_) noexcept;
+
+    /**
+     * @brief 추가된 모든 사각형을 업로드하고 그린 뒤 비웁니다.
+     */
+    void Flush() noexcept;
+private:
+    /**
+     * @brief 사각형 하나의 인스턴스 데이터.
+     */
+    struct Instance
+    {
+        glm::vec2 min;
+        glm::vec2 max;
+        glm::vec4 color;
+    };
+
+    /**
+     * @brief 셰이더 프로그램 ID.
+     */
+    GLuint program = 0;
+
+    /**
+     * @brief 정점 배열 객체.
+     */
+    GLuint vao = 0;
+
+    /**
+     * @brief 인스턴스 버퍼 객체.
+     */
+    GLuint vbo = 0;
+
+    /**
+     * @brief 인스턴스 버퍼에 담을 수 있는 사각형 개수.
+     */
+    std::size_t capacity = 0;
+
+    /**
+     * @brief 외곽선 모드 유니폼 위치.
+     */
+    GLint outlineLocation = -1;
+
+    /**
+     * @brief 채우기 모드 사각형들.
+     */
+    std::vector<Instance> fills;
+
+    /**
+     * @brief 외곽선 모드 사각형들.
+     */
+    std::vector<Instance> outlines;
+};
+
 /**
  * @struct Rect
  *
@@ -79,22 +213,24 @@ struct Rect
     }
 
     /**
-     * @brief 해당 사각형을 그립니다.
+     * @brief 해당 사각형을 일괄 렌더러에 추가합니다.
+     *
+     * @param batch_ 추가할 일괄 렌더러.
      */
-    void Render() const noexcept
+    void Render(QuadBatch& batch_) const noexcept
     {
-        ::glColor3f(color.r, color.g, color.b);
-        ::glBegin(GL_QUADS);
-        {
-            const glm::vec2 min = Rect::GetMin();
-            const glm::vec2 max = Rect::GetMax();
+        batch_.Add(Rect::GetMin(), Rect::GetMax(), color);
+    }
 
-            glVertex2f(min.x, min.y);
-            glVertex2f(max.x, min.y);
-            glVertex2f(max.x, max.y);
-            glVertex2f(min.x, max.y);
-        }
-        ::glEnd();
+    /**
+     * @brief 해당 사각형이 완전히 줄어들었는지 여부를 반환합니다.
+     *
+     * @return bool 소멸 여부.
+     */
+    [[nodiscard]]
+    inline bool IsVanished() const noexcept
+    {
+        return size.x <= 0.0f || size.y <= 0.0f;
     }
 
     /**
@@ -215,6 +351,16 @@ static glm::vec2 cursorPosition;
  */
 static std::vector<Rect> rects;
 
+/**
+ * @brief 'p' 명령어로 한 번에 생성할 사각형 개수.
+ */
+static constexpr std::size_t STRESS_RECT_COUNTS = 1'000'000;
+
+/**
+ * @brief 사각형 일괄 렌더러.
+ */
+static QuadBatch* quadBatch = nullptr;
+
 int main(int, char**)
 {
     std::srand(static_cast<unsigned int>(std::time(nullptr)));
@@ -240,7 +386,7 @@ int main(int, char**)
 
     ::glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, CONTEXT_MAJOR_VERSION);
     ::glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, CONTEXT_MINOR_VERSION);
-    ::glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
+    ::glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     ::glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
 
     ::GLFWwindow* window = ::glfwCreateWindow(WINDOW_WIDTH,
@@ -268,6 +414,8 @@ int main(int, char**)
     ::glfwSetMouseButtonCallback(window, OnButtonInteracted);
     ::glfwSetCursorPosCallback(window, OnCursorMoved);
 
+    quadBatch = new QuadBatch({ WINDOW_WIDTH, WINDOW_HEIGHT });
+
     float lastTime = static_cast<float>(glfwGetTime());
 
     while (!::glfwWindowShouldClose(window))
@@ -278,29 +426,196 @@ int main(int, char**)
         float deltaTime = currentTime - lastTime;
         lastTime = currentTime;
 
-        ::glMatrixMode(GL_PROJECTION);
-        ::glLoadIdentity();
-        ::glOrtho(0.0, WINDOW_WIDTH, 0.0, WINDOW_HEIGHT, -1, 1);
+        for (Rect& rect : rects)
+        {
+            rect.Update(deltaTime);
+        }
 
-        ::glMatrixMode(GL_MODELVIEW);
-        ::glLoadIdentity();
+        // 완전히 줄어든 사각형은 더 이상 보이지 않으므로 제거합니다.
+        std::erase_if(rects, [](const Rect& rect_)
+        {
+            return rect_.IsVanished();
+        });
 
         ::glClearColor(0.15f, 0.15f, 0.15f, 1.0f);
         ::glClear(GL_COLOR_BUFFER_BIT);
 
-        for (Rect& rect : rects)
+        for (const Rect& rect : rects)
         {
-            rect.Update(deltaTime);
-            rect.Render();
+            rect.Render(*quadBatch);
         }
 
+        quadBatch->Flush();
+
         ::glfwSwapBuffers(window);
     }
 
+    delete quadBatch;
+
     ::glfwTerminate();
     return 0;
 }
 
+QuadBatch::QuadBatch(const glm::vec2& viewSize_) noexcept
+{
+    // 인스턴스 하나 당 4개의 정점을 gl_VertexID로 모서리에 대응시킵니다.
+    constexpr const char* const vertexSource = R"(#version 450 core
+        layout (location = 0) in vec2 aMin;
+        layout (location = 1) in vec2 aMax;
+        layout (location = 2) in vec4 aColor;
+
+        uniform vec2 u_ViewSize;
+        uniform bool u_Outline;
+
+        out vec4 vColor;
+
+        const vec2 FILL_CORNERS[4]    = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(0.0, 1.0), vec2(1.0, 1.0));
+        const vec2 OUTLINE_CORNERS[4] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));
+
+        void main()
+        {
+            const vec2 corner   = u_Outline ? OUTLINE_CORNERS[gl_VertexID] : FILL_CORNERS[gl_VertexID];
+            const vec2 position = mix(aMin, aMax, corner);
+
+            gl_Position = vec4(position / u_ViewSize * 2.0 - 1.0, 0.0, 1.0);
+            vColor      = aColor;
+        })";
+
+    constexpr const char* const fragmentSource = R"(#version 450 core
+        in vec4 vColor;
+
+        out vec4 FragColor;
+
+        void main()
+        {
+            FragColor = vColor;
+        })";
+
+    GLint success;
+    char infoLog[512];
+
+    const GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexSource, nullptr);
+    glCompileShader(vertexShader);
+    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(vertexShader, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Vertex shader compilation failed: " << infoLog << '\n';
+    }
+
+    const GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentSource, nullptr);
+    glCompileShader(fragmentShader);
+    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(fragmentShader, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Fragment shader compilation failed: " << infoLog << '\n';
+    }
+
+    program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        glGetProgramInfoLog(program, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Shader program linking failed: " << infoLog << '\n';
+    }
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    glUseProgram(program);
+    glUniform2f(glGetUniformLocation(program, "u_ViewSize"), viewSize_.x, viewSize_.y);
+    outlineLocation = glGetUniformLocation(program, "u_Outline");
+
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, min)));
+    glEnableVertexAttribArray(0);
+    glVertexAttribDivisor(0, 1);
+
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, max)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, color)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+QuadBatch::~QuadBatch() noexcept
+{
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteProgram(program);
+}
+
+void QuadBatch::Reserve(const std::size_t count_) noexcept
+{
+    fills.reserve(count_);
+}
+
+void QuadBatch::Flush() noexcept
+{
+    const std::size_t count = fills.size() + outlines.size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    if (count > capacity)
+    {
+        capacity = count;
+    }
+
+    // 이전 프레임이 아직 읽고 있을 수 있으므로 저장 공간을 고아로 만든 뒤 한 번에 기록합니다.
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(capacity * sizeof(Instance)), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(fills.size() * sizeof(Instance)), fills.data());
+    glBufferSubData(GL_ARRAY_BUFFER,
+                    static_cast<GLintptr>(fills.size() * sizeof(Instance)),
+                    static_cast<GLsizeiptr>(outlines.size() * sizeof(Instance)),
+                    outlines.data());
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glUseProgram(program);
+    glBindVertexArray(vao);
+
+    if (!fills.empty())
+    {
+        glUniform1i(outlineLocation, GL_FALSE);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(fills.size()));
+    }
+
+    if (!outlines.empty())
+    {
+        glUniform1i(outlineLocation, GL_TRUE);
+        glDrawArraysInstancedBaseInstance(GL_LINE_LOOP,
+                                          0,
+                                          4,
+                                          static_cast<GLsizei>(outlines.size()),
+                                          static_cast<GLuint>(fills.size()));
+    }
+
+    glBindVertexArray(0);
+
+    fills.clear();
+    outlines.clear();
+}
+
 void OnKeyInteracted(GLFWwindow* const window_,
                      const int         key_,
                      const int         scancode_,
@@ -312,6 +627,26 @@ void OnKeyInteracted(GLFWwindow* const window_,
     {
         ::glfwSetWindowShouldClose(window_, true);
     }
+    else if (key_ == GLFW_KEY_P &&
+             action_ == GLFW_PRESS)
+    {
+        rects.reserve(rects.size() + STRESS_RECT_COUNTS);
+
+        for (std::size_t count = 0; count < STRESS_RECT_COUNTS; ++count)
+        {
+            const glm::vec2 currentPosition = { static_cast<float>(std::rand() % WINDOW_WIDTH),
+                                                static_cast<float>(std::rand() % WINDOW_HEIGHT) };
+            const glm::vec2 size            = { static_cast<float>((std::rand() % 10) + 2),
+                                                static_cast<float>((std::rand() % 10) + 2) };
+            const glm::vec3 color           = { static_cast<float>(std::rand() % 256) / 255.0f,
+                                                static_cast<float>(std::rand() % 256) / 255.0f,
+                                                static_cast<float>(std::rand() % 256) / 255.0f };
+
+            rects.push_back({ currentPosition, size, color, {0.0f, 0.0f} });
+        }
+
+        std::cout << "[Info] Total rectangles: " << rects.size() << '\n';
+    }
 }
 
 void OnButtonInteracted(GLFWwindow* const window_,
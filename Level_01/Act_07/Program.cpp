@@ -1,4 +1,8 @@
-﻿#include <iostream>
+﻿#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
 #include <random>
 #include <vector>
 
@@ -6,6 +10,244 @@
 #include <glfw/glfw3.h>
 #include <glm/glm.hpp>
 
+/**
+ * @class QuadBatch
+ *
+ * @brief 축 정렬 사각형들을 모아 한 번의 인스턴스 드로우로 그립니다.
+ *
+ * 사각형은 (최소 좌표, 최대 좌표, 색상) 인스턴스로 CPU 스테이징 배열에 추가되고,
+ * Flush 시 한 번 업로드된 뒤 채우기/외곽선 모드 별로 각각 한 번의 인스턴스 드로우로 그려집니다.
+ * 좌표계는 좌하단이 원점인 픽셀 좌표입니다.
+ */
+class QuadBatch final
+{
+public:
+    /**
+     * @brief 그리기 모드를 정의합니다.
+     */
+    enum class Mode : unsigned char
+    {
+        /**
+         * @brief 내부를 채웁니다.
+         */
+        Fill,
+
+        /**
+         * @brief 외곽선만 그립니다.
+         */
+        Outline,
+    };
+
+    /**
+     * @brief 생성자.
+     *
+     * @param viewSize_ 화면 크기.
+     */
+    explicit QuadBatch(const glm::vec2& viewSize_) noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~QuadBatch() noexcept;
+
+    QuadBatch(const QuadBatch&) = delete;
+    QuadBatch& operator=(const QuadBatch&) = delete;
+
+    /**
+     * @brief 사각형을 추가합니다.
+     *
+     * @param min_   최소 좌표.
+     * @param max_   최대 좌표.
+     * @param color_ 색상.
+     * @param mode_  그리기 모드.
+     */
+    inline void Add(const glm::vec2& min_,
+                    const glm::vec2& max_,
+                    const glm::vec4& color_,
+                    const Mode       mode_ = Mode::Fill) noexcept
+    {
+        (mode_ == Mode::Fill ? fills : outlines).push_back({ min_, max_, color_ });
+    }
+
+    /**
+     * @brief 불투명한 사각형을 추가합니다.
+     *
+     * @param min_   최소 좌표.
+     * @param max_   최대 좌표.
+     * @param color_ 색상.
+     * @param mode_  그리기 모드.
+     */
+    inline void Add(const glm::vec2& min_,
+                    const glm::vec2& max_,
+                    const glm::vec3& color_,
+                    const Mode       mode_ = Mode::Fill) noexcept
+    {
+        Add(min_, max_, glm::vec4(color_, 1.0f), mode_);
+    }
+
+    /**
+     * @brief 스테이징 배열의 용량을 미리 확보합니다.
+     *
+     * @param count_ 확보할 사각형 개수.
+     */
+    void Reserve(std::size_t count_) noexcept;
+
+    /**
+     * @brief 추가된 모든 사각형을 업로드하고 그린 뒤 비웁니다.
+     */
+    void Flush() noexcept;
+private:
+    /**
+     * @brief 사각형 하나의 인스턴스 데이터.
+     */
+    struct Instance
+    {
+        glm::vec2 min;
+        glm::vec2 max;
+        glm::vec4 color;
+    };
+
+    /**
+     * @brief 셰이더 프로그램 ID.
+     */
+    GLuint program = 0;
+
+    /**
+     * @brief 정점 배열 객체.
+     */
+    GLuint vao = 0;
+
+    /**
+     * @brief 인스턴스 버퍼 객체.
+     */
+    GLuint vbo = 0;
+
+    /**
+     * @brief 인스턴스 버퍼에 담을 수 있는 사각형 개수.
+     */
+    std::size_t capacity = 0;
+
+    /**
+     * @brief 외곽선 모드 유니폼 위치.
+     */
+    GLint outlineLocation = -1;
+
+    /**
+     * @brief 채우기 모드 사각형들.
+     */
+    std::vector<Instance> fills;
+
+    /**
+     * @brief 외곽선 모드 사각형들.
+     */
+    std::vector<Instance> outlines;
+};
+
+/**
+ * @class Bitboard
+ *
+ * @brief 격자의 각 셀이 점유되었는지를 한 비트씩 기록합니다.
+ *
+ * 한 행은 64비트 워드 여러 개로 이루어지며, 사각형 영역의 설정/검사는 행 당 워드 단위 마스크 연산으로 처리됩니다.
+ */
+class Bitboard final
+{
+public:
+    /**
+     * @brief 생성자.
+     *
+     * @param width_  가로 셀 개수.
+     * @param height_ 세로 셀 개수.
+     */
+    explicit Bitboard(const int width_, const int height_) noexcept;
+
+    /**
+     * @brief 모든 셀을 비웁니다.
+     */
+    void Clear() noexcept;
+
+    /**
+     * @brief 사각형 영역의 셀들을 점유하거나 비웁니다.
+     *
+     * @param min_   영역의 최소 셀.
+     * @param span_  영역의 셀 단위 크기.
+     * @param value_ 점유 여부.
+     */
+    void Fill(const glm::ivec2& min_, const glm::ivec2& span_, const bool value_) noexcept;
+
+    /**
+     * @brief 사각형 영역이 격자 안에 있고 모든 셀이 비어 있는지 여부를 반환합니다.
+     *
+     * @param min_  영역의 최소 셀.
+     * @param span_ 영역의 셀 단위 크기.
+     *
+     * @return bool 비어 있는지 여부.
+     */
+    [[nodiscard]]
+    bool IsFree(const glm::ivec2& min_, const glm::ivec2& span_) const noexcept;
+private:
+    /**
+     * @brief 사각형 영역과 겹치는 워드마다 지정한 함수를 호출합니다.
+     *
+     * @param min_      영역의 최소 셀.
+     * @param span_     영역의 셀 단위 크기.
+     * @param function_ 워드 인덱스와 마스크를 받아 순회를 계속할지 여부를 반환하는 함수.
+     *
+     * @return bool 순회를 끝까지 마쳤는지 여부.
+     */
+    template <typename Function>
+    bool ForEachWord(const glm::ivec2& min_, const glm::ivec2& span_, Function&& function_) const noexcept
+    {
+        for (int y = min_.y; y < min_.y + span_.y; ++y)
+        {
+            int       x   = min_.x;
+            const int end = min_.x + span_.x;
+
+            while (x < end)
+            {
+                const int bit   = x & 63;
+                const int count = std::min(64 - bit, end - x);
+
+                const std::uint64_t mask = (count == 64 ? ~std::uint64_t(0) : ((std::uint64_t(1) << count) - 1)) << bit;
+
+                if (!function_(static_cast<std::size_t>(y) * stride + (x >> 6), mask))
+                {
+                    return false;
+                }
+
+                x += count;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief 가로 셀 개수.
+     */
+    int width;
+
+    /**
+     * @brief 세로 셀 개수.
+     */
+    int height;
+
+    /**
+     * @brief 한 행을 이루는 워드 개수.
+     */
+    int stride;
+
+    /**
+     * @brief 점유 비트들. (행 우선)
+     */
+    std::vector<std::uint64_t> words;
+};
+
+/**
+ * @struct Block
+ *
+ * @brief 퍼즐 블럭을 정의합니다.
+ */
 struct Block
 {
     /**
@@ -47,26 +289,20 @@ struct Block
                (point_.y >= min.y && point_.y <= max.y);
     }
 
-    inline void Render() const noexcept
+    /**
+     * @brief 해당 블럭을 일괄 렌더러에 추가합니다.
+     *
+     * @param batch_ 추가할 일괄 렌더러.
+     */
+    inline void Render(QuadBatch& batch_) const noexcept
     {
-        glColor3f(color.r, color.g, color.b);
-        glBegin(GL_QUADS);
-        {
-            const glm::vec2 min = GetMin();
-            const glm::vec2 max = GetMax();
-
-            glVertex2f(min.x, min.y);
-            glVertex2f(max.x, min.y);
-            glVertex2f(max.x, max.y);
-            glVertex2f(min.x, max.y);
-        }
-        glEnd();
+        batch_.Add(GetMin(), GetMax(), color);
     }
 
     /**
-     * @brief 블럭 식별을 위한 변수.
+     * @brief 블럭 식별을 위한 변수. (기대 셀 테이블의 인덱스)
      */
-    unsigned char id;
+    unsigned int id;
 
     /**
      * @brief 위치.
@@ -82,6 +318,16 @@ struct Block
      * @brief 색상.
      */
     glm::vec3 color;
+
+    /**
+     * @brief 패널 내에서 블럭이 놓인 최소 셀.
+     */
+    glm::ivec2 cell;
+
+    /**
+     * @brief 셀 단위 크기.
+     */
+    glm::ivec2 span;
 };
 
 /**
@@ -145,6 +391,25 @@ static void Render() noexcept;
  */
 static void CheckComplete() noexcept;
 
+/**
+ * @brief 답안 블럭을 지정한 셀로 옮기고 점유 비트와 정답 개수를 갱신합니다.
+ *
+ * @param block_ 옮길 답안 블럭.
+ * @param cell_  옮길 답안 패널 내 셀.
+ */
+static void PlaceBlock(Block& block_, const glm::ivec2& cell_) noexcept;
+
+/**
+ * @brief 패널 내 셀과 셀 단위 크기로부터 블럭의 중심 위치를 계산합니다.
+ *
+ * @param cell_    패널 내 최소 셀.
+ * @param span_    셀 단위 크기.
+ * @param offsetX_ 패널의 가로 시작 위치.
+ *
+ * @return glm::vec2 블럭의 중심 위치.
+ */
+static glm::vec2 ToPosition(const glm::ivec2& cell_, const glm::ivec2& span_, const float offsetX_) noexcept;
+
 /**
  * @brief 애플리케이션 너비.
  */
@@ -215,11 +480,36 @@ static std::vector<Block> answer;
  */
 static Block* dragged = nullptr;
 
+/**
+ * @brief 문제 패널의 점유 비트.
+ */
+static Bitboard questionBoard(GRID_SIZE, GRID_SIZE);
+
+/**
+ * @brief 답안 패널의 점유 비트.
+ */
+static Bitboard answerBoard(GRID_SIZE, GRID_SIZE);
+
+/**
+ * @brief 블럭 아이디 별 정답 셀.
+ */
+static std::vector<glm::ivec2> expectedCells;
+
+/**
+ * @brief 정답 셀에 놓인 답안 블럭 개수.
+ */
+static std::size_t placedCounts = 0;
+
 /**
  * @brief 게임 종료 여부.
  */
 static bool isGameOver = false;
 
+/**
+ * @brief 사각형 일괄 렌더러.
+ */
+static QuadBatch* quadBatch = nullptr;
+
 int main()
 {
     if (!glfwInit())
@@ -230,7 +520,7 @@ int main()
 
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, CONTEXT_MAJOR_VERSION);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, CONTEXT_MINOR_VERSION);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_COMPAT_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
 
     GLFWwindow* window = glfwCreateWindow(WINDOW_WIDTH,
@@ -258,6 +548,11 @@ int main()
     glfwSetMouseButtonCallback(window, OnButtonInteracted);
     glfwSetCursorPosCallback(window, OnCursorMoved);
 
+    quadBatch = new QuadBatch({ WINDOW_WIDTH, WINDOW_HEIGHT });
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
     InitializeWindow();
 
     float lastTime = static_cast<float>(glfwGetTime());
@@ -275,13 +570,6 @@ int main()
         }
         // Render.
         {
-            glMatrixMode(GL_PROJECTION);
-            glLoadIdentity();
-            glOrtho(0.0, WINDOW_WIDTH, 0.0, WINDOW_HEIGHT, -1, 1);
-
-            glMatrixMode(GL_MODELVIEW);
-            glLoadIdentity();
-
             glClearColor(0.15f, 0.15f, 0.15f, 1.0f);
             glClear(GL_COLOR_BUFFER_BIT);
             Render();
@@ -289,10 +577,209 @@ int main()
         glfwSwapBuffers(window);
     }
 
+    delete quadBatch;
+
     glfwTerminate();
     return 0;
 }
 
+Bitboard::Bitboard(const int width_, const int height_) noexcept
+    : width(width_)
+    , height(height_)
+    , stride((width_ + 63) / 64)
+    , words(static_cast<std::size_t>(stride) * static_cast<std::size_t>(height_), 0)
+{
+
+}
+
+void Bitboard::Clear() noexcept
+{
+    std::fill(words.begin(), words.end(), 0);
+}
+
+void Bitboard::Fill(const glm::ivec2& min_, const glm::ivec2& span_, const bool value_) noexcept
+{
+    ForEachWord(min_, span_, [this, value_](const std::size_t index_, const std::uint64_t mask_)
+    {
+        words[index_] = value_ ? (words[index_] | mask_) : (words[index_] & ~mask_);
+        return true;
+    });
+}
+
+bool Bitboard::IsFree(const glm::ivec2& min_, const glm::ivec2& span_) const noexcept
+{
+    if (min_.x < 0 || min_.y < 0 ||
+        min_.x + span_.x > width || min_.y + span_.y > height)
+    {
+        return false;
+    }
+
+    return ForEachWord(min_, span_, [this](const std::size_t index_, const std::uint64_t mask_)
+    {
+        return (words[index_] & mask_) == 0;
+    });
+}
+
+QuadBatch::QuadBatch(const glm::vec2& viewSize_) noexcept
+{
+    // 인스턴스 하나 당 4개의 정점을 gl_VertexID로 모서리에 대응시킵니다.
+    constexpr const char* const vertexSource = R"(#version 450 core
+        layout (location = 0) in vec2 aMin;
+        layout (location = 1) in vec2 aMax;
+        layout (location = 2) in vec4 aColor;
+
+        uniform vec2 u_ViewSize;
+        uniform bool u_Outline;
+
+        out vec4 vColor;
+
+        const vec2 FILL_CORNERS[4]    = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(0.0, 1.0), vec2(1.0, 1.0));
+        const vec2 OUTLINE_CORNERS[4] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));
+
+        void main()
+        {
+            const vec2 corner   = u_Outline ? OUTLINE_CORNERS[gl_VertexID] : FILL_CORNERS[gl_VertexID];
+            const vec2 position = mix(aMin, aMax, corner);
+
+            gl_Position = vec4(position / u_ViewSize * 2.0 - 1.0, 0.0, 1.0);
+            vColor      = aColor;
+        })";
+
+    constexpr const char* const fragmentSource = R"(#version 450 core
+        in vec4 vColor;
+
+        out vec4 FragColor;
+
+        void main()
+        {
+            FragColor = vColor;
+        })";
+
+    GLint success;
+    char infoLog[512];
+
+    const GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &vertexSource, nullptr);
+    glCompileShader(vertexShader);
+    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(vertexShader, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Vertex shader compilation failed: " << infoLog << '\n';
+    }
+
+    const GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &fragmentSource, nullptr);
+    glCompileShader(fragmentShader);
+    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+        glGetShaderInfoLog(fragmentShader, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Fragment shader compilation failed: " << infoLog << '\n';
+    }
+
+    program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success)
+    {
+        glGetProgramInfoLog(program, sizeof(infoLog), nullptr, infoLog);
+        std::cerr << "Shader program linking failed: " << infoLog << '\n';
+    }
+
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    glUseProgram(program);
+    glUniform2f(glGetUniformLocation(program, "u_ViewSize"), viewSize_.x, viewSize_.y);
+    outlineLocation = glGetUniformLocation(program, "u_Outline");
+
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, min)));
+    glEnableVertexAttribArray(0);
+    glVertexAttribDivisor(0, 1);
+
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, max)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, color)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+QuadBatch::~QuadBatch() noexcept
+{
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteProgram(program);
+}
+
+void QuadBatch::Reserve(const std::size_t count_) noexcept
+{
+    fills.reserve(count_);
+}
+
+void QuadBatch::Flush() noexcept
+{
+    const std::size_t count = fills.size() + outlines.size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    if (count > capacity)
+    {
+        capacity = count;
+    }
+
+    // 이전 프레임이 아직 읽고 있을 수 있으므로 저장 공간을 고아로 만든 뒤 한 번에 기록합니다.
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(capacity * sizeof(Instance)), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(fills.size() * sizeof(Instance)), fills.data());
+    glBufferSubData(GL_ARRAY_BUFFER,
+                    static_cast<GLintptr>(fills.size() * sizeof(Instance)),
+                    static_cast<GLsizeiptr>(outlines.size() * sizeof(Instance)),
+                    outlines.data());
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glUseProgram(program);
+    glBindVertexArray(vao);
+
+    if (!fills.empty())
+    {
+        glUniform1i(outlineLocation, GL_FALSE);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(fills.size()));
+    }
+
+    if (!outlines.empty())
+    {
+        glUniform1i(outlineLocation, GL_TRUE);
+        glDrawArraysInstancedBaseInstance(GL_LINE_LOOP,
+                                          0,
+                                          4,
+                                          static_cast<GLsizei>(outlines.size()),
+                                          static_cast<GLuint>(fills.size()));
+    }
+
+    glBindVertexArray(0);
+
+    fills.clear();
+    outlines.clear();
+}
+
 void OnKeyInteracted(GLFWwindow* const window_,
                      const int         key_,
                      const int         scancode_,
@@ -318,34 +805,33 @@ void OnKeyInteracted(GLFWwindow* const window_,
         }
         case GLFW_KEY_SPACE:
         {
-            for (Block& userBlock : answer)
+            if (isGameOver)
             {
-                const Block* targetBlock = nullptr;
+                return;
+            }
 
-                for (const auto& q_block : question)
+            // 정답 자리가 비어 있는 첫 번째 블럭을 옮깁니다.
+            for (Block& userBlock : answer)
+            {
+                const glm::ivec2 target = expectedCells[userBlock.id];
+                if (userBlock.cell == target)
                 {
-                    if (userBlock.id == q_block.id)
-                    {
-                        targetBlock = &q_block;
-                        break;
-                    }
+                    continue;
                 }
 
-                if (targetBlock)
-                {
-                    glm::vec2 hintPosition = targetBlock->currentPosition;
-                    hintPosition.x += PANEL_PIXEL_WIDTH;
-
-                    constexpr float THRESHOLD = 0.5f;
-                    if (glm::distance(userBlock.currentPosition, hintPosition) >= THRESHOLD)
-                    {
-                        userBlock.currentPosition = hintPosition;
+                answerBoard.Fill(userBlock.cell, userBlock.span, false);
+                const bool isFree = answerBoard.IsFree(target, userBlock.span);
+                answerBoard.Fill(userBlock.cell, userBlock.span, true);
 
-                        CheckComplete();
-                        return;
-                    }
+                if (isFree)
+                {
+                    PlaceBlock(userBlock, target);
+                    CheckComplete();
+                    return;
                 }
             }
+
+            std::cout << "[Info] No hint available: every target cell is occupied.\n";
             break;
         }
     }
@@ -383,20 +869,20 @@ void OnButtonInteracted(GLFWwindow* const window_,
                 return;
             }
 
-            const glm::vec2 currentTopLeft = dragged->GetMin();
+            const glm::vec2 currentMin = dragged->GetMin();
 
-            int gridX = static_cast<int>(round(currentTopLeft.x / CELL_WIDTH));
-            int gridY = static_cast<int>(round(currentTopLeft.y / CELL_HEIGHT));
+            glm::ivec2 target = { static_cast<int>(std::round((currentMin.x - PANEL_PIXEL_WIDTH) / CELL_WIDTH)),
+                                  static_cast<int>(std::round(currentMin.y / CELL_HEIGHT)) };
 
-            const int blockGridWidth  = static_cast<int>(dragged->size.x / CELL_WIDTH);
-            const int blockGridHeight = static_cast<int>(dragged->size.y / CELL_HEIGHT);
+            target.x = std::clamp(target.x, 0, GRID_SIZE - dragged->span.x);
+            target.y = std::clamp(target.y, 0, GRID_SIZE - dragged->span.y);
 
-            gridX = std::max(GRID_SIZE, gridX);
-            gridX = std::min(gridX, 2 * GRID_SIZE - blockGridWidth);
-            gridY = std::max(0, std::min(gridY, GRID_SIZE - blockGridHeight));
+            // 다른 블럭과 겹치는 자리라면 원래 자리로 되돌립니다.
+            answerBoard.Fill(dragged->cell, dragged->span, false);
+            const bool isFree = answerBoard.IsFree(target, dragged->span);
+            answerBoard.Fill(dragged->cell, dragged->span, true);
 
-            dragged->currentPosition.x = (gridX * CELL_WIDTH) + dragged->size.x * 0.5f;
-            dragged->currentPosition.y = (gridY * CELL_HEIGHT) + dragged->size.y * 0.5f;
+            PlaceBlock(*dragged, isFree ? target : dragged->cell);
 
             dragged = nullptr;
 
@@ -443,85 +929,56 @@ void InitializeWindow() noexcept
     std::uniform_int_distribution<int> posDist(0, GRID_SIZE - 3);
 
     question.clear();
+    questionBoard.Clear();
+    expectedCells.resize(BLOCK_COUNTS);
+
     for (unsigned int count = 0; count < BLOCK_COUNTS; ++count)
     {
         Block newBlock{};
-        newBlock.id     = count;
-        newBlock.size= { sizeDist(gen) * CELL_WIDTH, sizeDist(gen) * CELL_WIDTH };
-
-        bool positionFound = false;
+        newBlock.id   = count;
+        newBlock.span = { sizeDist(gen), sizeDist(gen) };
+        newBlock.size = { newBlock.span.x * CELL_WIDTH, newBlock.span.y * CELL_HEIGHT };
 
-        while(!positionFound)
+        do
         {
-            const glm::vec2 gridPos = { posDist(gen), posDist(gen) };
-
-            newBlock.currentPosition = { (gridPos.x * CELL_WIDTH) + newBlock.size.x * 0.5f,
-                                     (gridPos.y * CELL_HEIGHT) + newBlock.size.y * 0.5f };
+            newBlock.cell = { posDist(gen), posDist(gen) };
+        } while (!questionBoard.IsFree(newBlock.cell, newBlock.span));
 
-            positionFound = true;
+        questionBoard.Fill(newBlock.cell, newBlock.span, true);
 
-            if (newBlock.GetMax().x > PANEL_PIXEL_WIDTH ||
-                newBlock.GetMax().y > WINDOW_HEIGHT)
-            {
-                positionFound = false;
-                continue;
-            }
+        newBlock.currentPosition = ToPosition(newBlock.cell, newBlock.span, 0.0f);
+        newBlock.color           = { colorDist(gen), colorDist(gen), colorDist(gen) };
 
-            for(const Block& other : question)
-            {
-                if ((newBlock.GetMin().x < other.GetMax().x) &&
-                    (newBlock.GetMax().x > other.GetMin().x) &&
-                    (newBlock.GetMin().y < other.GetMax().y) &&
-                    (newBlock.GetMax().y > other.GetMin().y))
-                {
-                    positionFound = false;
-                    break;
-                }
-            }
-        }
-
-        newBlock.color = { colorDist(gen), colorDist(gen), colorDist(gen) };
+        expectedCells[newBlock.id] = newBlock.cell;
         question.push_back(newBlock);
     }
 
     answer.assign(question.begin(), question.end());
+    answerBoard.Clear();
+    placedCounts = 0;
 
     std::uniform_int_distribution<int> userPosDistX(0, GRID_SIZE - 3);
     std::uniform_int_distribution<int> userPosDistY(0, GRID_SIZE - 3);
 
     for (Block& block : answer)
     {
-        bool isFound = false;
-
-        while (!isFound)
+        do
         {
-            const glm::vec2 gridPos = { userPosDistX(gen), userPosDistY(gen) };
-
-            block.currentPosition = { PANEL_PIXEL_WIDTH + (gridPos.x * CELL_WIDTH) + block.size.x * 0.5f,
-                                  (gridPos.y * CELL_HEIGHT) + block.size.y * 0.5f };
-
-            isFound = true;
+            block.cell = { userPosDistX(gen), userPosDistY(gen) };
+        } while (!answerBoard.IsFree(block.cell, block.span));
 
-            for (const Block& other : answer)
-            {
-                if (block.id == other.id)
-                {
-                    continue;
-                }
+        answerBoard.Fill(block.cell, block.span, true);
+        block.currentPosition = ToPosition(block.cell, block.span, PANEL_PIXEL_WIDTH);
 
-                if ((block.GetMin().x < other.GetMax().x) &&
-                    (block.GetMax().x > other.GetMin().x) &&
-                    (block.GetMin().y < other.GetMax().y) &&
-                    (block.GetMax().y > other.GetMin().y))
-                {
-                    isFound = false;
-                    break;
-                }
-            }
+        if (block.cell == expectedCells[block.id])
+        {
+            ++placedCounts;
         }
     }
 
     dragged = nullptr;
+
+    CheckComplete();
 }
 
 void Update(const float deltaTime_) noexcept
@@ -531,87 +988,86 @@ void Update(const float deltaTime_) noexcept
 
 void Render() noexcept
 {
-    // 격자.
+    // 격자. (선은 코어 프로파일에서 두께를 보장받지 못하므로 얇은 사각형으로 그립니다)
     {
-        glColor3f(0.2, 0.2, 0.2);
-        glLineWidth(1.0f);
-        glBegin(GL_LINES);
-        {
-            for (unsigned int index = 0; index <= GRID_SIZE * 2; ++index)
-            {
-                glVertex2f(index * CELL_WIDTH, 0);
-                glVertex2f(index * CELL_WIDTH, WINDOW_HEIGHT);
-            }
+        constexpr glm::vec3 gridColor = { 0.2f, 0.2f, 0.2f };
 
-            for (unsigned int index = 0; index <= GRID_SIZE; ++index)
-            {
-                glVertex2f(0, index * CELL_HEIGHT);
-                glVertex2f(WINDOW_WIDTH, index * CELL_HEIGHT);
-            }
+        for (unsigned int index = 0; index <= GRID_SIZE * 2; ++index)
+        {
+            const float x = static_cast<float>(index) * CELL_WIDTH;
+            quadBatch->Add({ x - 0.5f, 0.0f }, { x + 0.5f, static_cast<float>(WINDOW_HEIGHT) }, gridColor);
         }
-        glEnd();
 
-        glColor3f(1.0f, 1.0f, 1.0f);
-        glLineWidth(2.0f);
-        glBegin(GL_LINES);
+        for (unsigned int index = 0; index <= GRID_SIZE; ++index)
         {
-            glVertex2f(WINDOW_WIDTH / 2.0f, 0);
-            glVertex2f(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT);
+            const float y = static_cast<float>(index) * CELL_HEIGHT;
+            quadBatch->Add({ 0.0f, y - 0.5f }, { static_cast<float>(WINDOW_WIDTH), y + 0.5f }, gridColor);
         }
-        glEnd();
 
+        constexpr float centerX = WINDOW_WIDTH / 2.0f;
+        quadBatch->Add({ centerX - 1.0f, 0.0f }, { centerX + 1.0f, static_cast<float>(WINDOW_HEIGHT) }, glm::vec3(1.0f, 1.0f, 1.0f));
     }
     // 블록.
     {
         for (const Block& block : question)
         {
-            block.Render();
+            block.Render(*quadBatch);
         }
 
         for (const Block& block : answer)
         {
-            block.Render();
+            block.Render(*quadBatch);
         }
     }
     {
         if (isGameOver)
         {
-            glColor4f(0.0f, 0.0f, 0.0f, 0.5f);
-            glRectf(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT);
+            quadBatch->Add({ 0.0f, 0.0f },
+                           { static_cast<float>(WINDOW_WIDTH), static_cast<float>(WINDOW_HEIGHT) },
+                           glm::vec4(0.0f, 0.0f, 0.0f, 0.5f));
         }
     }
+
+    quadBatch->Flush();
 }
 
 void CheckComplete() noexcept
 {
-    for (const auto& ans_block : answer)
+    // 정답 개수는 블럭이 옮겨질 때마다 갱신되므로 비교 한 번으로 판정합니다.
+    if (placedCounts != answer.size())
     {
-        bool foundMatch = false;
+        isGameOver = false;
+        return;
+    }
 
-        for (const auto& q_block : question)
-        {
-            if (ans_block.id == q_block.id)
-            {
-                glm::vec2 converted_pos = ans_block.currentPosition;
-                converted_pos.x -= PANEL_PIXEL_WIDTH;
+    std::cout << "All blocks are in place! Game Over." << std::endl;
 
-                constexpr float THRESHOLD = 1.0f;
+    isGameOver = true;
+}
 
-                if (glm::distance(converted_pos, q_block.currentPosition) < THRESHOLD)
-                {
-                    foundMatch = true;
-                }
-                break;
-            }
-        }
-        if (!foundMatch)
-        {
-            isGameOver = false;
-            return;
-        }
+void PlaceBlock(Block& block_, const glm::ivec2& cell_) noexcept
+{
+    const glm::ivec2& expected = expectedCells[block_.id];
+
+    if (block_.cell == expected)
+    {
+        --placedCounts;
     }
 
-    std::cout << "All blocks are in place! Game Over." << std::endl;
+    answerBoard.Fill(block_.cell, block_.span, false);
+    answerBoard.Fill(cell_, block_.span, true);
 
-    isGameOver = true;
+    block_.cell            = cell_;
+    block_.currentPosition = ToPosition(cell_, block_.span, PANEL_PIXEL_WIDTH);
+
+    if (block_.cell == expected)
+    {
+        ++placedCounts;
+    }
+}
+
+glm::vec2 ToPosition(const glm::ivec2& cell_, const glm::ivec2& span_, const float offsetX_) noexcept
+{
+    return { offsetX_ + (static_cast<float>(cell_.x) + static_cast<float>(span_.x) * 0.5f) * CELL_WIDTH,
+                        (static_cast<float>(cell_.y) + static_cast<float>(span_.y) * 0.5f) * CELL_HEIGHT };
 }
\ No newline at end of file
@@ -1,10 +1,10 @@
 #version 450 core
 
-out vec4 FragColor;
+in vec3 vColor;
 
-uniform vec3 u_Color;
+out vec4 FragColor;
 
 void main()
 {
-    FragColor = vec4(u_Color, 1.0);
+    FragColor = vec4(vColor, 1.0);
 }
\ No newline at end of file
@@ -1,10 +1,14 @@
-﻿#include <array>
+﻿#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <random>
+#include <vector>
 
 #include <glad/glad.h>
 
@@ -72,168 +76,150 @@ class Shader final
 };
 
 /**
- * @class Triangle
+ * @class TriangleSet
  *
- * @brief 삼각형을 정의합니다.
+ * @brief 모든 삼각형을 필드 별 배열(SoA)로 보관합니다.
+ *
+ * 애니메이션 커널은 각 배열을 한 번에 순회하며 갱신하고,
+ * 렌더러는 각 배열을 그대로 인스턴스 버퍼에 업로드합니다.
  */
-class Triangle final
+class TriangleSet final
 {
 public:
     /**
-     * @brief 생성자.
+     * @brief 삼각형을 추가합니다.
      *
      * @param position_ 삼각형 위치.
      * @param size_     삼각형 크기.
      * @param color_    삼각형 색상.
      */
-    explicit Triangle(const glm::vec2& position_,
-                      const float      size_,
-                      const glm::vec3& color_) noexcept;
+    void Add(const glm::vec2& position_,
+             const float      size_,
+             const glm::vec3& color_) noexcept;
 
     /**
-     * @brief 소멸자.
+     * @brief 지정한 인덱스의 삼각형을 제거합니다. (마지막 삼각형과 자리를 바꾼 뒤 제거합니다.)
+     *
+     * @param index_ 제거할 삼각형의 인덱스.
      */
-    ~Triangle() noexcept;
+    void Remove(const std::size_t index_) noexcept;
 
     /**
-     * @brief 해당 삼각형과 지정한 점이 접촉하는지 여부를 반환합니다.
-     *
-     * @param shader_ 사용할 셰이더.
+     * @brief 모든 삼각형을 제거합니다.
      */
-    void Draw(const Shader& shader_) const noexcept;
+    void Clear() noexcept;
 
     /**
-     * @brief 해당 삼각형의 위치를 반환합니다.
+     * @brief 지정한 개수만큼의 공간을 미리 확보합니다.
      *
-     * @return glm::vec2 해당 삼각형의 위치.
+     * @param capacity_ 확보할 개수.
      */
-    [[nodiscard]]
-    constexpr glm::vec2 GetPosition() const noexcept
-    {
-        return position;
-    }
+    void Reserve(const std::size_t capacity_);
 
     /**
-     * @brief 해당 삼각형의 위치를 설정합니다.
+     * @brief 지정한 점과 접촉하는 삼각형의 인덱스를 반환합니다.
      *
-     * @param position_ 설정할 위치.
+     * @param point_ 검사할 점.
+     *
+     * @return std::size_t 접촉하는 삼각형의 인덱스. 없다면 GetCount()를 반환합니다.
      */
-    inline void SetPosition(const glm::vec2& position_) noexcept
-    {
-        position = position_;
-    }
+    [[nodiscard]]
+    std::size_t Find(const glm::vec2& point_) const noexcept;
 
     /**
-     * @brief 해당 삼각형의 크기를 반환합니다.
+     * @brief 삼각형의 개수를 반환합니다.
      *
-     * @return float 해당 삼각형의 크기.
+     * @return std::size_t 삼각형의 개수.
      */
     [[nodiscard]]
-    constexpr float GetSize() const noexcept
+    inline std::size_t GetCount() const noexcept
     {
-        return size;
+        return positions.size();
     }
 
     /**
-     * @brief 해당 삼각형의 크기를 설정합니다.
-     *
-     * @param size_ 설정할 크기.
+     * @brief 각 삼각형의 위치.
      */
-    inline void SetSize(const float size_) noexcept
-    {
-        size = size_;
-    }
+    std::vector<glm::vec2> positions;
 
     /**
-     * @brief 해당 삼각형의 색상을 반환합니다.
-     *
-     * @return glm::vec3 해당 삼각형의 색상.
+     * @brief 각 삼각형의 이동 방향(속도).
      */
-    [[nodiscard]]
-    constexpr glm::vec3 GetColor() const noexcept
-    {
-        return color;
-    }
+    std::vector<glm::vec2> directions;
 
     /**
-     * @brief 해당 삼각형의 색상을 설정합니다.
-     *
-     * @param color_ 설정할 색상.
+     * @brief 각 삼각형의 크기.
      */
-    inline void SetColor(const glm::vec3& color_) noexcept
-    {
-        color = color_;
-    }
+    std::vector<float> sizes;
 
     /**
-     * @brief 해당 삼각형의 이동 방향을 반환합니다.
-     *
-     * @return float 해당 삼각형의 이동 방향.
+     * @brief 각 삼각형의 색상.
      */
-    [[nodiscard]]
-    constexpr glm::vec2 GetVelocity() const noexcept
-    {
-        return direction;
-    }
+    std::vector<glm::vec3> colors;
+};
 
+/**
+ * @class TriangleRenderer
+ *
+ * @brief 모든 삼각형을 한 번의 인스턴스 드로우로 렌더링합니다.
+ */
+class TriangleRenderer final
+{
+public:
     /**
-     * @brief 해당 삼각형의 이동 방향을 설정합니다.
-     *
-     * @param velocity_ 설정할 이동 방향.
+     * @brief 생성자.
      */
-    inline void SetDirection(const glm::vec2& velocity_) noexcept
-    {
-        direction = velocity_;
-    }
+    explicit TriangleRenderer() noexcept;
 
     /**
-     * @brief 해당 삼각형이 지정한 점과 접촉하는지 여부를 반환합니다.
-     *
-     * @return bool 접촉 여부.
+     * @brief 소멸자.
      */
-    [[nodiscard]]
-    constexpr bool IsInteract(const glm::vec2 point_) const noexcept
-    {
-        return (point_.x >= position.x - size * 0.25f) &&
-               (point_.x <= position.x + size * 0.25f) &&
-               (point_.y >= position.y - size * 0.25f) &&
-               (point_.y <= position.y + size * 0.75f);
-    }
-private:
+    ~TriangleRenderer() noexcept;
+
+    TriangleRenderer(const TriangleRenderer&) = delete;
+    TriangleRenderer& operator=(const TriangleRenderer&) = delete;
+
     /**
-     * @brief 해당 삼각형의 정점 배열 객체.
+     * @brief 지정한 삼각형들을 렌더링합니다.
+     *
+     * @param triangles_ 렌더링할 삼각형들.
      */
-    unsigned int vao;
+    void Draw(const TriangleSet& triangles_) noexcept;
 
+private:
     /**
-     * @brief 해당 삼각형의 정점 버퍼 객체.
+     * @brief 인스턴스 버퍼의 용량을 늘리고 인스턴스 속성을 다시 지정합니다.
+     *
+     * @param capacity_ 필요한 최소 용량.
      */
-    unsigned int vbo;
+    void Grow(const std::size_t capacity_) noexcept;
 
     /**
-     * @brief 해당 삼각형의 요소 배열 객체.
+     * @brief 인스턴스 하나가 차지하는 바이트 수.
      */
-    unsigned int ebo;
+    static constexpr std::size_t INSTANCE_SIZE = sizeof(glm::vec2) + sizeof(glm::vec2) + sizeof(float) + sizeof(glm::vec3);
 
     /**
-     * @brief 해당 삼각형의 위치.
+     * @brief 정점 배열 객체.
      */
-    glm::vec2 position;
+    unsigned int vao;
 
     /**
-     * @brief 해당 삼각형의 크기.
+     * @brief 단위 삼각형의 정점 버퍼 객체.
      */
-    float size;
+    unsigned int vbo;
 
     /**
-     * @brief 해당 삼각형의 색상.
+     * @brief 매 프레임 갱신되는 인스턴스 버퍼 객체.
+     *
+     * [위치들][방향들][크기들][색상들] 순서로 각 배열을 그대로 담습니다.
      */
-    glm::vec3 color;
+    unsigned int instanceVbo;
 
     /**
-     * @brief 해당 삼각형의 속도.
+     * @brief 인스턴스 버퍼가 담을 수 있는 삼각형의 개수.
      */
-    glm::vec2 direction;
+    std::size_t capacity;
 };
 
 /**
@@ -252,9 +238,10 @@ class Animation
     /**
      * @brief 애니메이션을 업데이트합니다.
      *
+     * @param triangles_ 갱신할 삼각형들.
      * @param deltaTime_ 이전 프레임과 현재 프레임 사이의 간격.
      */
-    virtual void Update(const float deltaTime_) noexcept = 0;
+    virtual void Update(TriangleSet& triangles_, const float deltaTime_) noexcept = 0;
 };
 
 /**
@@ -268,9 +255,10 @@ class BounceAnimation final : public Animation
     /**
      * @brief 애니메이션을 업데이트합니다.
      *
+     * @param triangles_ 갱신할 삼각형들.
      * @param deltaTime_ 이전 프레임과 현재 프레임 사이의 간격.
      */
-    virtual void Update(const float deltaTime_) noexcept override;
+    virtual void Update(TriangleSet& triangles_, const float deltaTime_) noexcept override;
 private:
     /**
      * @brief 각 삼각형의 속도 벡터.
@@ -289,56 +277,28 @@ class ZigzagAnimation final : public Animation
     /**
      * @brief 애니메이션을 업데이트합니다.
      *
+     * @param triangles_ 갱신할 삼각형들.
      * @param deltaTime_ 이전 프레임과 현재 프레임 사이의 간격.
      */
-    virtual void Update(const float deltaTime_) noexcept override;
+    virtual void Update(TriangleSet& triangles_, const float deltaTime_) noexcept override;
 private:
     static constexpr float speed = 200.0f;
     static constexpr float verticalStep = 80.0f;
-    static constexpr float horizontalLength = 500.0f;
-    static constexpr int   maxRows = 6;
+
     /**
-     * @struct State
-     * 
-     * @brief 삼각형의 이동 정보를 정의합니다.
+     * @brief 각 삼각형의 현재 방향.
      */
-    struct State
-    {
-        /**
-         * @brief 애니메이션 시작 위치.
-         */
-        glm::vec2 originPosition;
-
-        /**
-         * @brief 현재 위치.
-         */
-        glm::vec2 currentPosition;
-
-        /**
-         * @brief 현재 방향.
-         */
-        glm::vec2 currentDirection;
-
-        /**
-         * @brief 현재 구간에 남은 거리.
-         */
-        float remaining; // 현재 구간에 남은 거리
-
-        /**
-         * @brief 현재 줄.
-         */
-        int row;         
-
-        /**
-         * @brief 현재 진행 방향 (true=→, false=←)
-         */
-        bool isGoingRight;
-    };
+    std::vector<glm::vec2> headings;
 
     /**
-     * @brief 각 삼각형들의 상태.
+     * @brief 각 삼각형이 현재 구간에 남은 거리.
      */
-    std::vector<State> states;
+    std::vector<float> remainings;
+
+    /**
+     * @brief 각 삼각형의 현재 진행 방향 (1=→, 0=←)
+     */
+    std::vector<std::uint8_t> isGoingRights;
 };
 
 /**
@@ -352,25 +312,11 @@ class OrthogonalAnimation final : public Animation
     /**
      * @brief 애니메이션을 업데이트합니다.
      *
+     * @param triangles_ 갱신할 삼각형들.
      * @param deltaTime_ 이전 프레임과 현재 프레임 사이의 간격.
      */
-    virtual void Update(const float deltaTime_) noexcept override;
+    virtual void Update(TriangleSet& triangles_, const float deltaTime_) noexcept override;
 private:
-    /**
-	 * @struct State
-     * 
-     * @brief 삼각형의 이동 정보를 정의합니다.
-     */
-    struct State
-    {
-        glm::vec2 origin;
-        glm::vec2 currentPosition;
-        glm::vec2 currentDirection; 
-        float segLeft; 
-        int turnCount; 
-        int lenFactor;
-    };
-    
     /**
 	 * @brief 각 코너 간의 거리(픽셀).
      */
@@ -382,9 +328,29 @@ class OrthogonalAnimation final : public Animation
     static constexpr float Speed = 160.0f;
 
     /**
-     * @brief 각 삼각형들의 상태.
+     * @brief 각 삼각형의 시작 위치.
      */
-    std::vector<State> states;
+    std::vector<glm::vec2> origins;
+
+    /**
+     * @brief 각 삼각형의 현재 방향.
+     */
+    std::vector<glm::vec2> headings;
+
+    /**
+     * @brief 각 삼각형이 현재 구간에 남은 거리.
+     */
+    std::vector<float> segLefts;
+
+    /**
+     * @brief 각 삼각형이 회전한 횟수.
+     */
+    std::vector<int> turnCounts;
+
+    /**
+     * @brief 각 삼각형의 현재 구간 길이 배율.
+     */
+    std::vector<int> lenFactors;
 };
 
 /**
@@ -398,20 +364,20 @@ class SpiralAnimation final : public Animation
     /**
      * @brief 애니메이션을 업데이트합니다.
      *
+     * @param triangles_ 갱신할 삼각형들.
      * @param deltaTime_ 이전 프레임과 현재 프레임 사이의 간격.
      */
-    virtual void Update(const float deltaTime_) noexcept override;
+    virtual void Update(TriangleSet& triangles_, const float deltaTime_) noexcept override;
 private:
-    struct State
-    {
-        glm::vec2 origin;
-        float theta;
-        float k;
-        float r0;
-        float speed;
-    };
-    
-    std::vector<State> states;
+    /**
+     * @brief 각 삼각형의 나선 중심.
+     */
+    std::vector<glm::vec2> origins;
+
+    /**
+     * @brief 각 삼각형의 현재 각도.
+     */
+    std::vector<float> thetas;
 };
 
 /**
@@ -551,10 +517,20 @@ static float timeScale = 1.0f;
  */
 static constexpr std::size_t MAX_TRIANGLE_COUNTS = 10;
 
+/**
+ * @brief 스트레스 테스트 시 생성할 삼각형의 갯수.
+ */
+static constexpr std::size_t STRESS_TRIANGLE_COUNTS = 1'000'000;
+
 /**
  * @brief 월드 내 모든 삼각형.
  */
-static std::vector<std::unique_ptr<Triangle>> triangles;
+static TriangleSet triangles;
+
+/**
+ * @brief 삼각형 렌더러.
+ */
+static std::unique_ptr<TriangleRenderer> renderer = nullptr;
 
 /**
  * @brief 현재 재생 중인 애니메이션.
@@ -614,6 +590,21 @@ int main()
     const Shader shader(vertexShaderSource, fragmentShaderSource);
     shader.Use();
 
+    // 창 크기가 고정되어 있으므로 투영 행렬은 한 번만 설정합니다.
+    const glm::mat4 projection = glm::ortho(
+        -static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 왼쪽
+         static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 오른쪽
+        -static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 아래
+         static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 위
+        -1.0f,                                     // near
+         1.0f                                      // far
+    );
+
+    const GLint projLoc = glGetUniformLocation(shader.GetProgramID(), "u_Projection");
+    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection));
+
+    renderer = std::make_unique<TriangleRenderer>();
+
     lastTime = static_cast<float>(glfwGetTime());
 
     while (!glfwWindowShouldClose(window))
@@ -626,20 +617,19 @@ int main()
             const float currentTime = static_cast<float>(glfwGetTime());
             const float deltaTime   = (currentTime - lastTime) * timeScale;
 
-            currentAnimation->Update(deltaTime);
+            currentAnimation->Update(triangles, deltaTime);
 
             lastTime = currentTime;
         }
 
         shader.Use();
-        for (const auto& triangle : triangles)
-        {
-            triangle->Draw(shader);
-        }
+        renderer->Draw(triangles);
 
         glfwPollEvents();
         glfwSwapBuffers(window);
     }
+
+    renderer.reset();
 }
 
 Shader::Shader(const char* const vertexSource_,
@@ -673,16 +663,71 @@ Shader::~Shader() noexcept
     }
 }
 
-Triangle::Triangle(const glm::vec2& position_,
-                   const float      size_,
-                   const glm::vec3& color_) noexcept
+void TriangleSet::Add(const glm::vec2& position_,
+                      const float      size_,
+                      const glm::vec3& color_) noexcept
+{
+    positions.push_back(position_);
+    directions.emplace_back(0.0f, 0.0f);
+    sizes.push_back(size_);
+    colors.push_back(color_);
+}
+
+void TriangleSet::Remove(const std::size_t index_) noexcept
+{
+    const std::size_t last = GetCount() - 1;
+
+    positions[index_]  = positions[last];
+    directions[index_] = directions[last];
+    sizes[index_]      = sizes[last];
+    colors[index_]     = colors[last];
+
+    positions.pop_back();
+    directions.pop_back();
+    sizes.pop_back();
+    colors.pop_back();
+}
+
+void TriangleSet::Clear() noexcept
+{
+    positions.clear();
+    directions.clear();
+    sizes.clear();
+    colors.clear();
+}
+
+void TriangleSet::Reserve(const std::size_t capacity_)
+{
+    positions.reserve(capacity_);
+    directions.reserve(capacity_);
+    sizes.reserve(capacity_);
+    colors.reserve(capacity_);
+}
+
+std::size_t TriangleSet::Find(const glm::vec2& point_) const noexcept
+{
+    for (std::size_t index = 0; index < GetCount(); ++index)
+    {
+        const glm::vec2 position = positions[index];
+        const float     size     = sizes[index];
+
+        if ((point_.x >= position.x - size * 0.25f) &&
+            (point_.x <= position.x + size * 0.25f) &&
+            (point_.y >= position.y - size * 0.25f) &&
+            (point_.y <= position.y + size * 0.75f))
+        {
+            return index;
+        }
+    }
+
+    return GetCount();
+}
+
+TriangleRenderer::TriangleRenderer() noexcept
     : vao(0)
     , vbo(0)
-    , ebo(0)
-    , position(position_)
-    , size(size_)
-    , color(color_)
-    , direction(0.0f, 0.0f)
+    , instanceVbo(0)
+    , capacity(0)
 {
     constexpr std::array<float, 6> vertices
     {
@@ -691,11 +736,6 @@ Triangle::Triangle(const glm::vec2& position_,
          1.0f, -1.0f
     };
 
-    constexpr std::array<unsigned int, 3> indices
-    {
-        0, 1, 2
-    };
-
     glGenVertexArrays(1, &vao);
     glBindVertexArray(vao);
 
@@ -703,343 +743,338 @@ Triangle::Triangle(const glm::vec2& position_,
     glBindBuffer(GL_ARRAY_BUFFER, vbo);
     glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GLfloat), vertices.data(), GL_STATIC_DRAW);
 
-    glGenBuffers(1, &ebo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
-
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
     glEnableVertexAttribArray(0);
 
+    glGenBuffers(1, &instanceVbo);
+
+    for (GLuint attribute = 1; attribute <= 4; ++attribute)
+    {
+        glEnableVertexAttribArray(attribute);
+        glVertexAttribDivisor(attribute, 1);
+    }
+
     glBindVertexArray(0);
+
+    Grow(MAX_TRIANGLE_COUNTS);
 }
 
-Triangle::~Triangle() noexcept
+TriangleRenderer::~TriangleRenderer() noexcept
 {
     glDeleteVertexArrays(1, &vao);
     glDeleteBuffers(1, &vbo);
-    glDeleteBuffers(1, &ebo);
+    glDeleteBuffers(1, &instanceVbo);
 }
 
-void Triangle::Draw(const Shader& shader_) const noexcept
+void TriangleRenderer::Draw(const TriangleSet& triangles_) noexcept
 {
-    float angle = 0.0f;
-    if (direction.x != 0.0f || direction.y != 0.0f)
+    const std::size_t count = triangles_.GetCount();
+    if (count == 0)
     {
-        angle = std::atan2(direction.y, direction.x) + glm::radians(270.0f);
+        return;
     }
 
-    glm::mat4 model = {1.0f};
-    model = glm::translate(model, glm::vec3(position, 0.0f));
-    model = glm::rotate(model, angle, glm::vec3(0.0f, 0.0f, 1.0f));
-    model = glm::scale(model, glm::vec3(size, size, 1.0f));
+    if (count > capacity)
+    {
+        Grow(count);
+    }
 
-    glm::mat4 projection = glm::ortho(
-        -static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 왼쪽
-         static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 오른쪽
-        -static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 아래
-         static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 위
-        -1.0f,                                     // near
-         1.0f                                      // far
-    );
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
 
-    const GLint projLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Projection");
-    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection));
+    // 이전 프레임이 사용 중인 저장소를 기다리지 않도록 버퍼를 고아(orphan)로 만든 뒤 채웁니다.
+    glBufferData(GL_ARRAY_BUFFER, capacity * INSTANCE_SIZE, nullptr, GL_STREAM_DRAW);
 
-    const GLint modelLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Model");
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, &model[0][0]);
+    std::size_t offset = 0;
+    glBufferSubData(GL_ARRAY_BUFFER, offset, count * sizeof(glm::vec2), triangles_.positions.data());
 
-    const GLint colorLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Color");
-    glUniform3fv(colorLoc, 1, &color[0]);
+    offset += capacity * sizeof(glm::vec2);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, count * sizeof(glm::vec2), triangles_.directions.data());
+
+    offset += capacity * sizeof(glm::vec2);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, count * sizeof(float), triangles_.sizes.data());
+
+    offset += capacity * sizeof(float);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, count * sizeof(glm::vec3), triangles_.colors.data());
 
     glBindVertexArray(vao);
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, nullptr);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 3, static_cast<GLsizei>(count));
+    glBindVertexArray(0);
+}
+
+void TriangleRenderer::Grow(const std::size_t capacity_) noexcept
+{
+    capacity = std::max(capacity_, capacity * 2);
+
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
+    glBufferData(GL_ARRAY_BUFFER, capacity * INSTANCE_SIZE, nullptr, GL_STREAM_DRAW);
+
+    std::size_t offset = 0;
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), reinterpret_cast<void*>(offset));
+
+    offset += capacity * sizeof(glm::vec2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), reinterpret_cast<void*>(offset));
+
+    offset += capacity * sizeof(glm::vec2);
+    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(float), reinterpret_cast<void*>(offset));
+
+    offset += capacity * sizeof(float);
+    glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), reinterpret_cast<void*>(offset));
+
     glBindVertexArray(0);
 }
 
-void BounceAnimation::Update(const float deltaTime_) noexcept
+void BounceAnimation::Update(TriangleSet& triangles_, const float deltaTime_) noexcept
 {
-    if (velocities.size() != triangles.size())
+    const std::size_t count = triangles_.GetCount();
+
+    if (velocities.size() != count)
     {
         std::uniform_real_distribution<float> directionDist(-1.0f, 1.0f);
         std::uniform_real_distribution<float> speedDist(100.0f, 250.0f);
 
         const float states = speedDist(gen);
 
-        velocities.resize(triangles.size(), glm::vec2(directionDist(gen) * states, directionDist(gen) * states));
+        velocities.resize(count, glm::vec2(directionDist(gen) * states, directionDist(gen) * states));
     }
 
-    for (std::size_t index = 0; index < triangles.size(); ++index)
-    {
-        glm::vec2 currentPosition = triangles.at(index)->GetPosition();
-        glm::vec2 direction = velocities.at(index);
+    constexpr float halfWorldWidth  = WINDOW_WIDTH  / 2.0f;
+    constexpr float halfWorldHeight = WINDOW_HEIGHT / 2.0f;
 
-        currentPosition += direction * deltaTime_;
+    glm::vec2* const   positions  = triangles_.positions.data();
+    glm::vec2* const   directions = triangles_.directions.data();
+    const float* const sizes      = triangles_.sizes.data();
 
-        const float size = triangles.at(index)->GetSize();
+    // 분기 없이 선택(select)만으로 반사와 클램프를 처리해 컴파일러가 벡터화할 수 있도록 합니다.
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        const float halfTriangleSize = 0.5f * sizes[index];
 
-        const float halfTriangleWidth  = 0.5f * size;
-        const float halfTriangleHeight = 0.5f * size;
+        const float maxX =  halfWorldWidth  - halfTriangleSize;
+        const float minX = -halfWorldWidth  + halfTriangleSize;
+        const float maxY =  halfWorldHeight - halfTriangleSize;
+        const float minY = -halfWorldHeight + halfTriangleSize;
 
-        constexpr float halfWorldWidth  = WINDOW_WIDTH  / 2.0f;
-        constexpr float halfWorldHeight = WINDOW_HEIGHT / 2.0f;
+        glm::vec2 currentPosition = positions[index] + velocities[index] * deltaTime_;
+        glm::vec2 direction       = velocities[index];
 
-        if (currentPosition.x - halfTriangleWidth < -halfWorldWidth ||
-            currentPosition.x + halfTriangleWidth >  halfWorldWidth)
-        {
-            direction.x = -direction.x;
+        const bool hasHitX = currentPosition.x < minX || currentPosition.x > maxX;
+        const bool hasHitY = currentPosition.y < minY || currentPosition.y > maxY;
 
-            const float max =  halfWorldWidth - halfTriangleWidth;
-            const float min = -halfWorldWidth + halfTriangleWidth;
-            currentPosition.x = glm::clamp(currentPosition.x, min, max); // x를 클램프
-        }
-
-        if (currentPosition.y - halfTriangleHeight < -halfWorldHeight ||
-            currentPosition.y + halfTriangleHeight >  halfWorldHeight)
-        {
-            direction.y = -direction.y;
+        direction.x = hasHitX ? -direction.x : direction.x;
+        direction.y = hasHitY ? -direction.y : direction.y;
 
-            const float max =  halfWorldHeight - halfTriangleHeight;
-            const float min = -halfWorldHeight + halfTriangleHeight;
-            currentPosition.y = glm::clamp(currentPosition.y, min, max);
-        }
+        currentPosition.x = std::clamp(currentPosition.x, minX, maxX);
+        currentPosition.y = std::clamp(currentPosition.y, minY, maxY);
 
-        triangles.at(index)->SetPosition(currentPosition);
-        triangles.at(index)->SetDirection(direction);
-        velocities.at(index) = direction;
+        positions[index]  = currentPosition;
+        directions[index] = direction;
+        velocities[index] = direction;
     }
 }
 
-void ZigzagAnimation::Update(const float deltaTime_) noexcept
+void ZigzagAnimation::Update(TriangleSet& triangles_, const float deltaTime_) noexcept
 {
-    if (states.size() != triangles.size())
+    const std::size_t count = triangles_.GetCount();
+
+    if (headings.size() != count)
     {
-        states.clear();
-        states.reserve(triangles.size());
+        headings.assign(count, glm::vec2(1.0f, 0.0f));
+        remainings.assign(count, 0.0f);
+        isGoingRights.assign(count, 1);
 
-        for (const auto& t : triangles)
+        for (std::size_t i = 0; i < count; ++i)
         {
-            State state = { };
-            state.originPosition = t->GetPosition();
-            state.currentPosition = state.originPosition;
-            state.currentDirection = glm::vec2(1.0f, 0.0f);
-            state.remaining = horizontalLength;
-            state.row = 0;
-            state.isGoingRight = true;
-
-            states.push_back(state);
-
-            t->SetPosition(state.currentPosition);
-            t->SetDirection(state.currentDirection * speed);
+            triangles_.directions[i] = headings[i] * speed;
         }
     }
 
-    for (std::size_t i = 0; i < triangles.size(); ++i)
+    constexpr float horizontalBoundary = WINDOW_WIDTH  / 2.0f;
+    constexpr float verticalBoundary   = WINDOW_HEIGHT / 2.0f;
+
+    const float distance = speed * deltaTime_;
+
+    glm::vec2* const   positions  = triangles_.positions.data();
+    glm::vec2* const   directions = triangles_.directions.data();
+    const float* const sizes      = triangles_.sizes.data();
+
+    for (std::size_t i = 0; i < count; ++i)
     {
-        auto& state = states[i];
-        auto& triangle = triangles[i];
+        glm::vec2 currentPosition = positions[i];
+        glm::vec2 heading         = headings[i];
+        float     remaining       = remainings[i];
+        bool      isGoingRight    = isGoingRights[i] != 0;
+
+        const float triangleSize = sizes[i];
 
-        if (state.currentDirection.x != 0.0f)
+        if (heading.x != 0.0f)
         {
-            state.currentPosition.x += state.currentDirection.x * speed * deltaTime_;
+            currentPosition.x += heading.x * distance;
 
-            const float horizontalBoundary = WINDOW_WIDTH / 2.0f;
-            const float triangleSize = triangle->GetSize();
-            bool hasHitWall = false;
+            const float limit = horizontalBoundary - triangleSize;
 
-            if (state.currentDirection.x > 0 && state.currentPosition.x > horizontalBoundary - triangleSize) // 오른쪽 벽
-            {
-                state.currentPosition.x = horizontalBoundary - triangleSize; // 벽에 붙이기
-                hasHitWall = true;
-            }
-            else if (state.currentDirection.x < 0 && state.currentPosition.x < -horizontalBoundary + triangleSize) // 왼쪽 벽
-            {
-                state.currentPosition.x = -horizontalBoundary + triangleSize; // 벽에 붙이기
-                hasHitWall = true;
-            }
+            const bool hasHitRight = heading.x > 0.0f && currentPosition.x >  limit; // 오른쪽 벽
+            const bool hasHitLeft  = heading.x < 0.0f && currentPosition.x < -limit; // 왼쪽 벽
+
+            currentPosition.x = hasHitRight ? limit : (hasHitLeft ? -limit : currentPosition.x); // 벽에 붙이기
 
-            if (hasHitWall)
+            if (hasHitRight || hasHitLeft)
             {
-                state.currentDirection = glm::vec2(0.0f, -1.0f);
-                state.remaining = verticalStep;
+                heading   = glm::vec2(0.0f, -1.0f);
+                remaining = verticalStep;
             }
         }
         else
         {
-            float distanceToMove = speed * deltaTime_;
+            const float step = std::min(distance, remaining);
 
-            if (distanceToMove < state.remaining)
-            {
-                state.currentPosition.y += state.currentDirection.y * distanceToMove;
-                state.remaining -= distanceToMove;
-            }
-            else
-            {
-                state.currentPosition.y += state.currentDirection.y * state.remaining;
-                state.remaining = 0;
+            currentPosition.y += heading.y * step;
+            remaining         -= step;
 
-                state.isGoingRight = !state.isGoingRight;
-                state.currentDirection = glm::vec2(state.isGoingRight ? 1.0f : -1.0f, 0.0f);
-                ++state.row;
+            if (remaining <= 0.0f)
+            {
+                remaining    = 0.0f;
+                isGoingRight = !isGoingRight;
+                heading      = glm::vec2(isGoingRight ? 1.0f : -1.0f, 0.0f);
             }
         }
 
-        const float boundary = WINDOW_HEIGHT / 2.0f;
-        const float triangleSize = triangle->GetSize();
-
-        if (state.currentPosition.y < -boundary - triangleSize)
+        if (currentPosition.y < -verticalBoundary - triangleSize)
         {
-            state.currentPosition.y = boundary + triangleSize;
+            currentPosition.y = verticalBoundary + triangleSize;
         }
 
-        triangle->SetPosition(state.currentPosition);
-        triangle->SetDirection(state.currentDirection * speed);
+        positions[i]     = currentPosition;
+        directions[i]    = heading * speed;
+        headings[i]      = heading;
+        remainings[i]    = remaining;
+        isGoingRights[i] = isGoingRight ? 1 : 0;
     }
 }
 
-void OrthogonalAnimation::Update(const float deltaTime_) noexcept
+void OrthogonalAnimation::Update(TriangleSet& triangles_, const float deltaTime_) noexcept
 {
     auto rot90 = [](const glm::vec2& v) -> glm::vec2 { return glm::vec2(-v.y, v.x); };
 
-    if (states.size() != triangles.size())
+    const std::size_t count = triangles_.GetCount();
+
+    if (headings.size() != count)
     {
-        states.clear();
-        states.reserve(triangles.size());
+        origins.assign(triangles_.positions.begin(), triangles_.positions.end()); // 각 삼각형 현재 위치를 중심으로 시작
+        headings.assign(count, glm::vec2(1.0f, 0.0f));                             // +X 방향에서 시작
+        turnCounts.assign(count, 0);
+        lenFactors.assign(count, 1);
+        segLefts.assign(count, StepLen);
 
-        for (const auto& triangle : triangles)
+        for (std::size_t i = 0; i < count; ++i)
         {
-            State state = { };
-            state.origin           = triangle->GetPosition();    // 각 삼각형 현재 위치를 중심으로 시작
-            state.currentPosition  = state.origin;
-            state.currentDirection = glm::vec2(1.0f, 0.0f); // +X 방향에서 시작
-            state.turnCount        = 0;
-            state.lenFactor        = 1;
-            state.segLeft          = StepLen * static_cast<float>(state.lenFactor);
-            states.push_back(state);
-
-            triangle->SetDirection(state.currentDirection * Speed);
+            triangles_.directions[i] = headings[i] * Speed;
         }
     }
 
-    for (std::size_t i = 0; i < triangles.size(); ++i)
+    constexpr float halfW     = WINDOW_WIDTH  * 0.5f;
+    constexpr float halfH     = WINDOW_HEIGHT * 0.5f;
+    constexpr float maxExtent = std::max(halfW, halfH) * 1.2f;
+
+    glm::vec2* const positions  = triangles_.positions.data();
+    glm::vec2* const directions = triangles_.directions.data();
+
+    for (std::size_t i = 0; i < count; ++i)
     {
-        auto& st = states[i];
+        glm::vec2 currentPosition = positions[i];
+        glm::vec2 heading         = headings[i];
+        float     segLeft         = segLefts[i];
+        int       turnCount       = turnCounts[i];
+        int       lenFactor       = lenFactors[i];
+
         float dist = Speed * deltaTime_;
 
         while (dist > 0.0f)
         {
-            if (dist < st.segLeft)
+            if (dist < segLeft)
             {
-                st.currentPosition += st.currentDirection * dist;
-                st.segLeft = st.segLeft - dist;
+                currentPosition += heading * dist;
+                segLeft -= dist;
                 dist = 0.0f;
             }
             else
             {
-                st.currentPosition += st.currentDirection * st.segLeft;
-                dist -= st.segLeft;
+                currentPosition += heading * segLeft;
+                dist -= segLeft;
 
-                st.currentDirection = rot90(st.currentDirection);
-                ++st.turnCount;
+                heading = rot90(heading);
+                ++turnCount;
 
-                if ((st.turnCount % 2) == 0)
+                if ((turnCount % 2) == 0)
                 {
-                    ++st.lenFactor;
+                    ++lenFactor;
                 }
-                st.segLeft = StepLen * static_cast<float>(st.lenFactor);
+                segLeft = StepLen * static_cast<float>(lenFactor);
             }
         }
 
-        triangles[i]->SetPosition(st.currentPosition);
-        triangles[i]->SetDirection(st.currentDirection * Speed);
-
-        constexpr float halfW     = WINDOW_WIDTH  * 0.5f;
-        const float halfH     = WINDOW_HEIGHT * 0.5f;
-        const float maxExtent = std::max(halfW, halfH) * 1.2f;
+        directions[i] = heading * Speed;
 
-        if (glm::length(st.currentPosition - st.origin) > maxExtent)
+        if (glm::length(currentPosition - origins[i]) > maxExtent)
         {
-            st.currentPosition  = st.origin;
-            st.currentDirection = glm::vec2(1.0f, 0.0f);
-            st.turnCount        = 0;
-            st.lenFactor        = 1;
-            st.segLeft          = StepLen * float(st.lenFactor);
+            currentPosition = origins[i];
+            heading         = glm::vec2(1.0f, 0.0f);
+            turnCount       = 0;
+            lenFactor       = 1;
+            segLeft         = StepLen;
         }
+
+        headings[i]   = heading;
+        segLefts[i]   = segLeft;
+        turnCounts[i] = turnCount;
+        lenFactors[i] = lenFactor;
+        positions[i]  = currentPosition;
     }
 }
 
-void SpiralAnimation::Update(const float deltaTime_) noexcept
+void SpiralAnimation::Update(TriangleSet& triangles_, const float deltaTime_) noexcept
 {
     constexpr float kStep = 24.0f;                                          // k: 한 바퀴당 반경 증가량(픽셀/라디안)에 비례 (실감상 16~48 적당)
     constexpr float speed = 160.0f;                                         // 거의 일정한 화면상 속도(픽셀/초)
     constexpr float r0 = 0.0f;                                              // 시작 반경
     constexpr float maxOut = std::max(WINDOW_WIDTH, WINDOW_HEIGHT) * 0.7f;
 
-    if (states.size() != triangles.size())
-    {
-        states.clear();
-        states.reserve(triangles.size());
+    const std::size_t count = triangles_.GetCount();
 
-        // 각 삼각형을 현재 위치를 중심으로 시작
-        for (const auto& t : triangles)
-        {
-            State st{};
-            st.origin = t->GetPosition();
-            st.theta  = 0.0f;
-            st.k      = kStep;
-            st.r0     = r0;
-            st.speed  = speed;
-            states.push_back(st);
-
-            // 초기 위치/방향 반영
-            const float r   = st.r0 + st.k * st.theta;
-            const float cs  = std::cos(st.theta);
-            const float sn  = std::sin(st.theta);
-            const glm::vec2 currentPosition = st.origin + glm::vec2(r * cs, r * sn);
-            t->SetPosition(currentPosition);
-
-            // 초기 접선 방향 (d/dθ [r(θ)(cosθ, sinθ)] = (r'cosθ - r sinθ, r' sinθ + r cosθ))
-            const float rp  = st.k;
-            glm::vec2 tangent(rp*cs - r*sn, rp*sn + r*cs);
-            if (glm::dot(tangent, tangent) > 0.0f) tangent = glm::normalize(tangent);
-            t->SetDirection(tangent * st.speed);
-        }
+    // 각 삼각형을 현재 위치를 중심으로 시작
+    if (thetas.size() != count)
+    {
+        origins.assign(triangles_.positions.begin(), triangles_.positions.end());
+        thetas.assign(count, 0.0f);
     }
 
-    // 업데이트
-    for (std::size_t i = 0; i < triangles.size(); ++i)
-    {
-        auto& st = states[i];
-        auto& tri = triangles[i];
+    glm::vec2* const       positions  = triangles_.positions.data();
+    glm::vec2* const       directions = triangles_.directions.data();
+    const glm::vec2* const centers    = origins.data();
+    float* const           angles     = thetas.data();
 
+    // 모든 삼각형이 같은 k, r0, speed를 공유하므로 상태는 각도 하나뿐이며, 분기 없는 한 번의 순회로 갱신됩니다.
+    for (std::size_t i = 0; i < count; ++i)
+    {
         // 현재 r와 호길이 미분에 따른 theta 증가율
-        const float r   = st.r0 + st.k * st.theta;
-        const float dsd = std::sqrt(r*r + st.k*st.k); // ds/dθ
-        float dtheta_dt = 0.0f;
-        if (dsd > 0.0f)
-        {
-            dtheta_dt = st.speed / dsd;
-        }
+        const float r   = r0 + kStep * angles[i];
+        const float dsd = std::sqrt(r * r + kStep * kStep); // ds/dθ
 
-        st.theta += dtheta_dt * deltaTime_;
+        float theta = angles[i] + (speed / dsd) * deltaTime_;
 
         // 새 좌표
-        const float cs  = std::cos(st.theta);
-        const float sn  = std::sin(st.theta);
-        const float r2  = st.r0 + st.k * st.theta;
-        const glm::vec2 currentPosition = st.origin + glm::vec2(r2 * cs, r2 * sn);
-        tri->SetPosition(currentPosition);
+        const float cs = std::cos(theta);
+        const float sn = std::sin(theta);
+        const float r2 = r0 + kStep * theta;
+
+        positions[i] = centers[i] + glm::vec2(r2 * cs, r2 * sn);
 
         // 접선 벡터(정규화) → velocity 동기화(시각적 회전 재사용)
-        const float rp  = st.k;
-        glm::vec2 tangent(rp*cs - r2*sn, rp*sn + r2*cs);
-        if (glm::dot(tangent, tangent) > 0.0f) tangent = glm::normalize(tangent);
-        tri->SetDirection(tangent * st.speed);
+        const glm::vec2 tangent(kStep * cs - r2 * sn, kStep * sn + r2 * cs);
+        directions[i] = tangent * (speed / std::sqrt(r2 * r2 + kStep * kStep));
 
-        // 너무 멀리 나가면 리셋(원점에서 다시 시작)
-        if (glm::length(currentPosition - st.origin) > maxOut)
-        {
-            st.theta = 0.0f;
-        }
+        // 너무 멀리 나가면 리셋(원점에서 다시 시작), 원점으로부터의 거리는 |r2|와 같습니다.
+        angles[i] = (std::abs(r2) > maxOut) ? 0.0f : theta;
     }
 }
 
@@ -1146,10 +1181,29 @@ void OnKeyInteracted(GLFWwindow* const window_,
         case GLFW_KEY_C:
         {
             currentAnimation.reset();
-            triangles.clear();
+            triangles.Clear();
             std::cout << "[Info] All triangles cleared.\n";
             break;
         }
+        case GLFW_KEY_S:
+        {
+            std::uniform_real_distribution<float> xDist(-WINDOW_WIDTH / 2.0f, WINDOW_WIDTH / 2.0f);
+            std::uniform_real_distribution<float> yDist(-WINDOW_HEIGHT / 2.0f, WINDOW_HEIGHT / 2.0f);
+            std::uniform_real_distribution<float> sizeDist(2.0f, 6.0f);
+            std::uniform_real_distribution<float> colorDist(0.0f, 1.0f);
+
+            triangles.Reserve(triangles.GetCount() + STRESS_TRIANGLE_COUNTS);
+            for (std::size_t count = 0; count < STRESS_TRIANGLE_COUNTS; ++count)
+            {
+                triangles.Add(glm::vec2(xDist(gen), yDist(gen)),
+                              sizeDist(gen),
+                              glm::vec3(colorDist(gen), colorDist(gen), colorDist(gen)));
+            }
+
+            std::cout << std::format("[Info] {:d} triangles spawned for stress test. ", STRESS_TRIANGLE_COUNTS)
+                      << std::format("Total Counts: {:d}\n", triangles.GetCount());
+            break;
+        }
         case GLFW_KEY_Q:
         {
             glfwSetWindowShouldClose(window_, true);
@@ -1174,7 +1228,7 @@ void OnButtonInteracted(GLFWwindow* const window_,
 
     if (button_ == GLFW_MOUSE_BUTTON_LEFT)
     {
-        if (triangles.size() >= MAX_TRIANGLE_COUNTS)
+        if (triangles.GetCount() >= MAX_TRIANGLE_COUNTS)
         {
             std::cout << "[Warning] Cannot create more triangles!\n";
             return;
@@ -1188,24 +1242,19 @@ void OnButtonInteracted(GLFWwindow* const window_,
         std::uniform_real_distribution<float> colorDist(0.0f, 1.0f);
         const glm::vec3 color = glm::vec3(colorDist(gen), colorDist(gen), colorDist(gen));
 
-        triangles.push_back(std::make_unique<Triangle>(currentPosition, size, color));
+        triangles.Add(currentPosition, size, color);
 
         std::cout << std::format("[Info] New triangle created at ({:.1f}, {:.1f}). ", currentPosition.x, currentPosition.y)
-                  << std::format("Total Counts: {:d}\n", static_cast<int>(triangles.size()));
+                  << std::format("Total Counts: {:d}\n", static_cast<int>(triangles.GetCount()));
     }
     else if (button_ == GLFW_MOUSE_BUTTON_RIGHT)
     {
-        for (auto iter = triangles.begin(); iter != triangles.end(); ++iter)
+        if (const std::size_t index = triangles.Find(cursorPosition); index < triangles.GetCount())
         {
-            if ((*iter)->IsInteract(cursorPosition))
-            {
-                triangles.erase(iter);
-
-                std::cout << std::format("[Info] Triangle removed at ({:.1f}, {:.1f}). ", cursorPosition.x, cursorPosition.y)
-                          << std::format("Total Counts: {:d}\n", static_cast<int>(triangles.size()) );
+            triangles.Remove(index);
 
-                return;
-            }
+            std::cout << std::format("[Info] Triangle removed at ({:.1f}, {:.1f}). ", cursorPosition.x, cursorPosition.y)
+                      << std::format("Total Counts: {:d}\n", static_cast<int>(triangles.GetCount()) );
         }
     }
 }
@@ -1251,9 +1300,9 @@ void StartAnimation()
 {
     std::uniform_real_distribution<float>velDist(-100.0f, 100.0f);
 
-    for (const std::unique_ptr<Triangle>& triangle : triangles)
+    for (glm::vec2& direction : triangles.directions)
     {
-        triangle->SetDirection({ velDist(gen), velDist(gen) });
+        direction = { velDist(gen), velDist(gen) };
     }
     lastTime = static_cast<float>(glfwGetTime());
     currentAnimation = std::make_unique<TAnimation>();
@@ -1263,8 +1312,5 @@ void StopAnimation() noexcept
 {
     currentAnimation.reset();
 
-    for (const std::unique_ptr<Triangle>& triangle : triangles)
-    {
-        triangle->SetDirection({ 0.0f, 0.0f });
-    }
+    std::ranges::fill(triangles.directions, glm::vec2(0.0f, 0.0f));
 }
\ No newline at end of file
@@ -1,11 +1,29 @@
 #version 450 core
 
-layout (location = 0) in vec2 aPos;
+layout (location = 0) in vec2  aPos;
+layout (location = 1) in vec2  aOffset;
+layout (location = 2) in vec2  aDirection;
+layout (location = 3) in float aSize;
+layout (location = 4) in vec3  aColor;
 
-uniform mat4 u_Model;
 uniform mat4 u_Projection;
 
+out vec3 vColor;
+
 void main()
 {
-    gl_Position = u_Projection * u_Model * vec4(aPos, 0.0, 1.0);
-}
\ No newline at end of file
+    // 진행 방향 기준으로 회전합니다. (atan2(direction) + 270도 회전과 같습니다.)
+    vec2 axis = vec2(1.0, 0.0);
+    if (dot(aDirection, aDirection) > 0.0)
+    {
+        const vec2 direction = normalize(aDirection);
+        axis = vec2(direction.y, -direction.x);
+    }
+
+    const vec2 scaled  = aPos * aSize;
+    const vec2 rotated = vec2(scaled.x * axis.x - scaled.y * axis.y,
+                              scaled.x * axis.y + scaled.y * axis.x);
+
+    vColor = aColor;
+    gl_Position = u_Projection * vec4(aOffset + rotated, 0.0, 1.0);
+}
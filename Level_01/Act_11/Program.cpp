@@ -1,7 +1,12 @@
-﻿#include <filesystem>
+﻿#include <algorithm>
+#include <filesystem>
+#include <format>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <random>
+#include <vector>
 
 #include <glad/glad.h>
 
@@ -66,30 +71,175 @@ class Shader final
     unsigned int programID;
 };
 
-class Spiral
+/**
+ * @struct SpiralKey
+ *
+ * @brief 스파이럴 점들을 생성하는 데 필요한 값들을 정의합니다.
+ */
+struct SpiralKey
+{
+    /**
+     * @brief 피치.
+     */
+    float pitch;
+
+    /**
+     * @brief 회전 수.
+     */
+    float turns;
+
+    /**
+     * @brief 점 간격.
+     */
+    float spacing;
+
+    /**
+     * @brief 시작 각도.
+     */
+    float start;
+
+    /**
+     * @brief 시계 반대 방향으로 먼저 감기는지 여부.
+     */
+    bool shouldReverse;
+
+    auto operator<=>(const SpiralKey&) const = default;
+};
+
+/**
+ * @struct SpiralRange
+ *
+ * @brief 공유 정점 버퍼 내 스파이럴 점들의 구간을 정의합니다.
+ */
+struct SpiralRange
+{
+    /**
+     * @brief 첫 번째 점의 인덱스.
+     */
+    GLuint first;
+
+    /**
+     * @brief 점의 갯수.
+     */
+    GLuint count;
+};
+
+/**
+ * @class SpiralCache
+ *
+ * @brief 생성 값 별로 스파이럴 점들을 한 번만 생성하여 하나의 정점 버퍼에 모아 보관합니다.
+ */
+class SpiralCache final
 {
 public:
     /**
      * @brief 생성자.
-     *
-     * @param center_ 중심 좌표.
      */
-    explicit Spiral(const glm::vec2 center_) noexcept;
+    explicit SpiralCache() noexcept;
 
     /**
      * @brief 소멸자.
      */
-    ~Spiral() noexcept;
+    ~SpiralCache() noexcept;
+
+    SpiralCache(const SpiralCache&) = delete;
+    SpiralCache& operator=(const SpiralCache&) = delete;
 
     /**
-     * @brief 스파이럴을 그립니다.
+     * @brief 지정한 생성 값에 해당하는 스파이럴의 구간을 반환합니다. 없다면 생성합니다.
      *
-     * @param shader_    사용할 셰이더.
-     * @param deltaTime_ 시간 변화량.
+     * @param key_ 생성 값.
+     *
+     * @return SpiralRange 공유 정점 버퍼 내 구간.
+     */
+    SpiralRange Acquire(const SpiralKey& key_) noexcept;
+
+    /**
+     * @brief 공유 정점 버퍼 객체를 반환합니다.
+     *
+     * @return unsigned int 공유 정점 버퍼 객체.
      */
-    void Draw(const Shader& shader_,
-              const float   deltaTime_) noexcept;
+    [[nodiscard]]
+    constexpr unsigned int GetVertexBuffer() const noexcept
+    {
+        return vbo;
+    }
 private:
+    /**
+     * @brief 공유 정점 버퍼 객체.
+     */
+    unsigned int vbo = 0;
+
+    /**
+     * @brief 공유 정점 버퍼가 담을 수 있는 점의 갯수.
+     */
+    std::size_t capacity = 0;
+
+    /**
+     * @brief 모든 스파이럴의 점들.
+     */
+    std::vector<glm::vec2> points;
+
+    /**
+     * @brief 생성 값 별 구간.
+     */
+    std::map<SpiralKey, SpiralRange> ranges;
+};
+
+/**
+ * @class Spiral
+ *
+ * @brief 화면에 그려지는 스파이럴 하나를 정의합니다.
+ */
+class Spiral final
+{
+public:
+    /**
+     * @brief 생성자.
+     *
+     * @param center_ 중심 좌표.
+     * @param range_  공유 정점 버퍼 내 구간.
+     */
+    explicit Spiral(const glm::vec2   center_,
+                    const SpiralRange range_) noexcept;
+
+    /**
+     * @brief 스파이럴의 진행률을 갱신합니다.
+     *
+     * @param deltaTime_ 시간 변화량.
+     */
+    void Update(const float deltaTime_) noexcept;
+
+    /**
+     * @brief 현재 진행률까지 드러난 점의 갯수를 반환합니다.
+     *
+     * @return GLuint 드러난 점의 갯수.
+     */
+    [[nodiscard]]
+    GLuint GetVisibleCount() const noexcept;
+
+    /**
+     * @brief 중심 좌표를 반환합니다.
+     *
+     * @return glm::vec2 중심 좌표.
+     */
+    [[nodiscard]]
+    constexpr glm::vec2 GetPosition() const noexcept
+    {
+        return position;
+    }
+
+    /**
+     * @brief 공유 정점 버퍼 내 구간을 반환합니다.
+     *
+     * @return SpiralRange 공유 정점 버퍼 내 구간.
+     */
+    [[nodiscard]]
+    constexpr SpiralRange GetRange() const noexcept
+    {
+        return range;
+    }
+
     /**
      * @brief 중심점.
      */
@@ -109,6 +259,67 @@ class Spiral
      * @brief 시작 각도.
      */
     static constexpr float start = 0.0f;
+private:
+    /**
+     * @brief 현재 위치.
+     */
+    glm::vec2 position;
+
+    /**
+     * @brief 공유 정점 버퍼 내 구간.
+     */
+    SpiralRange range;
+
+    /**
+     * @brief 현재 진행률.
+     */
+    float progress = 0.0f;
+};
+
+/**
+ * @class SpiralRenderer
+ *
+ * @brief 모든 스파이럴을 한 번의 다중 드로우로 렌더링합니다.
+ */
+class SpiralRenderer final
+{
+public:
+    /**
+     * @brief 생성자.
+     *
+     * @param cache_ 점들을 가져올 스파이럴 캐시.
+     */
+    explicit SpiralRenderer(const SpiralCache& cache_) noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~SpiralRenderer() noexcept;
+
+    SpiralRenderer(const SpiralRenderer&) = delete;
+    SpiralRenderer& operator=(const SpiralRenderer&) = delete;
+
+    /**
+     * @brief 지정한 스파이럴들을 렌더링합니다.
+     *
+     * @param spirals_ 렌더링할 스파이럴들.
+     * @param mode_    렌더링 모드.
+     */
+    void Draw(const std::vector<Spiral>& spirals_,
+              const GLenum               mode_) noexcept;
+private:
+    /**
+     * @struct DrawCommand
+     *
+     * @brief glMultiDrawArraysIndirect의 명령 하나를 정의합니다.
+     */
+    struct DrawCommand
+    {
+        GLuint count;
+        GLuint instanceCount;
+        GLuint first;
+        GLuint baseInstance;
+    };
 
     /**
      * @brief 정점 배열 객체.
@@ -116,24 +327,24 @@ class Spiral
     unsigned int vao = 0;
 
     /**
-     * @brief 정점 버퍼 객체.
+     * @brief 스파이럴 별 중심 좌표 버퍼 객체.
      */
-    unsigned int vbo = 0;
+    unsigned int offsetVbo = 0;
 
     /**
-     * @brief 현재 위치.
+     * @brief 드로우 명령 버퍼 객체.
      */
-    glm::vec2 position;
+    unsigned int commandBuffer = 0;
 
     /**
-     * @brief 점들.
+     * @brief 매 프레임 재사용하는 드로우 명령들.
      */
-    std::vector<glm::vec2> points;
+    std::vector<DrawCommand> commands;
 
     /**
-     * @brief 현재 진행률.
+     * @brief 매 프레임 재사용하는 중심 좌표들.
      */
-    float progress = 0.0f;
+    std::vector<glm::vec2> offsets;
 };
 
 /**
@@ -265,16 +476,31 @@ static constexpr float PI  = 3.14159265358979323846f;
  */
 static constinit bool isLineMode = false;
 
+/**
+ * @brief 스파이럴 점 캐시.
+ */
+static std::unique_ptr<SpiralCache> spiralCache = nullptr;
+
+/**
+ * @brief 스파이럴 렌더러.
+ */
+static std::unique_ptr<SpiralRenderer> spiralRenderer = nullptr;
+
 /**
  * @brief 월드 내 스파이럴들.
  */
-static std::vector<std::unique_ptr<Spiral>> spirals;
+static std::vector<Spiral> spirals;
 
 /**
  * @brief 월드 내 있을 수 있는 스파이럴의 최대 갯수.
  */
 static std::size_t maxSpiralCount = 5;
 
+/**
+ * @brief 스트레스 테스트 시 생성할 스파이럴의 갯수.
+ */
+static constexpr std::size_t STRESS_SPIRAL_COUNT = 500;
+
 int main()
 {
     if (!glfwInit())
@@ -325,6 +551,27 @@ int main()
     static Shader shader(vertexShaderSource, fragmentShaderSource);
     shader.Use();
 
+    // 창 크기와 색상은 바뀌지 않으므로 한 번만 설정합니다.
+    const glm::mat4 projection = glm::ortho(
+       -static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 왼쪽
+        static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 오른쪽
+       -static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 아래
+        static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 위
+       -1.0f,                                     // near
+        1.0f                                      // far
+    );
+
+    const GLint projLoc = glGetUniformLocation(shader.GetProgramID(), "u_Projection");
+    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection));
+
+    const GLint colorLoc = glGetUniformLocation(shader.GetProgramID(), "u_Color");
+    glUniform3f(colorLoc, 1.0f, 1.0f, 1.0f);
+
+    glPointSize(3.0f);
+
+    spiralCache    = std::make_unique<SpiralCache>();
+    spiralRenderer = std::make_unique<SpiralRenderer>(*spiralCache);
+
     static float lastTime = static_cast<float>(glfwGetTime());
 
     while (!glfwWindowShouldClose(window))
@@ -339,14 +586,20 @@ int main()
 
         shader.Use();
 
-        for (std::unique_ptr<Spiral>& spiral : spirals)
+        for (Spiral& spiral : spirals)
         {
-            spiral->Draw(shader, deltaTime);
+            spiral.Update(deltaTime);
         }
 
+        spiralRenderer->Draw(spirals, isLineMode ? GL_LINE_STRIP : GL_POINTS);
+
         glfwPollEvents();
         glfwSwapBuffers(window);
     }
+
+    spirals.clear();
+    spiralRenderer.reset();
+    spiralCache.reset();
 }
 
 Shader::Shader(const char* const vertexSource_,
@@ -380,16 +633,33 @@ Shader::~Shader() noexcept
     }
 }
 
-Spiral::Spiral(const glm::vec2 center_) noexcept
-    : position(center_)
+SpiralCache::SpiralCache() noexcept
 {
-    std::uniform_int_distribution<int> distReverse(0, 1);
+    glGenBuffers(1, &vbo);
+}
+
+SpiralCache::~SpiralCache() noexcept
+{
+    if (vbo)
+    {
+        glDeleteBuffers(1, &vbo);
+    }
+}
 
-    if (static_cast<bool>(distReverse(gen)))
+SpiralRange SpiralCache::Acquire(const SpiralKey& key_) noexcept
+{
+    if (const auto iter = ranges.find(key_); iter != ranges.end())
     {
-        std::vector<glm::vec2> left  = GenerateSpiralPoints(pitch, turns, spacing, start, true);
-        std::vector<glm::vec2> right = GenerateSpiralPoints(pitch, turns, spacing, start, false);
+        return iter->second;
+    }
+
+    std::vector<glm::vec2> left  = GenerateSpiralPoints(key_.pitch, key_.turns, key_.spacing, key_.start, true);
+    std::vector<glm::vec2> right = GenerateSpiralPoints(key_.pitch, key_.turns, key_.spacing, key_.start, false);
 
+    const std::size_t first = points.size();
+
+    if (key_.shouldReverse)
+    {
         std::ranges::reverse(right);
 
         for (auto& p : right) { p.x = 170 - p.x; }
@@ -399,9 +669,6 @@ Spiral::Spiral(const glm::vec2 center_) noexcept
     }
     else
     {
-        std::vector<glm::vec2> left  = GenerateSpiralPoints(pitch, turns, spacing, start, true);
-        std::vector<glm::vec2> right = GenerateSpiralPoints(pitch, turns, spacing, start, false);
-
         for (auto& p : left) { p.x = 170 - p.x; }
 
         std::ranges::reverse(left);
@@ -410,24 +677,86 @@ Spiral::Spiral(const glm::vec2 center_) noexcept
         points.insert(points.end(), left.begin(), left.end());
     }
 
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
+    const std::size_t count = points.size() - first;
 
-    glGenBuffers(1, &vbo);
     glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(glm::vec2), points.data(), GL_STATIC_DRAW);
 
+    if (points.size() > capacity)
+    {
+        // 버퍼 이름은 그대로 두고 저장소만 키우므로, 이 버퍼를 참조하는 정점 배열 객체는 다시 설정할 필요가 없습니다.
+        capacity = std::max(points.size(), capacity * 2);
+
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(glm::vec2), nullptr, GL_STATIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, points.size() * sizeof(glm::vec2), points.data());
+    }
+    else
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, first * sizeof(glm::vec2), count * sizeof(glm::vec2), points.data() + first);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    const SpiralRange range = {static_cast<GLuint>(first), static_cast<GLuint>(count)};
+    ranges.emplace(key_, range);
+
+    return range;
+}
+
+Spiral::Spiral(const glm::vec2   center_,
+               const SpiralRange range_) noexcept
+    : position(center_)
+    , range(range_)
+{
+
+}
+
+void Spiral::Update(const float deltaTime_) noexcept
+{
+    constexpr float thetaMax = 2.0f * PI * turns;
+
+    if ((progress += 2.5f * deltaTime_) > thetaMax)
+    {
+        progress = thetaMax;
+    }
+}
+
+GLuint Spiral::GetVisibleCount() const noexcept
+{
+    constexpr float thetaMax = 2.0f * PI * turns;
+
+    return static_cast<GLuint>((progress / thetaMax) * static_cast<float>(range.count));
+}
+
+SpiralRenderer::SpiralRenderer(const SpiralCache& cache_) noexcept
+{
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    glBindBuffer(GL_ARRAY_BUFFER, cache_.GetVertexBuffer());
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), nullptr);
 
+    glGenBuffers(1, &offsetVbo);
+    glBindBuffer(GL_ARRAY_BUFFER, offsetVbo);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), nullptr);
+    glVertexAttribDivisor(1, 1);
+
+    glGenBuffers(1, &commandBuffer);
+
     glBindVertexArray(0);
 }
 
-Spiral::~Spiral() noexcept
+SpiralRenderer::~SpiralRenderer() noexcept
 {
-    if (vbo)
+    if (commandBuffer)
     {
-        glDeleteBuffers(1, &vbo);
+        glDeleteBuffers(1, &commandBuffer);
+    }
+
+    if (offsetVbo)
+    {
+        glDeleteBuffers(1, &offsetVbo);
     }
 
     if (vao)
@@ -436,47 +765,42 @@ Spiral::~Spiral() noexcept
     }
 }
 
-void Spiral::Draw(const Shader& shader_,
-                  const float   deltaTime_) noexcept
+void SpiralRenderer::Draw(const std::vector<Spiral>& spirals_,
+                          const GLenum               mode_) noexcept
 {
-    constexpr float thetaMax = 2.0f * PI * turns;
+    commands.clear();
+    offsets.clear();
 
-    if ((progress += 2.5f * deltaTime_) > thetaMax)
+    for (const Spiral& spiral : spirals_)
     {
-        progress = thetaMax;
+        const GLuint count = spiral.GetVisibleCount();
+        if (count == 0)
+        {
+            continue;
+        }
+
+        // baseInstance로 해당 스파이럴의 중심 좌표를 가리킵니다.
+        commands.push_back({count, 1, spiral.GetRange().first, static_cast<GLuint>(offsets.size())});
+        offsets.push_back(spiral.GetPosition());
     }
 
-    const size_t maxCount = (progress / thetaMax) * points.size();
-    if (maxCount == 0)
+    if (commands.empty())
     {
         return;
     }
 
-    glm::mat4 projection = glm::ortho(
-       -static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 왼쪽
-        static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 오른쪽
-       -static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 아래
-        static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 위
-       -1.0f,                                     // near
-        1.0f                                      // far
-   );
-
-    const GLint projLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Projection");
-    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection));
-
-    glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(position, 0.0f));
-    model = glm::scale(model, glm::vec3(1.0f, 1.0f, 1.0f));
+    glBindBuffer(GL_ARRAY_BUFFER, offsetVbo);
+    glBufferData(GL_ARRAY_BUFFER, offsets.size() * sizeof(glm::vec2), offsets.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-    const GLint modelLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Model");
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, &model[0][0]);
-
-    const GLint colorLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Color");
-    glUniform3f(colorLoc, 1.0f, 1.0f, 1.0f);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(DrawCommand), commands.data(), GL_STREAM_DRAW);
 
     glBindVertexArray(vao);
-    glPointSize(3.0f);
-    glDrawArrays(isLineMode ? GL_LINE_STRIP : GL_POINTS, 0, static_cast<GLsizei>(maxCount));
+    glMultiDrawArraysIndirect(mode_, nullptr, static_cast<GLsizei>(commands.size()), 0);
     glBindVertexArray(0);
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
 }
 
 void OnDebugMessage(const GLenum        source_,
@@ -599,6 +923,26 @@ void OnKeyInteracted(GLFWwindow* const window_,
             spirals.clear();
             break;
         }
+        case GLFW_KEY_S:
+        {
+            std::uniform_real_distribution<float> distX(-WINDOW_WIDTH / 2.0f, WINDOW_WIDTH / 2.0f);
+            std::uniform_real_distribution<float> distY(-WINDOW_HEIGHT / 2.0f, WINDOW_HEIGHT / 2.0f);
+            std::uniform_int_distribution<int>    distReverse(0, 1);
+
+            maxSpiralCount = std::max(maxSpiralCount, spirals.size() + STRESS_SPIRAL_COUNT);
+            spirals.reserve(maxSpiralCount);
+
+            for (std::size_t count = 0; count < STRESS_SPIRAL_COUNT; ++count)
+            {
+                const SpiralKey key = {Spiral::pitch, Spiral::turns, Spiral::spacing, Spiral::start, static_cast<bool>(distReverse(gen))};
+                spirals.emplace_back(glm::vec2(distX(gen), distY(gen)), spiralCache->Acquire(key));
+            }
+
+            std::cout << std::format("[Info] {:d} spirals spawned for stress test. Total Counts: {:d}\n",
+                    STRESS_SPIRAL_COUNT, spirals.size());
+
+            break;
+        }
         case GLFW_KEY_UP:
         {
             if (constexpr float MAX_TIME_SCALE = 30.0f; (timeScale += 1.0f) > MAX_TIME_SCALE)
@@ -674,7 +1018,10 @@ void OnButtonInteracted(GLFWwindow* const window_,
 
         const glm::vec2 cursorPosition = {ndcX, ndcY};
 
-        spirals.emplace_back(std::make_unique<Spiral>(cursorPosition));
+        std::uniform_int_distribution<int> distReverse(0, 1);
+
+        const SpiralKey key = {Spiral::pitch, Spiral::turns, Spiral::spacing, Spiral::start, static_cast<bool>(distReverse(gen))};
+        spirals.emplace_back(cursorPosition, spiralCache->Acquire(key));
 
         std::uniform_real_distribution<float> distColor(0.0f, 1.0f);
         backgroundColor = {distColor(gen), distColor(gen), distColor(gen)};
@@ -1,11 +1,11 @@
 #version 450 core
 
 layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec2 aOffset;
 
-uniform mat4 u_Model;
 uniform mat4 u_Projection;
 
 void main()
 {
-    gl_Position = u_Projection * u_Model * vec4(aPos, 0.0, 1.0);
-}
\ No newline at end of file
+    gl_Position = u_Projection * vec4(aPos + aOffset, 0.0, 1.0);
+}
@@ -1,5 +1,7 @@
 ﻿#include "Application.h"
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <ios>
 #include <memory>
@@ -15,6 +17,8 @@
 
 #include "Shader.h"
 #include "Shape.h"
+#include "ShapeRenderer.h"
+#include "SpatialGrid.h"
 
 /**
  * @brief GLFW 윈도우 핸들.
@@ -41,6 +45,11 @@ constinit float timeScale = 1.0f;
  */
 constinit std::unique_ptr<Shader> shader = nullptr;
 
+/**
+ * @brief 모든 도형을 일괄로 그리는 렌더러.
+ */
+constinit std::unique_ptr<ShapeRenderer> shapeRenderer = nullptr;
+
 /**
  * @brief 난수 생성기.
  */
@@ -56,11 +65,36 @@ std::mt19937 gen(rd());
  */
 constexpr std::size_t INITIAL_SHAPE_COUNTS = 10;
 
+/**
+ * @brief 일반 모드에서 사용할 공간 격자 셀의 크기.
+ */
+constexpr float SHAPE_CELL_SIZE = 100.0f;
+
+/**
+ * @brief 스트레스 모드에서 생성할 도형의 개수.
+ */
+constexpr std::size_t STRESS_SHAPE_COUNTS = 100'000;
+
+/**
+ * @brief 스트레스 모드에서 사용할 공간 격자 셀의 크기.
+ */
+constexpr float STRESS_CELL_SIZE = 8.0f;
+
+/**
+ * @brief 월드 내 도형들을 질의하기 위한 공간 격자. (도형들보다 먼저 선언되어 나중에 파괴됩니다)
+ */
+std::unique_ptr<SpatialGrid> grid = nullptr;
+
 /**
  * @brief 월드 내 모든 도형들.
  */
 std::vector<std::unique_ptr<Shape>> shapes;
 
+/**
+ * @brief 영역 질의 결과. (매 질의마다 재사용됩니다)
+ */
+std::vector<Shape*> queryResults;
+
 /**
  * @brief 현재 선택된 도형.
  */
@@ -128,6 +162,20 @@ void Initialize() noexcept
 
     shader = std::make_unique<Shader>(vertexShaderSource, fragmentShaderSource);
     shader->Use();
+
+    const glm::mat4 projection = glm::ortho(
+       -static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 왼쪽
+        static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 오른쪽
+       -static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 아래
+        static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 위
+       -1.0f,                                     // near
+        1.0f                                      // far
+    );
+
+    const GLint projLoc = glGetUniformLocation(shader->GetProgramID(), "u_Projection");
+    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection));
+
+    shapeRenderer = std::make_unique<ShapeRenderer>();
 }
 
 void Run() noexcept
@@ -170,11 +218,7 @@ void Render() noexcept
     glClear(GL_COLOR_BUFFER_BIT);
 
     shader->Use();
-
-    for (const std::unique_ptr<Shape>& shape : shapes)
-    {
-        shape->Render(*(shader.get()));
-    }
+    shapeRenderer->Render(shapes);
 
     glfwSwapBuffers(window);
 }
@@ -186,6 +230,11 @@ void Reset() noexcept
         shapes.clear();
     }
 
+    selectedShape = nullptr;
+
+    constexpr glm::vec2 worldMax = { WINDOW_WIDTH * 0.5f, WINDOW_HEIGHT * 0.5f };
+    grid = std::make_unique<SpatialGrid>(-worldMax, worldMax, SHAPE_CELL_SIZE);
+
     std::uniform_int_distribution<int> distType(static_cast<int>(Shape::Type::Dot), static_cast<int>(Shape::Type::Pentagon));
     std::uniform_real_distribution<float> distPosition(-100.0f, 100.0f);
 
@@ -194,8 +243,59 @@ void Reset() noexcept
         const Shape::Type type = static_cast<Shape::Type>(distType(gen));
         const glm::vec2 position{distPosition(gen), distPosition(gen)};
 
-        shapes.push_back(std::make_unique<Shape>(type, position));
+        Shape* const shape = shapes.emplace_back(std::make_unique<Shape>(type, position)).get();
+        shape->SetIndex(shapes.size() - 1);
+        grid->Insert(*shape);
+    }
+}
+
+void Stress() noexcept
+{
+    shapes.clear();
+    selectedShape = nullptr;
+
+    constexpr glm::vec2 worldMax = { WINDOW_WIDTH * 0.5f, WINDOW_HEIGHT * 0.5f };
+    grid = std::make_unique<SpatialGrid>(-worldMax, worldMax, STRESS_CELL_SIZE);
+
+    std::uniform_int_distribution<int>    distType(static_cast<int>(Shape::Type::Dot), static_cast<int>(Shape::Type::Pentagon));
+    std::uniform_real_distribution<float> distX(-worldMax.x, worldMax.x);
+    std::uniform_real_distribution<float> distY(-worldMax.y, worldMax.y);
+    std::uniform_real_distribution<float> distScale(2.0f, 6.0f);
+    std::uniform_real_distribution<float> distDirection(-1.0f, 1.0f);
+
+    shapes.reserve(STRESS_SHAPE_COUNTS);
+
+    for (std::size_t i = 0; i < STRESS_SHAPE_COUNTS; ++i)
+    {
+        const Shape::Type type = static_cast<Shape::Type>(distType(gen));
+
+        Shape* const shape = shapes.emplace_back(std::make_unique<Shape>(type, glm::vec2{distX(gen), distY(gen)})).get();
+        shape->SetIndex(shapes.size() - 1);
+        shape->SetScale(distScale(gen));
+        shape->SetDirection({distDirection(gen), distDirection(gen)});
+
+        grid->Insert(*shape);
     }
+
+    SPDLOG_INFO("Stress mode: {} moving shapes spawned.", shapes.size());
+}
+
+void RemoveShape(const Shape* const shape_) noexcept
+{
+    const std::size_t index = shape_->GetIndex();
+    if (index >= shapes.size() || shapes[index].get() != shape_)
+    {
+        return;
+    }
+
+    // 순서는 의미가 없으므로 마지막 도형을 제거할 자리로 옮기고 위치를 갱신합니다. 검색 없이 O(1)입니다.
+    if (index != shapes.size() - 1)
+    {
+        shapes[index] = std::move(shapes.back());
+        shapes[index]->SetIndex(index);
+    }
+
+    shapes.pop_back();
 }
 
 void OnKeyInteracted(GLFWwindow* window_,
@@ -216,6 +316,11 @@ void OnKeyInteracted(GLFWwindow* window_,
             Reset();
             break;
         }
+        case GLFW_KEY_T:
+        {
+            Stress();
+            break;
+        }
         case GLFW_KEY_UP:
         {
             if (constexpr float MAX_TIME_SCALE = 30.0f; (timeScale += 1.0f) > MAX_TIME_SCALE)
@@ -280,47 +385,46 @@ void OnButtonInteracted(GLFWwindow* window_,
     {
         if (action_ == GLFW_PRESS)
         {
-            for (const std::unique_ptr<Shape>& shape : shapes)
+            const auto begin = std::chrono::steady_clock::now();
+
+            selectedShape = grid->QueryPoint(mousePosition);
+
+            const std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - begin;
+
+            if (selectedShape != nullptr)
             {
-                if (shape->IsInteracted(mousePosition))
-                {
-                    selectedShape = shape.get();
-                    SPDLOG_INFO("The shape is selected.");
-                    break;
-                }
+                SPDLOG_INFO("The shape is selected. ({:.2f} us among {} shapes)", elapsed.count(), shapes.size());
             }
         }
         else if (action_ == GLFW_RELEASE)
         {
             if (selectedShape != nullptr)
             {
-                for (const std::unique_ptr<Shape>& shape : shapes)
+                const auto begin = std::chrono::steady_clock::now();
+
+                grid->QueryBox(selectedShape->GetMin(), selectedShape->GetMax(), queryResults);
+
+                for (Shape* const shape : queryResults)
                 {
-                    if (shape.get() == selectedShape)
+                    if (shape == selectedShape)
                     {
                         continue;
                     }
 
-                    if (shape->IsInteracted(*(selectedShape)))
-                    {
-                        shape->NextTo(*(selectedShape));
+                    shape->NextTo(*(selectedShape));
 
-                        std::uniform_real_distribution<float> distDirection(1.0f, 1.0f);
+                    std::uniform_real_distribution<float> distDirection(1.0f, 1.0f);
 
-                        shape->SetDirection({distDirection(gen), distDirection(gen)});
-                        selectedShape->Destroy();
+                    shape->SetDirection({distDirection(gen), distDirection(gen)});
+                    RemoveShape(selectedShape);
 
-                        break;
-                    }
+                    break;
                 }
 
-                std::erase_if(shapes, [](const std::unique_ptr<Shape>& shape_)
-                {
-                    return shape_->ShouldDestroy();
-                });
+                const std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - begin;
 
                 selectedShape = nullptr;
-                SPDLOG_INFO("The shape is released.");
+                SPDLOG_INFO("The shape is released. ({:.2f} us among {} shapes)", elapsed.count(), shapes.size());
             }
         }
     }
@@ -34,6 +34,18 @@ void Render() noexcept;
  */
 void Reset() noexcept;
 
+/**
+ * @brief 공간 격자를 검증하기 위해 움직이는 도형들을 대량으로 생성합니다.
+ */
+void Stress() noexcept;
+
+/**
+ * @brief 지정한 도형을 월드에서 제거합니다.
+ *
+ * @param shape_ 제거할 도형.
+ */
+void RemoveShape(const class Shape* shape_) noexcept;
+
 /**
  * @brief 키와 상호작용할 때 호출됩니다.
  *
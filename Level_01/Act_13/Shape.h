@@ -1,23 +1,24 @@
 ﻿#ifndef GUARD_SHAPE_H
 #define GUARD_SHAPE_H
 
-#include <array>
+#include <cstddef>
 #include <unordered_map>
 
-#include <glad/glad.h>
-
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
-#include "Shader.h"
+#include "SpatialGrid.h"
 
 /**
  * @class Shape
  *
  * @brief 도형을 정의합니다.
+ *
+ * 도형은 GPU 자원을 소유하지 않는 순수 데이터이며, 렌더링은 ShapeRenderer가 일괄로 수행합니다.
  */
 class Shape final
 {
+    friend class SpatialGrid;
 public:
     enum class Type : unsigned char
     {
@@ -61,6 +62,28 @@ class Shape final
      */
     ~Shape() noexcept;
 
+    /**
+     * @brief 도형의 타입을 반환합니다.
+     *
+     * @return Shape::Type 도형의 타입.
+     */
+    [[nodiscard]]
+    constexpr Shape::Type GetType() const noexcept
+    {
+        return type;
+    }
+
+    /**
+     * @brief 도형의 색상을 반환합니다.
+     *
+     * @return glm::vec3 도형의 색상.
+     */
+    [[nodiscard]]
+    constexpr glm::vec3 GetColor() const noexcept
+    {
+        return color;
+    }
+
     /**
      * @brief 도형의 위치를 반환합니다.
      *
@@ -80,6 +103,11 @@ class Shape final
     inline void SetPosition(const glm::vec2 position_) noexcept
     {
         position = position_;
+
+        if (grid != nullptr)
+        {
+            grid->Update(*this);
+        }
     }
 
     /**
@@ -101,6 +129,33 @@ class Shape final
     inline void SetScale(const float scale_) noexcept
     {
         scale = scale_;
+
+        if (grid != nullptr)
+        {
+            grid->Update(*this);
+        }
+    }
+
+    /**
+     * @brief 도형 AABB의 최소 좌표를 반환합니다.
+     *
+     * @return glm::vec2 AABB의 최소 좌표.
+     */
+    [[nodiscard]]
+    constexpr glm::vec2 GetMin() const noexcept
+    {
+        return { position.x - scale * 0.5f, position.y - scale * 0.5f };
+    }
+
+    /**
+     * @brief 도형 AABB의 최대 좌표를 반환합니다.
+     *
+     * @return glm::vec2 AABB의 최대 좌표.
+     */
+    [[nodiscard]]
+    constexpr glm::vec2 GetMax() const noexcept
+    {
+        return { position.x + scale * 0.5f, position.y + scale * 0.5f };
     }
 
     /**
@@ -125,22 +180,24 @@ class Shape final
     }
 
     /**
-     * @brief 도형이 파괴되어야 하는지에 대한 여부를 반환합니다.
+     * @brief 도형 목록에서의 위치를 반환합니다.
      *
-     * @return bool 파괴 여부.
+     * @return std::size_t 도형 목록에서의 위치.
      */
     [[nodiscard]]
-    inline bool ShouldDestroy() const noexcept
+    constexpr std::size_t GetIndex() const noexcept
     {
-        return shouldDestroy;
+        return index;
     }
 
     /**
-     * @brief 도형을 파괴 상태로 설정합니다.
+     * @brief 도형 목록에서의 위치를 설정합니다. 목록에 넣거나 자리를 옮길 때마다 호출합니다.
+     *
+     * @param index_ 설정할 위치.
      */
-    inline void Destroy() noexcept
+    inline void SetIndex(const std::size_t index_) noexcept
     {
-        shouldDestroy = true;
+        index = index_;
     }
 
     /**
@@ -150,13 +207,6 @@ class Shape final
      */
     void Update(float deltaTime_) noexcept;
 
-    /**
-     * @brief 도형을 그립니다.
-     *
-     * @param shader_ 사용할 셰이더.
-     */
-    void Render(const Shader& shader_) const noexcept;
-
     /**
      * @brief 도형을 다음 위치로 이동시킵니다.
      *
@@ -197,42 +247,6 @@ class Shape final
                (min.y < otherMax.y) && (max.y > otherMin.y);
     }
 private:
-    /**
-     * @brief 도형의 모든 유형에 대한 정점 데이터.
-     */
-    static inline const std::unordered_map<Shape::Type, std::array<float, 10>> SHAPES_VERTICES
-    {
-            {Shape::Type::Dot,       {0.0f, 0.0f}},
-            {Shape::Type::Line,      {-0.5f, 0.0f,  0.5f,    0.0f}},
-            {Shape::Type::Triangle,  { 0.0f, 0.5f, -0.5f,   -0.5f,    0.5f,    -0.5f}},
-            {Shape::Type::Rectangle, {-0.5f, 0.5f,  0.5f,    0.5f,    0.5f,    -0.5f, -0.5f, -0.5f}},
-            {Shape::Type::Pentagon,  { 0.0f, 0.5f,  0.4755f, 0.1545f, 0.2939f, -0.4045f, -0.2939f, -0.4045f, -0.4755f, 0.1545f}},
-    };
-
-    /**
-     * @brief 도형의 모든 유형에 대한 요소 데이터.
-     */
-    static inline const std::unordered_map<Shape::Type, std::vector<unsigned int>> SHAPE_INDICES
-    {
-            {Shape::Type::Dot,       {0}},
-            {Shape::Type::Line,      {0, 1}},
-            {Shape::Type::Triangle,  {0, 1, 2}},
-            {Shape::Type::Rectangle, {0, 1, 2, 2, 3, 0}},
-            {Shape::Type::Pentagon,  {0, 1, 2, 0, 2, 3, 0, 3, 4}},
-    };
-
-    /**
-     * @brief 도형의 모든 유형에 대한 그리기 기본형 데이터.
-     */
-    static inline const std::unordered_map<Shape::Type, GLenum> SHAPE_PRIMITIVES
-    {
-         {Shape::Type::Dot,       GL_POINTS},
-         {Shape::Type::Line,      GL_LINES},
-         {Shape::Type::Triangle,  GL_TRIANGLES},
-         {Shape::Type::Rectangle, GL_TRIANGLES},
-         {Shape::Type::Pentagon,  GL_TRIANGLES},
-    };
-
     /**
      * @brief 도형의 모든 유형에 대한 색상 데이터.
      */
@@ -246,44 +260,44 @@ class Shape final
     };
 
     /**
-     * @brief 정점 배열 객체.
+     * @brief 해당 도형의 타입.
      */
-    GLuint vao = 0;
+    Shape::Type type;
 
     /**
-     * @brief 정점 버퍼 객체.
+     * @brief 해당 도형의 위치.
      */
-    GLuint vbo = 0;
+    glm::vec2 position;
 
     /**
-     * @brief 요소 버퍼 객체.
+     * @brief 해당 도형의 크기.
      */
-    GLuint ebo = 0;
+    float scale;
 
     /**
-     * @brief 해당 도형의 타입.
+     * @brief 해당 도형의 색상.
      */
-    Shape::Type type;
+    glm::vec3 color;
 
     /**
-     * @brief 해당 도형의 위치.
+     * @brief 해당 도형이 바라보는 각도.
      */
-    glm::vec2 position;
+    glm::vec2 direction;
 
     /**
-     * @brief 해당 도형의 크기.
+     * @brief 도형 목록에서의 위치. 제거할 때 검색 없이 바로 찾습니다.
      */
-    float scale;
+    std::size_t index = 0;
 
     /**
-     * @brief 해당 도형이 바라보는 각도.
+     * @brief 해당 도형이 등록된 공간 격자.
      */
-    glm::vec2 direction;
+    SpatialGrid* grid = nullptr;
 
     /**
-     * @brief 도형이 파괴되어야 하는지 여부.
+     * @brief 해당 도형이 걸쳐 있는 격자 셀의 범위.
      */
-    bool shouldDestroy = false;
+    SpatialGrid::CellRange cellRange;
 };
 
 #endif // !GUARD_SHAPE_H
@@ -0,0 +1,174 @@
+#include "ShapeRenderer.h"
+
+#include <cmath>
+#include <cstddef>
+
+#include <glm/trigonometric.hpp>
+
+ShapeRenderer::ShapeRenderer() noexcept
+    : vao{0}
+    , vertexBuffer{0}
+    , indexBuffer{0}
+    , instanceBuffer{0}
+    , indirectBuffer{0}
+    , instanceCapacity{0}
+    , meshes{}
+    , commands{}
+{
+    std::vector<unsigned int> indices;
+
+    for (std::size_t type = 0; type < TYPE_COUNT; ++type)
+    {
+        meshes[type].firstIndex = static_cast<GLuint>(indices.size());
+        meshes[type].indexCount = static_cast<GLuint>(SHAPE_INDICES[type].size());
+        meshes[type].baseVertex = static_cast<GLint>(type * VERTICES_PER_TYPE);
+
+        indices.insert(indices.end(), SHAPE_INDICES[type].begin(), SHAPE_INDICES[type].end());
+    }
+
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    glGenBuffers(1, &vertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    glBufferStorage(GL_ARRAY_BUFFER, sizeof(SHAPES_VERTICES), SHAPES_VERTICES.data(), 0);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+    glEnableVertexAttribArray(0);
+
+    glGenBuffers(1, &indexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferStorage(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(unsigned int)), indices.data(), 0);
+
+    glGenBuffers(1, &instanceBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, position)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, scale)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, angle)));
+    glEnableVertexAttribArray(3);
+    glVertexAttribDivisor(3, 1);
+
+    glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, color)));
+    glEnableVertexAttribArray(4);
+    glVertexAttribDivisor(4, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenBuffers(1, &indirectBuffer);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(commands), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+ShapeRenderer::~ShapeRenderer() noexcept
+{
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vertexBuffer);
+    glDeleteBuffers(1, &indexBuffer);
+    glDeleteBuffers(1, &instanceBuffer);
+    glDeleteBuffers(1, &indirectBuffer);
+}
+
+void ShapeRenderer::Render(const std::vector<std::unique_ptr<Shape>>& shapes_) noexcept
+{
+    if (shapes_.empty())
+    {
+        return;
+    }
+
+    // 유형 별 개수를 세어 각 유형이 인스턴스 버퍼에서 차지할 구간을 정합니다.
+    std::array<GLuint, TYPE_COUNT> counts{};
+    for (const std::unique_ptr<Shape>& shape : shapes_)
+    {
+        ++counts[static_cast<std::size_t>(shape->GetType())];
+    }
+
+    std::array<GLuint, TYPE_COUNT> cursors{};
+    for (std::size_t type = 0, baseInstance = 0; type < TYPE_COUNT; ++type)
+    {
+        commands[type].count         = meshes[type].indexCount;
+        commands[type].instanceCount = counts[type];
+        commands[type].firstIndex    = meshes[type].firstIndex;
+        commands[type].baseVertex    = meshes[type].baseVertex;
+        commands[type].baseInstance  = static_cast<GLuint>(baseInstance);
+
+        cursors[type]  = static_cast<GLuint>(baseInstance);
+        baseInstance  += counts[type];
+    }
+
+    staging.resize(shapes_.size());
+
+    for (const std::unique_ptr<Shape>& shape : shapes_)
+    {
+        const glm::vec2 direction = shape->GetDirection();
+
+        float angle = 0.0f;
+        if (direction.x != 0.0f || direction.y != 0.0f)
+        {
+            angle = std::atan2(direction.y, direction.x) + glm::radians(270.0f);
+        }
+
+        staging[cursors[static_cast<std::size_t>(shape->GetType())]++] =
+        {
+            shape->GetPosition(),
+            shape->GetScale(),
+            angle,
+            shape->GetColor()
+        };
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+
+    if (staging.size() > instanceCapacity)
+    {
+        instanceCapacity = staging.size();
+    }
+
+    // 이전 프레임이 아직 읽고 있을 수 있으므로 저장 공간을 고아로 만든 뒤 기록합니다.
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(instanceCapacity * sizeof(Instance)), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(staging.size() * sizeof(Instance)), staging.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, sizeof(commands), commands.data());
+
+    glBindVertexArray(vao);
+
+    const auto draw = [this](const GLenum mode_, const Shape::Type first_, const Shape::Type last_)
+    {
+        const std::size_t begin = static_cast<std::size_t>(first_);
+        const std::size_t end   = static_cast<std::size_t>(last_) + 1;
+
+        GLuint instances = 0;
+        for (std::size_t type = begin; type < end; ++type)
+        {
+            instances += commands[type].instanceCount;
+        }
+
+        if (instances == 0)
+        {
+            return;
+        }
+
+        glMultiDrawElementsIndirect(mode_,
+                                    GL_UNSIGNED_INT,
+                                    reinterpret_cast<const void*>(begin * sizeof(DrawCommand)),
+                                    static_cast<GLsizei>(end - begin),
+                                    sizeof(DrawCommand));
+    };
+
+    draw(GL_POINTS,    Shape::Type::Dot,      Shape::Type::Dot);
+    draw(GL_LINES,     Shape::Type::Line,     Shape::Type::Line);
+    draw(GL_TRIANGLES, Shape::Type::Triangle, Shape::Type::Pentagon);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
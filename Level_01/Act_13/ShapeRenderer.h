@@ -0,0 +1,166 @@
+#ifndef GUARD_SHAPE_RENDERER_H
+#define GUARD_SHAPE_RENDERER_H
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+#include "Shape.h"
+
+/**
+ * @class ShapeRenderer
+ *
+ * @brief 모든 도형을 공유 정적 지오메트리와 간접 드로우 명령으로 렌더링합니다.
+ *
+ * 다섯 가지 도형 유형의 정점/요소는 생성 시 하나의 불변 버퍼(glBufferStorage)에 한 번만 적재됩니다.
+ * 매 프레임 도형들을 유형 별로 묶어 인스턴스 버퍼에 기록하고, 유형마다 하나의 간접 명령을 만들어
+ * 기본형(점, 선, 삼각형) 별로 glMultiDrawElementsIndirect를 호출합니다.
+ */
+class ShapeRenderer final
+{
+public:
+    /**
+     * @brief 생성자.
+     */
+    explicit ShapeRenderer() noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~ShapeRenderer() noexcept;
+
+    ShapeRenderer(const ShapeRenderer&) = delete;
+    ShapeRenderer& operator=(const ShapeRenderer&) = delete;
+
+    /**
+     * @brief 도형들을 그립니다.
+     *
+     * @param shapes_ 그릴 도형들.
+     */
+    void Render(const std::vector<std::unique_ptr<Shape>>& shapes_) noexcept;
+private:
+    /**
+     * @struct Instance
+     *
+     * @brief 도형 하나를 그리기 위한 인스턴스 데이터를 정의합니다.
+     */
+    struct Instance
+    {
+        glm::vec2 position;
+        float     scale;
+        float     angle;
+        glm::vec3 color;
+    };
+
+    /**
+     * @struct DrawCommand
+     *
+     * @brief glMultiDrawElementsIndirect가 읽는 간접 명령의 형식을 정의합니다.
+     */
+    struct DrawCommand
+    {
+        GLuint count;
+        GLuint instanceCount;
+        GLuint firstIndex;
+        GLint  baseVertex;
+        GLuint baseInstance;
+    };
+
+    /**
+     * @struct Mesh
+     *
+     * @brief 공유 지오메트리 버퍼 내 한 도형 유형의 위치를 정의합니다.
+     */
+    struct Mesh
+    {
+        GLuint firstIndex;
+        GLuint indexCount;
+        GLint  baseVertex;
+    };
+
+    /**
+     * @brief 도형 유형의 개수.
+     */
+    static constexpr std::size_t TYPE_COUNT = static_cast<std::size_t>(Shape::Type::Pentagon) + 1;
+
+    /**
+     * @brief 도형 유형 당 정점의 개수. (모자란 정점은 사용되지 않습니다)
+     */
+    static constexpr std::size_t VERTICES_PER_TYPE = 5;
+
+    /**
+     * @brief 도형의 모든 유형에 대한 정점 데이터.
+     */
+    static constexpr std::array<std::array<float, VERTICES_PER_TYPE * 2>, TYPE_COUNT> SHAPES_VERTICES
+    {{
+            {0.0f, 0.0f},
+            {-0.5f, 0.0f,  0.5f,    0.0f},
+            { 0.0f, 0.5f, -0.5f,   -0.5f,    0.5f,    -0.5f},
+            {-0.5f, 0.5f,  0.5f,    0.5f,    0.5f,    -0.5f, -0.5f, -0.5f},
+            { 0.0f, 0.5f,  0.4755f, 0.1545f, 0.2939f, -0.4045f, -0.2939f, -0.4045f, -0.4755f, 0.1545f},
+    }};
+
+    /**
+     * @brief 도형의 모든 유형에 대한 요소 데이터.
+     */
+    static inline const std::array<std::vector<unsigned int>, TYPE_COUNT> SHAPE_INDICES
+    {{
+            {0},
+            {0, 1},
+            {0, 1, 2},
+            {0, 1, 2, 2, 3, 0},
+            {0, 1, 2, 0, 2, 3, 0, 3, 4},
+    }};
+
+    /**
+     * @brief 정점 배열 객체.
+     */
+    GLuint vao;
+
+    /**
+     * @brief 모든 도형 유형의 정점을 담는 불변 버퍼.
+     */
+    GLuint vertexBuffer;
+
+    /**
+     * @brief 모든 도형 유형의 요소를 담는 불변 버퍼.
+     */
+    GLuint indexBuffer;
+
+    /**
+     * @brief 매 프레임 다시 기록되는 인스턴스 버퍼.
+     */
+    GLuint instanceBuffer;
+
+    /**
+     * @brief 매 프레임 다시 기록되는 간접 명령 버퍼.
+     */
+    GLuint indirectBuffer;
+
+    /**
+     * @brief 인스턴스 버퍼에 담을 수 있는 인스턴스의 개수.
+     */
+    std::size_t instanceCapacity;
+
+    /**
+     * @brief 도형 유형 별 공유 지오메트리 위치.
+     */
+    std::array<Mesh, TYPE_COUNT> meshes;
+
+    /**
+     * @brief 도형 유형 별 간접 명령.
+     */
+    std::array<DrawCommand, TYPE_COUNT> commands;
+
+    /**
+     * @brief 업로드 전 인스턴스 데이터를 유형 순으로 모으는 스테이징 버퍼.
+     */
+    std::vector<Instance> staging;
+};
+
+#endif // !GUARD_SHAPE_RENDERER_H
@@ -0,0 +1,166 @@
+#include "SpatialGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Shape.h"
+
+SpatialGrid::SpatialGrid(const glm::vec2 min_,
+                         const glm::vec2 max_,
+                         const float     cellSize_) noexcept
+    : origin(min_)
+    , cellSize(cellSize_)
+    , inverseCellSize(1.0f / cellSize_)
+    , columns(std::max(1, static_cast<int>(std::ceil((max_.x - min_.x) / cellSize_))))
+    , rows(std::max(1, static_cast<int>(std::ceil((max_.y - min_.y) / cellSize_))))
+    , cells(static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows))
+{
+
+}
+
+SpatialGrid::~SpatialGrid() noexcept
+{
+    for (const std::vector<Shape*>& cell : cells)
+    {
+        for (Shape* const shape : cell)
+        {
+            shape->grid = nullptr;
+        }
+    }
+}
+
+void SpatialGrid::Insert(Shape& shape_) noexcept
+{
+    if (shape_.grid != nullptr)
+    {
+        shape_.grid->Remove(shape_);
+    }
+
+    shape_.grid      = this;
+    shape_.cellRange = ComputeRange(shape_.GetMin(), shape_.GetMax());
+
+    Link(&shape_, shape_.cellRange);
+}
+
+void SpatialGrid::Remove(Shape& shape_) noexcept
+{
+    if (shape_.grid != this)
+    {
+        return;
+    }
+
+    Unlink(&shape_, shape_.cellRange);
+
+    shape_.grid      = nullptr;
+    shape_.cellRange = {};
+}
+
+void SpatialGrid::Update(Shape& shape_) noexcept
+{
+    const CellRange range = ComputeRange(shape_.GetMin(), shape_.GetMax());
+    if (range == shape_.cellRange)
+    {
+        return;
+    }
+
+    Unlink(&shape_, shape_.cellRange);
+    Link(&shape_, range);
+
+    shape_.cellRange = range;
+}
+
+Shape* SpatialGrid::QueryPoint(const glm::vec2 point_) const noexcept
+{
+    const CellRange range = ComputeRange(point_, point_);
+
+    for (Shape* const shape : cells[static_cast<std::size_t>(range.minY) * columns + range.minX])
+    {
+        if (shape->IsInteracted(point_))
+        {
+            return shape;
+        }
+    }
+
+    return nullptr;
+}
+
+void SpatialGrid::QueryBox(const glm::vec2      min_,
+                           const glm::vec2      max_,
+                           std::vector<Shape*>& result_) const noexcept
+{
+    result_.clear();
+
+    const CellRange range = ComputeRange(min_, max_);
+
+    for (int y = range.minY; y <= range.maxY; ++y)
+    {
+        for (int x = range.minX; x <= range.maxX; ++x)
+        {
+            for (Shape* const shape : cells[static_cast<std::size_t>(y) * columns + x])
+            {
+                // 여러 셀에 걸친 도형은 질의 범위와 겹치는 첫 셀에서만 보고합니다.
+                if (x != std::max(shape->cellRange.minX, range.minX) ||
+                    y != std::max(shape->cellRange.minY, range.minY))
+                {
+                    continue;
+                }
+
+                const glm::vec2 shapeMin = shape->GetMin();
+                const glm::vec2 shapeMax = shape->GetMax();
+
+                if ((shapeMin.x < max_.x) && (shapeMax.x > min_.x) &&
+                    (shapeMin.y < max_.y) && (shapeMax.y > min_.y))
+                {
+                    result_.push_back(shape);
+                }
+            }
+        }
+    }
+}
+
+SpatialGrid::CellRange SpatialGrid::ComputeRange(const glm::vec2 min_,
+                                                 const glm::vec2 max_) const noexcept
+{
+    // 격자 밖의 좌표는 가장자리 셀로 모읍니다.
+    const auto toCell = [this](const float value_, const float origin_, const int count_) -> int
+    {
+        const int cell = static_cast<int>(std::floor((value_ - origin_) * inverseCellSize));
+        return std::clamp(cell, 0, count_ - 1);
+    };
+
+    CellRange range;
+    range.minX = toCell(min_.x, origin.x, columns);
+    range.minY = toCell(min_.y, origin.y, rows);
+    range.maxX = toCell(max_.x, origin.x, columns);
+    range.maxY = toCell(max_.y, origin.y, rows);
+
+    return range;
+}
+
+void SpatialGrid::Link(Shape* const shape_, const CellRange& range_) noexcept
+{
+    for (int y = range_.minY; y <= range_.maxY; ++y)
+    {
+        for (int x = range_.minX; x <= range_.maxX; ++x)
+        {
+            cells[static_cast<std::size_t>(y) * columns + x].push_back(shape_);
+        }
+    }
+}
+
+void SpatialGrid::Unlink(Shape* const shape_, const CellRange& range_) noexcept
+{
+    for (int y = range_.minY; y <= range_.maxY; ++y)
+    {
+        for (int x = range_.minX; x <= range_.maxX; ++x)
+        {
+            std::vector<Shape*>& cell = cells[static_cast<std::size_t>(y) * columns + x];
+
+            if (const auto iter = std::ranges::find(cell, shape_); iter != cell.end())
+            {
+                *iter = cell.back();
+                cell.pop_back();
+            }
+        }
+    }
+}
@@ -0,0 +1,160 @@
+#ifndef GUARD_SPATIAL_GRID_H
+#define GUARD_SPATIAL_GRID_H
+
+#include <vector>
+
+#include <glm/vec2.hpp>
+
+class Shape;
+
+/**
+ * @class SpatialGrid
+ *
+ * @brief 도형들의 AABB를 균일한 격자 셀에 등록하여 점/영역 질의를 가속합니다.
+ *
+ * 도형은 자신이 걸쳐 있는 셀 범위를 기억하며, 위치나 크기가 바뀌어 범위가 달라질 때만 셀 목록을 갱신합니다.
+ */
+class SpatialGrid final
+{
+public:
+    /**
+     * @struct CellRange
+     *
+     * @brief 도형이 걸쳐 있는 셀의 범위를 정의합니다. (양 끝 포함)
+     */
+    struct CellRange
+    {
+        int minX = 0;
+        int minY = 0;
+        int maxX = -1;
+        int maxY = -1;
+
+        bool operator==(const CellRange&) const = default;
+    };
+
+    /**
+     * @brief 생성자.
+     *
+     * @param min_      격자가 덮는 영역의 최소 좌표.
+     * @param max_      격자가 덮는 영역의 최대 좌표.
+     * @param cellSize_ 셀 한 변의 길이.
+     */
+    explicit SpatialGrid(const glm::vec2 min_,
+                         const glm::vec2 max_,
+                         const float     cellSize_) noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~SpatialGrid() noexcept;
+
+    SpatialGrid(const SpatialGrid&) = delete;
+    SpatialGrid& operator=(const SpatialGrid&) = delete;
+
+    /**
+     * @brief 도형을 격자에 등록합니다.
+     *
+     * @param shape_ 등록할 도형.
+     */
+    void Insert(Shape& shape_) noexcept;
+
+    /**
+     * @brief 도형을 격자에서 제거합니다.
+     *
+     * @param shape_ 제거할 도형.
+     */
+    void Remove(Shape& shape_) noexcept;
+
+    /**
+     * @brief 도형의 현재 AABB에 맞추어 등록된 셀을 갱신합니다.
+     *
+     * @param shape_ 갱신할 도형.
+     */
+    void Update(Shape& shape_) noexcept;
+
+    /**
+     * @brief 지정한 점과 접촉하는 도형을 반환합니다.
+     *
+     * @param point_ 지정할 점.
+     *
+     * @return Shape* 접촉하는 도형. 없다면 nullptr.
+     */
+    [[nodiscard]]
+    Shape* QueryPoint(const glm::vec2 point_) const noexcept;
+
+    /**
+     * @brief 지정한 영역과 겹치는 도형들을 수집합니다.
+     *
+     * @param min_    영역의 최소 좌표.
+     * @param max_    영역의 최대 좌표.
+     * @param result_ 겹치는 도형들을 담을 목록. (기존 내용은 지워집니다)
+     */
+    void QueryBox(const glm::vec2      min_,
+                  const glm::vec2      max_,
+                  std::vector<Shape*>& result_) const noexcept;
+
+    /**
+     * @brief 셀 한 변의 길이를 반환합니다.
+     *
+     * @return float 셀 한 변의 길이.
+     */
+    [[nodiscard]]
+    constexpr float GetCellSize() const noexcept
+    {
+        return cellSize;
+    }
+private:
+    /**
+     * @brief 지정한 영역이 걸쳐 있는 셀의 범위를 계산합니다.
+     *
+     * @param min_ 영역의 최소 좌표.
+     * @param max_ 영역의 최대 좌표.
+     *
+     * @return CellRange 셀의 범위.
+     */
+    [[nodiscard]]
+    CellRange ComputeRange(const glm::vec2 min_,
+                           const glm::vec2 max_) const noexcept;
+
+    /**
+     * @brief 지정한 범위의 셀들에 도형을 추가합니다.
+     */
+    void Link(Shape* const shape_, const CellRange& range_) noexcept;
+
+    /**
+     * @brief 지정한 범위의 셀들에서 도형을 제거합니다.
+     */
+    void Unlink(Shape* const shape_, const CellRange& range_) noexcept;
+
+    /**
+     * @brief 격자가 덮는 영역의 최소 좌표.
+     */
+    glm::vec2 origin;
+
+    /**
+     * @brief 셀 한 변의 길이.
+     */
+    float cellSize;
+
+    /**
+     * @brief 셀 한 변의 길이의 역수.
+     */
+    float inverseCellSize;
+
+    /**
+     * @brief 가로 셀 개수.
+     */
+    int columns;
+
+    /**
+     * @brief 세로 셀 개수.
+     */
+    int rows;
+
+    /**
+     * @brief 셀 별로 등록된 도형들. (행 우선)
+     */
+    std::vector<std::vector<Shape*>> cells;
+};
+
+#endif // !GUARD_SPATIAL_GRID_H
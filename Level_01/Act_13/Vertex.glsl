@@ -1,11 +1,23 @@
 #version 450 core
 
-layout (location = 0) in vec2 aPos;
+layout (location = 0) in vec2  aPos;
+layout (location = 1) in vec2  aOffset;
+layout (location = 2) in float aScale;
+layout (location = 3) in float aAngle;
+layout (location = 4) in vec3  aColor;
 
-uniform mat4 u_Model;
 uniform mat4 u_Projection;
 
+out vec3 vColor;
+
 void main()
 {
-    gl_Position = u_Projection * u_Model * vec4(aPos, 0.0, 1.0);
+    const float c = cos(aAngle);
+    const float s = sin(aAngle);
+
+    const vec2 local = aPos * aScale;
+    const vec2 world = vec2(local.x * c - local.y * s, local.x * s + local.y * c) + aOffset;
+
+    gl_Position = u_Projection * vec4(world, 0.0, 1.0);
+    vColor      = aColor;
 }
\ No newline at end of file
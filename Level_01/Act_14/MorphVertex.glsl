@@ -0,0 +1,27 @@
+#version 450 core
+
+layout (location = 0) in vec2  aUnfolded;
+layout (location = 1) in vec2  aFolded;
+layout (location = 2) in vec2  aPosition;
+layout (location = 3) in vec2  aScale;
+layout (location = 4) in float aAngle;
+layout (location = 5) in float aWeight;
+
+uniform mat4  u_Projection;
+uniform float u_Orbit;
+
+vec2 Rotate(vec2 v, float angle)
+{
+    const float c = cos(angle);
+    const float s = sin(angle);
+
+    return vec2(v.x * c - v.y * s, v.x * s + v.y * c);
+}
+
+void main()
+{
+    const vec2 local = mix(aUnfolded, aFolded, aWeight) * aScale;
+    const vec2 world = Rotate(local, aAngle + u_Orbit) + Rotate(aPosition, u_Orbit);
+
+    gl_Position = u_Projection * vec4(world, 0.0, 1.0);
+}
\ No newline at end of file
@@ -1,7 +1,13 @@
-﻿#include <array>
+﻿#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <ios>
+#include <random>
+#include <vector>
 
 #include <glad/glad.h>
 
@@ -63,22 +69,138 @@ class Shader final
     GLuint programID = 0;
 };
 
-class Triangle final
+/**
+ * @class DynamicBuffer
+ *
+ * @brief 매 프레임 CPU에서 다시 기록되는 데이터를 위한 영구 매핑 링 버퍼를 정의합니다.
+ *
+ * 버퍼는 glBufferStorage로 한 번만 할당되어 FRAME_COUNT 개의 구간으로 나뉘며, 전체가 영구적으로 매핑됩니다.
+ * 매 프레임 GPU가 더 이상 읽지 않는 구간에 직접 기록하고, 그리기 명령 뒤에 펜스를 남겨 다음 재사용 시점을 동기화합니다.
+ * 따라서 프레임 중 드라이버의 저장 공간 재할당이나 암묵적인 동기화가 발생하지 않습니다.
+ */
+class DynamicBuffer final
 {
 public:
     /**
      * @brief 생성자.
      *
-     * @param position_ 삼각형 위치.
-     * @param rotation_ 삼각형 회전.
+     * @param target_      버퍼를 바인딩할 대상.
+     * @param segmentSize_ 한 프레임에 기록할 수 있는 최대 바이트 수.
      */
-    explicit Triangle(const glm::vec2& position_,
-                      const glm::vec3& rotation_) noexcept;
+    explicit DynamicBuffer(GLenum     target_,
+                           GLsizeiptr segmentSize_) noexcept;
 
     /**
      * @brief 소멸자.
      */
-    ~Triangle() noexcept;
+    ~DynamicBuffer() noexcept;
+
+    DynamicBuffer(const DynamicBuffer&) = delete;
+    DynamicBuffer& operator=(const DynamicBuffer&) = delete;
+
+    /**
+     * @brief 현재 구간을 GPU가 다 읽을 때까지 기다린 뒤 기록할 주소를 반환합니다.
+     *
+     * @return void* 현재 구간의 시작 주소.
+     */
+    [[nodiscard]]
+    void* Begin() noexcept;
+
+    /**
+     * @brief 현재 구간을 읽는 그리기 명령들 뒤에 펜스를 남기고 다음 구간으로 넘어갑니다.
+     */
+    void End() noexcept;
+
+    /**
+     * @brief 버퍼 ID를 반환합니다.
+     *
+     * @return GLuint 버퍼 ID.
+     */
+    [[nodiscard]]
+    constexpr GLuint GetBufferID() const noexcept
+    {
+        return buffer;
+    }
+
+    /**
+     * @brief 버퍼 시작으로부터 현재 구간까지의 바이트 오프셋을 반환합니다.
+     *
+     * @return GLsizeiptr 현재 구간의 바이트 오프셋.
+     */
+    [[nodiscard]]
+    constexpr GLsizeiptr GetOffset() const noexcept
+    {
+        return segmentSize * static_cast<GLsizeiptr>(index);
+    }
+
+    /**
+     * @brief 한 구간의 바이트 크기를 반환합니다.
+     *
+     * @return GLsizeiptr 한 구간의 바이트 크기.
+     */
+    [[nodiscard]]
+    constexpr GLsizeiptr GetSegmentSize() const noexcept
+    {
+        return segmentSize;
+    }
+private:
+    /**
+     * @brief 동시에 사용 중일 수 있는 프레임(구간)의 개수.
+     */
+    static constexpr std::size_t FRAME_COUNT = 3;
+
+    /**
+     * @brief 버퍼를 바인딩할 대상.
+     */
+    GLenum target;
+
+    /**
+     * @brief 버퍼 ID.
+     */
+    GLuint buffer = 0;
+
+    /**
+     * @brief 한 구간의 바이트 크기.
+     */
+    GLsizeiptr segmentSize;
+
+    /**
+     * @brief 영구 매핑된 버퍼의 시작 주소.
+     */
+    std::byte* mapped = nullptr;
+
+    /**
+     * @brief 현재 기록 중인 구간.
+     */
+    std::size_t index = 0;
+
+    /**
+     * @brief 구간 별로 GPU 사용 완료를 알리는 펜스.
+     */
+    std::array<GLsync, FRAME_COUNT> fences{};
+};
+
+/**
+ * @class Triangle
+ *
+ * @brief 접힘 애니메이션을 수행하는 삼각형을 정의합니다.
+ *
+ * 삼각형의 정점은 항상 펼친 모양과 접힌 모양 두 키프레임의 선형 보간이므로, 삼각형은 보간 가중치 하나만 보관합니다.
+ * 삼각형은 GPU 자원을 소유하지 않으며, 렌더링은 TriangleRenderer가 일괄로 수행합니다.
+ */
+class Triangle final
+{
+public:
+    /**
+     * @brief 생성자.
+     *
+     * @param position_ 삼각형 위치.
+     * @param rotation_ 삼각형 회전.
+     * @param scale_    삼각형 크기.
+     */
+    explicit Triangle(const glm::vec2& position_,
+                      const glm::vec3& rotation_,
+                      const glm::vec2& scale_ = {100.0f, 50.0f}) noexcept;
 
     /**
      * @brief 해당 삼각형을 업데이트합니다.
@@ -88,46 +210,87 @@ class Triangle final
     void Update(float deltaTime_) noexcept;
 
     /**
-     * @brief 해당 삼각형을 렌더링합니다.
+     * @brief 보간된 세 정점을 월드 좌표로 변환해 기록합니다.
      *
-     * @param shader_ 사용할 셰이더.
+     * @param destination_ 정점 6개(x, y 순)를 기록할 주소.
+     * @param orbit_       원점을 중심으로 한 공전 각도.
      */
-    void Render(const Shader& shader_) const noexcept;
+    void WriteVertices(float* destination_, float orbit_) const noexcept;
 
     /**
-     * @brief 애니메이션 진행률.
+     * @brief 공전 전 위치를 반환합니다.
+     *
+     * @return glm::vec2 공전 전 위치.
      */
-    float progress = 0.0f;
-private:
+    [[nodiscard]]
+    constexpr glm::vec2 GetPosition() const noexcept
+    {
+        return position;
+    }
+
     /**
-     * @brief 정점 배열을 업데이트합니다.
+     * @brief 크기를 반환합니다.
      *
-     * @param deltaTime_ 시간 변화량.
+     * @return glm::vec2 크기.
      */
-    void UpdateVertices(float deltaTime_) noexcept;
+    [[nodiscard]]
+    constexpr glm::vec2 GetScale() const noexcept
+    {
+        return scale;
+    }
 
     /**
-     * @brief 위치를 업데이트합니다.
+     * @brief 공전 전 바라보는 각도를 반환합니다.
      *
-     * @param deltaTime_ 시간 변화량.
+     * @return float 공전 전 바라보는 각도.
      */
-    void UpdatePosition(float deltaTime_) noexcept;
+    [[nodiscard]]
+    constexpr float GetAngle() const noexcept
+    {
+        return angle;
+    }
+
+    /**
+     * @brief 접힌 모양으로의 보간 가중치를 반환합니다.
+     *
+     * @return float 보간 가중치. (0: 펼침, 1: 접힘)
+     */
+    [[nodiscard]]
+    constexpr float GetWeight() const noexcept
+    {
+        return weight;
+    }
 
     /**
-     * @brief 정점 배열 객체.
+     * @brief 삼각형 하나가 차지하는 실수의 개수.
      */
-    GLuint vao = 0;
+    static constexpr std::size_t FLOAT_COUNT = 6;
 
     /**
-     * @brief 정점 버퍼 객체.
+     * @brief 펼친 모양의 정점 데이터.
      */
-    GLuint vbo = 0;
+    static constexpr std::array<float, FLOAT_COUNT> UNFOLDED_VERTICES
+    {
+        0.0f,  1.0f,
+       -1.0f, -1.0f,
+        1.0f, -1.0f
+    };
 
     /**
-     * @brief 요소 배열 객체.
+     * @brief 접힌 모양의 정점 데이터.
      */
-    GLuint ebo = 0;
+    static constexpr std::array<float, FLOAT_COUNT> FOLDED_VERTICES
+    {
+        0.0f, -2.5f,
+       -1.0f, -1.0f,
+        1.0f, -1.0f
+    };
 
+    /**
+     * @brief 애니메이션 진행률.
+     */
+    float progress = 0.0f;
+private:
     /**
      * @brief 위치.
      */
@@ -136,22 +299,144 @@ class Triangle final
     /**
      * @brief 크기.
      */
-    glm::vec2 scale = {100.0f, 50.0f};
+    glm::vec2 scale;
 
     /**
-     * @brief 회전.
+     * @brief 바라보는 각도.
+     */
+    float angle;
+
+    /**
+     * @brief 접힌 모양으로의 보간 가중치.
+     */
+    float weight = 0.0f;
+};
+
+/**
+ * @class TriangleRenderer
+ *
+ * @brief 모든 삼각형을 두 가지 경로로 렌더링합니다.
+ *
+ * CPU 경로는 매 프레임 보간된 월드 좌표 정점(삼각형 당 24바이트)을 동적 버퍼에 기록해 그립니다.
+ * GPU 경로는 두 키프레임을 정적 버퍼에, 위치/크기/각도를 생성 시 한 번만 인스턴스 버퍼에 올려두고,
+ * 매 프레임 인스턴스 별 보간 가중치(삼각형 당 4바이트)만 기록하여 정점 셰이더에서 보간합니다.
+ */
+class TriangleRenderer final
+{
+public:
+    /**
+     * @brief 생성자.
+     *
+     * @param capacity_ 그릴 수 있는 최대 삼각형 갯수.
      */
-    glm::vec3 rotation;
+    explicit TriangleRenderer(std::size_t capacity_) noexcept;
 
     /**
-     * @brief 색상.
+     * @brief 소멸자.
      */
-    glm::vec3 color = {1.0f, 1.0f, 0.0f};
+    ~TriangleRenderer() noexcept;
+
+    TriangleRenderer(const TriangleRenderer&) = delete;
+    TriangleRenderer& operator=(const TriangleRenderer&) = delete;
 
     /**
-     * @brief 정점 데이터.
+     * @brief CPU에서 보간한 정점을 업로드해 그립니다.
+     *
+     * @param shader_    사용할 셰이더.
+     * @param triangles_ 그릴 삼각형들.
+     * @param orbit_     공전 각도.
      */
-    std::array<float, 6> vertices{};
+    void RenderCpu(const Shader&                shader_,
+                   const std::vector<Triangle>& triangles_,
+                   float                        orbit_) noexcept;
+
+    /**
+     * @brief 정점 셰이더에서 키프레임을 보간해 그립니다.
+     *
+     * @param shader_    사용할 셰이더.
+     * @param triangles_ 그릴 삼각형들.
+     * @param orbit_     공전 각도.
+     */
+    void RenderGpu(const Shader&                shader_,
+                   const std::vector<Triangle>& triangles_,
+                   float                        orbit_) noexcept;
+private:
+    /**
+     * @struct Instance
+     *
+     * @brief 생성 후 변하지 않는 인스턴스 데이터를 정의합니다.
+     */
+    struct Instance
+    {
+        glm::vec2 position;
+        glm::vec2 scale;
+        float     angle;
+    };
+
+    /**
+     * @brief 아직 업로드되지 않은 삼각형들의 인스턴스 데이터를 업로드합니다.
+     *
+     * @param triangles_ 모든 삼각형들.
+     */
+    void UploadInstances(const std::vector<Triangle>& triangles_) noexcept;
+
+    /**
+     * @brief 그릴 수 있는 최대 삼각형 갯수.
+     */
+    std::size_t capacity;
+
+    /**
+     * @brief 인스턴스 버퍼에 업로드된 삼각형 갯수.
+     */
+    std::size_t uploadedCount = 0;
+
+    /**
+     * @brief CPU 경로의 정점 배열 객체.
+     */
+    GLuint cpuVao = 0;
+
+    /**
+     * @brief GPU 경로의 정점 배열 객체.
+     */
+    GLuint gpuVao = 0;
+
+    /**
+     * @brief 두 키프레임의 정점을 교차 배치한 불변 버퍼.
+     */
+    GLuint keyframeBuffer = 0;
+
+    /**
+     * @brief 생성 시에만 기록되는 인스턴스 버퍼.
+     */
+    GLuint instanceBuffer = 0;
+
+    /**
+     * @brief CPU 경로에서 월드 좌표 정점을 기록하는 동적 버퍼.
+     */
+    DynamicBuffer vertexStream;
+
+    /**
+     * @brief GPU 경로에서 보간 가중치를 기록하는 동적 버퍼.
+     */
+    DynamicBuffer weightStream;
+};
+
+/**
+ * @enum MorphMode
+ *
+ * @brief 접힘 애니메이션의 보간 위치를 정의합니다.
+ */
+enum class MorphMode
+{
+    /**
+     * @brief CPU에서 보간 후 업로드.
+     */
+    Cpu,
+
+    /**
+     * @brief 정점 셰이더에서 보간.
+     */
+    Gpu,
 };
 
 /**
@@ -292,7 +577,27 @@ static float timeScale = 1.0f;
 /**
  * @brief 월드 내 최대 삼각형 갯수.
  */
-static constexpr std::size_t MAX_TRIANGLE_COUNT = 4;
+static constexpr std::size_t MAX_TRIANGLE_COUNT = 131'072;
+
+/**
+ * @brief 한 번에 추가로 생성할 삼각형 갯수.
+ */
+static constexpr std::size_t SPAWN_TRIANGLE_COUNT = 10'000;
+
+/**
+ * @brief 벤치마크에 사용할 삼각형 갯수.
+ */
+static constexpr std::size_t BENCHMARK_TRIANGLE_COUNT = 100'000;
+
+/**
+ * @brief 벤치마크에서 경로 별로 측정할 프레임 수.
+ */
+static constexpr std::size_t BENCHMARK_FRAME_COUNT = 240;
+
+/**
+ * @brief 삼각형 색상.
+ */
+static constexpr glm::vec3 TRIANGLE_COLOR = {1.0f, 1.0f, 0.0f};
 
 /**
  * @brief 월드 내 모든 삼각형.
@@ -309,6 +614,51 @@ static Rotation rotateMode = Rotation::None;
  */
 static bool foldMode = false;
 
+/**
+ * @brief 원점을 중심으로 한 공전 각도.
+ */
+static float orbitAngle = 0.0f;
+
+/**
+ * @brief 접힘 애니메이션의 보간 위치.
+ */
+static MorphMode morphMode = MorphMode::Gpu;
+
+/**
+ * @brief 다음 프레임에 벤치마크를 수행할지 여부.
+ */
+static bool shouldBenchmark = false;
+
+/**
+ * @brief 난수 생성 엔진.
+ */
+static std::mt19937 gen(std::random_device{}());
+
+/**
+ * @brief 임의의 위치에 삼각형들을 추가합니다.
+ *
+ * @param count_ 추가할 삼각형 갯수.
+ */
+static void SpawnTriangles(std::size_t count_) noexcept;
+
+/**
+ * @brief 삼각형들의 위치를 업데이트합니다.
+ *
+ * @param deltaTime_ 시간 변화량.
+ */
+static void UpdateTriangles(float deltaTime_) noexcept;
+
+/**
+ * @brief 두 보간 경로의 프레임 당 소요 시간을 측정합니다.
+ *
+ * @param renderer_    사용할 렌더러.
+ * @param cpuShader_   CPU 경로 셰이더.
+ * @param morphShader_ GPU 경로 셰이더.
+ */
+static void RunBenchmark(TriangleRenderer& renderer_,
+                         const Shader&     cpuShader_,
+                         const Shader&     morphShader_) noexcept;
+
 int main()
 {
     if (!glfwInit())
@@ -358,11 +708,36 @@ int main()
     const std::string vertexShaderFile   = ReadFile("Vertex.glsl");
     const char* const vertexShaderSource = vertexShaderFile.c_str();
 
+    const std::string morphVertexShaderFile   = ReadFile("MorphVertex.glsl");
+    const char* const morphVertexShaderSource = morphVertexShaderFile.c_str();
+
     const std::string fragmentShaderFile   = ReadFile("Fragment.glsl");
     const char* const fragmentShaderSource = fragmentShaderFile.c_str();
 
     const Shader shader(vertexShaderSource, fragmentShaderSource);
-    shader.Use();
+    const Shader morphShader(morphVertexShaderSource, fragmentShaderSource);
+
+    const glm::mat4 projection = glm::ortho(
+       -static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 왼쪽
+        static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 오른쪽
+       -static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 아래
+        static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 위
+       -1.0f,                                     // near
+        1.0f                                      // far
+        );
+
+    for (const Shader* const program : {&shader, &morphShader})
+    {
+        program->Use();
+
+        const GLint projLoc = glGetUniformLocation(program->GetProgramID(), "u_Projection");
+        glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection));
+
+        const GLint colorLoc = glGetUniformLocation(program->GetProgramID(), "u_Color");
+        glUniform3fv(colorLoc, 1, &TRIANGLE_COLOR[0]);
+    }
+
+    TriangleRenderer renderer(MAX_TRIANGLE_COUNT);
 
     triangles.reserve(MAX_TRIANGLE_COUNT);
 
@@ -382,10 +757,7 @@ int main()
             const float currentTime = static_cast<float>(glfwGetTime());
             const float deltaTime   = (currentTime - lastTime) * timeScale;
 
-            for (Triangle& triangle : triangles)
-            {
-                triangle.Update(deltaTime);
-            }
+            UpdateTriangles(deltaTime);
 
             lastTime = currentTime;
         }
@@ -394,15 +766,29 @@ int main()
             glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
             glClear(GL_COLOR_BUFFER_BIT);
 
-            for (const Triangle& triangle : triangles)
+            if (morphMode == MorphMode::Cpu)
             {
-                triangle.Render(shader);
+                renderer.RenderCpu(shader, triangles, orbitAngle);
+            }
+            else
+            {
+                renderer.RenderGpu(morphShader, triangles, orbitAngle);
             }
 
             glfwSwapBuffers(window);
         }
+
+        if (shouldBenchmark)
+        {
+            shouldBenchmark = false;
+
+            RunBenchmark(renderer, shader, morphShader);
+            lastTime = static_cast<float>(glfwGetTime());
+        }
     }
 
+    triangles.clear();
+
     return 0;
 }
 
@@ -465,145 +851,288 @@ Shader::~Shader() noexcept
     }
 }
 
-Triangle::Triangle(const glm::vec2& position_,
-                   const glm::vec3& rotation_) noexcept
-    : position{position_}
-    , rotation{rotation_}
-    , vertices{0.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f}
+DynamicBuffer::DynamicBuffer(const GLenum     target_,
+                             const GLsizeiptr segmentSize_) noexcept
+    : target{target_}
+    , segmentSize{segmentSize_}
 {
-    constexpr std::array<GLuint, 3> indices
-    {
-        0, 1, 2
-    };
+    constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    const GLsizeiptr     size  = segmentSize * static_cast<GLsizeiptr>(FRAME_COUNT);
 
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
+    glGenBuffers(1, &buffer);
+    glBindBuffer(target, buffer);
+    glBufferStorage(target, size, nullptr, flags);
 
-    glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(GLfloat)), vertices.data(), GL_STATIC_DRAW);
-
-    glGenBuffers(1, &ebo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(GLuint)), indices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
-    glEnableVertexAttribArray(0);
+    mapped = static_cast<std::byte*>(glMapBufferRange(target, 0, size, flags));
+    if (mapped == nullptr)
+    {
+        SPDLOG_CRITICAL("Failed to map dynamic buffer persistently");
+    }
 
-    glBindVertexArray(0);
+    glBindBuffer(target, 0);
 }
 
-Triangle::~Triangle() noexcept
+DynamicBuffer::~DynamicBuffer() noexcept
 {
-    if (vao != 0)
+    for (GLsync& fence : fences)
     {
-        glDeleteVertexArrays(1, &vao);
+        if (fence != nullptr)
+        {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
     }
-    if (vbo != 0)
+
+    if (buffer != 0)
     {
-        glDeleteBuffers(1, &vbo);
+        glBindBuffer(target, buffer);
+        glUnmapBuffer(target);
+        glBindBuffer(target, 0);
+
+        glDeleteBuffers(1, &buffer);
     }
-    if (ebo != 0)
+}
+
+void* DynamicBuffer::Begin() noexcept
+{
+    if (GLsync& fence = fences[index]; fence != nullptr)
     {
-        glDeleteBuffers(1, &ebo);
+        constexpr GLuint64 timeout = 1'000'000; // 1ms
+
+        // 대부분은 이미 신호된 상태이며, GPU가 세 프레임 이상 뒤처졌을 때만 기다리게 됩니다.
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        while (result == GL_TIMEOUT_EXPIRED)
+        {
+            result = glClientWaitSync(fence, 0, timeout);
+        }
+
+        if (result == GL_WAIT_FAILED)
+        {
+            SPDLOG_ERROR("Failed to wait for dynamic buffer fence");
+        }
+
+        glDeleteSync(fence);
+        fence = nullptr;
     }
+
+    return mapped + GetOffset();
+}
+
+void DynamicBuffer::End() noexcept
+{
+    fences[index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    index = (index + 1) % FRAME_COUNT;
+}
+
+Triangle::Triangle(const glm::vec2& position_,
+                   const glm::vec3& rotation_,
+                   const glm::vec2& scale_) noexcept
+    : position{position_}
+    , scale{scale_}
+    , angle{std::atan2(rotation_.y, rotation_.x) + glm::radians(270.0f)}
+{
+
 }
 
 void Triangle::Update(const float deltaTime_) noexcept
 {
-    UpdatePosition(deltaTime_);
-    UpdateVertices(deltaTime_);
+    const float target = foldMode ? 1.0f : 0.0f;
+
+    // 정점 간 보간을 가중치 간 보간으로 옮긴 것이므로, 기존의 감속 곡선이 그대로 유지됩니다.
+    weight = weight * (1.0f - progress) + target * progress;
+
+    if (constexpr float guard = 0.25f; (progress += deltaTime_ * guard) >= 1.0f)
+    {
+        weight   = target;
+        progress = 0.0f;
+    }
 }
 
-void Triangle::Render(const Shader& shader_) const noexcept
+void Triangle::WriteVertices(float* const destination_, const float orbit_) const noexcept
 {
-    glm::mat4 model = {1.0f};
-    model = glm::translate(model, glm::vec3(position, 0.0f));
-    model = glm::rotate(model, std::atan2(rotation.y, rotation.x) + glm::radians(270.0f), glm::vec3(0.0f, 0.0f, 1.0f));
-    model = glm::scale(model, glm::vec3(scale, 1.0f));
+    const float c = std::cos(angle + orbit_);
+    const float s = std::sin(angle + orbit_);
 
-    const GLint modelLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Model");
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, &model[0][0]);
+    const float orbitCos = std::cos(orbit_);
+    const float orbitSin = std::sin(orbit_);
 
-    glm::mat4 projection = glm::ortho(
-       -static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 왼쪽
-        static_cast<float>(WINDOW_WIDTH)  / 2.0f, // 오른쪽
-       -static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 아래
-        static_cast<float>(WINDOW_HEIGHT) / 2.0f, // 위
-       -1.0f,                                     // near
-        1.0f                                      // far
-        );
+    const glm::vec2 center = {position.x * orbitCos - position.y * orbitSin,
+                              position.x * orbitSin + position.y * orbitCos};
+
+    for (std::size_t i = 0; i < FLOAT_COUNT; i += 2)
+    {
+        const float x = (UNFOLDED_VERTICES[i]     + (FOLDED_VERTICES[i]     - UNFOLDED_VERTICES[i])     * weight) * scale.x;
+        const float y = (UNFOLDED_VERTICES[i + 1] + (FOLDED_VERTICES[i + 1] - UNFOLDED_VERTICES[i + 1]) * weight) * scale.y;
+
+        destination_[i]     = x * c - y * s + center.x;
+        destination_[i + 1] = x * s + y * c + center.y;
+    }
+}
+
+TriangleRenderer::TriangleRenderer(const std::size_t capacity_) noexcept
+    : capacity{capacity_}
+    , vertexStream(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(capacity_ * Triangle::FLOAT_COUNT * sizeof(float)))
+    , weightStream(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(capacity_ * sizeof(float)))
+{
+    // CPU 경로: 정점 속성은 동적 버퍼의 시작을 가리키며, 구간은 첫 정점 인덱스로 선택합니다.
+    glGenVertexArrays(1, &cpuVao);
+    glBindVertexArray(cpuVao);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vertexStream.GetBufferID());
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
+    glEnableVertexAttribArray(0);
+
+    // GPU 경로: 키프레임(정점 별), 인스턴스 데이터와 가중치(인스턴스 별).
+    std::array<float, Triangle::FLOAT_COUNT * 2> keyframes{};
+    for (std::size_t i = 0; i < Triangle::FLOAT_COUNT; i += 2)
+    {
+        keyframes[i * 2]     = Triangle::UNFOLDED_VERTICES[i];
+        keyframes[i * 2 + 1] = Triangle::UNFOLDED_VERTICES[i + 1];
+        keyframes[i * 2 + 2] = Triangle::FOLDED_VERTICES[i];
+        keyframes[i * 2 + 3] = Triangle::FOLDED_VERTICES[i + 1];
+    }
+
+    glGenVertexArrays(1, &gpuVao);
+    glBindVertexArray(gpuVao);
+
+    glGenBuffers(1, &keyframeBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, keyframeBuffer);
+    glBufferStorage(GL_ARRAY_BUFFER, sizeof(keyframes), keyframes.data(), 0);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), nullptr);
+    glEnableVertexAttribArray(0);
+
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), reinterpret_cast<void*>(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    glGenBuffers(1, &instanceBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    glBufferStorage(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(capacity * sizeof(Instance)), nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, position)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, scale)));
+    glEnableVertexAttribArray(3);
+    glVertexAttribDivisor(3, 1);
 
-    const GLint projLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Projection");
-    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projection));
+    glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(Instance), reinterpret_cast<void*>(offsetof(Instance, angle)));
+    glEnableVertexAttribArray(4);
+    glVertexAttribDivisor(4, 1);
 
-    const GLint colorLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Color");
-    glUniform3fv(colorLoc, 1, &color[0]);
+    glBindBuffer(GL_ARRAY_BUFFER, weightStream.GetBufferID());
+    glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(float), nullptr);
+    glEnableVertexAttribArray(5);
+    glVertexAttribDivisor(5, 1);
 
-    glBindVertexArray(vao);
-    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, nullptr);
     glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void Triangle::UpdateVertices(const float deltaTime_) noexcept
+TriangleRenderer::~TriangleRenderer() noexcept
 {
-    std::array<float, 6> targetVertices = { };
+    glDeleteVertexArrays(1, &cpuVao);
+    glDeleteVertexArrays(1, &gpuVao);
+    glDeleteBuffers(1, &keyframeBuffer);
+    glDeleteBuffers(1, &instanceBuffer);
+}
 
-    if (foldMode)
+void TriangleRenderer::RenderCpu(const Shader&                shader_,
+                                 const std::vector<Triangle>& triangles_,
+                                 const float                  orbit_) noexcept
+{
+    const std::size_t count = std::min(triangles_.size(), capacity);
+    if (count == 0)
     {
-        targetVertices =
-        {
-            0.0f, -2.5f,
-           -1.0f, -1.0f,
-            1.0f, -1.0f
-        };
+        return;
     }
-    else
+
+    float* const destination = static_cast<float*>(vertexStream.Begin());
+
+    for (std::size_t i = 0; i < count; ++i)
     {
-        targetVertices =
-        {
-            0.0f,  1.0f,
-           -1.0f, -1.0f,
-            1.0f, -1.0f
-         };
+        triangles_[i].WriteVertices(destination + i * Triangle::FLOAT_COUNT, orbit_);
     }
 
-    for (std::size_t i = 0; i < vertices.size(); ++i)
+    const GLint firstVertex = static_cast<GLint>(vertexStream.GetOffset() / static_cast<GLsizeiptr>(2 * sizeof(float)));
+
+    shader_.Use();
+
+    glBindVertexArray(cpuVao);
+    glDrawArrays(GL_TRIANGLES, firstVertex, static_cast<GLsizei>(count * 3));
+    glBindVertexArray(0);
+
+    vertexStream.End();
+}
+
+void TriangleRenderer::RenderGpu(const Shader&                shader_,
+                                 const std::vector<Triangle>& triangles_,
+                                 const float                  orbit_) noexcept
+{
+    const std::size_t count = std::min(triangles_.size(), capacity);
+    if (count == 0)
     {
-        vertices[i] = vertices[i] * (1.0f - progress) + targetVertices[i] * progress;
+        return;
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size() * sizeof(float)), vertices.data(), GL_DYNAMIC_DRAW);
+    UploadInstances(triangles_);
 
-    if (constexpr float guard = 0.25f; (progress += deltaTime_ * guard) >= 1.0f)
+    float* const destination = static_cast<float*>(weightStream.Begin());
+
+    for (std::size_t i = 0; i < count; ++i)
     {
-        vertices = targetVertices;
-        progress = 0.0f;
+        destination[i] = triangles_[i].GetWeight();
     }
+
+    shader_.Use();
+
+    const GLint orbitLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Orbit");
+    glUniform1f(orbitLoc, orbit_);
+
+    glBindVertexArray(gpuVao);
+
+    // 가중치 속성만 이번 프레임의 구간을 가리키도록 옮깁니다.
+    glBindBuffer(GL_ARRAY_BUFFER, weightStream.GetBufferID());
+    glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(float), reinterpret_cast<void*>(weightStream.GetOffset()));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 3, static_cast<GLsizei>(count));
+    glBindVertexArray(0);
+
+    weightStream.End();
 }
 
-void Triangle::UpdatePosition(const float deltaTime_) noexcept
+void TriangleRenderer::UploadInstances(const std::vector<Triangle>& triangles_) noexcept
 {
-    if (rotateMode == Rotation::None)
+    const std::size_t count = std::min(triangles_.size(), capacity);
+
+    if (count < uploadedCount)
     {
-        return;
+        uploadedCount = 0;
     }
 
-    const float radius = glm::length(position);
-    float theta = atan2(position.y, position.x);
-
-    if (rotateMode == Rotation::CW)
+    if (count == uploadedCount)
     {
-        theta -= deltaTime_;
+        return;
     }
-    else
+
+    std::vector<Instance> instances;
+    instances.reserve(count - uploadedCount);
+
+    for (std::size_t i = uploadedCount; i < count; ++i)
     {
-        theta += deltaTime_;
+        instances.push_back({triangles_[i].GetPosition(), triangles_[i].GetScale(), triangles_[i].GetAngle()});
     }
 
-    position = {radius * cos(theta), radius * sin(theta)};
-    rotation = {cos(theta), sin(theta), 0.0f};
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    glBufferSubData(GL_ARRAY_BUFFER,
+                    static_cast<GLintptr>(uploadedCount * sizeof(Instance)),
+                    static_cast<GLsizeiptr>(instances.size() * sizeof(Instance)),
+                    instances.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    uploadedCount = count;
 }
 
 void OnKeyInteracted(GLFWwindow* window_,
@@ -673,6 +1202,31 @@ void OnKeyInteracted(GLFWwindow* window_,
 
             break;
         }
+        case GLFW_KEY_N:
+        {
+            SpawnTriangles(SPAWN_TRIANGLE_COUNT);
+            break;
+        }
+        case GLFW_KEY_M:
+        {
+            if (morphMode == MorphMode::Cpu)
+            {
+                morphMode = MorphMode::Gpu;
+                SPDLOG_INFO("Morph: GPU");
+            }
+            else
+            {
+                morphMode = MorphMode::Cpu;
+                SPDLOG_INFO("Morph: CPU");
+            }
+
+            break;
+        }
+        case GLFW_KEY_B:
+        {
+            shouldBenchmark = true;
+            break;
+        }
         case GLFW_KEY_Q:
         {
             glfwSetWindowShouldClose(window_, true);
@@ -710,6 +1264,103 @@ void OnButtonInteracted(GLFWwindow* window_,
     }
 }
 
+void SpawnTriangles(const std::size_t count_) noexcept
+{
+    const std::size_t available = MAX_TRIANGLE_COUNT - triangles.size();
+    if (available == 0)
+    {
+        SPDLOG_WARN("Triangle count cannot be greater than {}.", MAX_TRIANGLE_COUNT);
+        return;
+    }
+
+    std::uniform_real_distribution<float> distX(-static_cast<float>(WINDOW_WIDTH) / 2.0f, static_cast<float>(WINDOW_WIDTH) / 2.0f);
+    std::uniform_real_distribution<float> distY(-static_cast<float>(WINDOW_HEIGHT) / 2.0f, static_cast<float>(WINDOW_HEIGHT) / 2.0f);
+
+    const std::size_t count = std::min(count_, available);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const glm::vec2 position = {distX(gen), distY(gen)};
+        const float     theta    = std::atan2(position.y, position.x);
+
+        triangles.emplace_back(position, glm::vec3(std::cos(theta), std::sin(theta), 0.0f), glm::vec2(6.0f, 3.0f));
+    }
+
+    SPDLOG_INFO("Triangle count: {}", triangles.size());
+}
+
+void UpdateTriangles(const float deltaTime_) noexcept
+{
+    if (rotateMode == Rotation::CW)
+    {
+        orbitAngle -= deltaTime_;
+    }
+    else if (rotateMode == Rotation::CCW)
+    {
+        orbitAngle += deltaTime_;
+    }
+
+    for (Triangle& triangle : triangles)
+    {
+        triangle.Update(deltaTime_);
+    }
+}
+
+void RunBenchmark(TriangleRenderer& renderer_,
+                  const Shader&     cpuShader_,
+                  const Shader&     morphShader_) noexcept
+{
+    if (triangles.size() < BENCHMARK_TRIANGLE_COUNT)
+    {
+        SpawnTriangles(BENCHMARK_TRIANGLE_COUNT - triangles.size());
+    }
+
+    constexpr float deltaTime = 1.0f / 60.0f;
+
+    const auto measure = [&](const MorphMode mode_) -> double
+    {
+        const auto renderFrame = [&]()
+        {
+            UpdateTriangles(deltaTime);
+
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            if (mode_ == MorphMode::Cpu)
+            {
+                renderer_.RenderCpu(cpuShader_, triangles, orbitAngle);
+            }
+            else
+            {
+                renderer_.RenderGpu(morphShader_, triangles, orbitAngle);
+            }
+        };
+
+        // 인스턴스 업로드 등 최초 비용이 측정에 섞이지 않도록 몇 프레임 먼저 그립니다.
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            renderFrame();
+        }
+        glFinish();
+
+        const auto begin = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < BENCHMARK_FRAME_COUNT; ++i)
+        {
+            renderFrame();
+        }
+        glFinish();
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - begin;
+        return elapsed.count() / static_cast<double>(BENCHMARK_FRAME_COUNT);
+    };
+
+    const double cpu = measure(MorphMode::Cpu);
+    const double gpu = measure(MorphMode::Gpu);
+
+    SPDLOG_INFO("Benchmark ({} triangles, {} frames)", triangles.size(), BENCHMARK_FRAME_COUNT);
+    SPDLOG_INFO("  CPU lerp + upload: {:.3f} ms/frame ({} bytes/frame)", cpu, triangles.size() * Triangle::FLOAT_COUNT * sizeof(float));
+    SPDLOG_INFO("  GPU morph:         {:.3f} ms/frame ({} bytes/frame)", gpu, triangles.size() * sizeof(float));
+}
+
 void OnCursorMoved(GLFWwindow* window_,
                    double      x_,
                    double      y_) noexcept
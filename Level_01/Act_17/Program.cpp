@@ -3,6 +3,8 @@
 #include <fstream>
 #include <ios>
 #include <random>
+#include <span>
+#include <vector>
 
 #include <glad/glad.h>
 
@@ -66,6 +68,65 @@ class Shader final
     GLuint programID = 0;
 };
 
+/**
+ * @class FaceMatrixBuffer
+ *
+ * @brief 면 별 모델 행렬을 담는 셰이더 저장 버퍼를 정의합니다.
+ *
+ * 정점 셰이더는 gl_VertexID로 면을, gl_InstanceID로 오브젝트를 구하여 이 버퍼에서 행렬을 가져옵니다.
+ */
+class FaceMatrixBuffer final
+{
+public:
+    /**
+     * @brief 생성자.
+     */
+    FaceMatrixBuffer() noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~FaceMatrixBuffer() noexcept;
+
+    FaceMatrixBuffer(const FaceMatrixBuffer&) = delete;
+    FaceMatrixBuffer& operator=(const FaceMatrixBuffer&) = delete;
+
+    /**
+     * @brief 지정한 개수의 행렬을 기록할 스테이징 영역을 반환합니다.
+     *
+     * @param count_ 기록할 행렬의 개수.
+     *
+     * @return glm::mat4* 스테이징 영역의 시작 주소.
+     */
+    [[nodiscard]]
+    glm::mat4* Begin(std::size_t count_) noexcept;
+
+    /**
+     * @brief 스테이징된 행렬들을 업로드하고 바인딩합니다.
+     */
+    void End() noexcept;
+
+    /**
+     * @brief 셰이더 저장 버퍼 바인딩 지점.
+     */
+    static constexpr GLuint BINDING = 0;
+private:
+    /**
+     * @brief 셰이더 저장 버퍼 객체.
+     */
+    GLuint ssbo = 0;
+
+    /**
+     * @brief 버퍼에 담을 수 있는 행렬의 개수.
+     */
+    std::size_t capacity = 0;
+
+    /**
+     * @brief 업로드 전 행렬들을 모으는 스테이징 버퍼.
+     */
+    std::vector<glm::mat4> staging;
+};
+
 /**
  * @class Object
  *
@@ -135,6 +196,27 @@ class Object
      */
     bool triggerYAnimation = false;
 protected:
+    /**
+     * @brief 오브젝트의 모델 행렬을 반환합니다.
+     *
+     * @return glm::mat4 이동, 회전, 크기가 적용된 모델 행렬.
+     */
+    [[nodiscard]]
+    glm::mat4 GetModel() const noexcept;
+
+    /**
+     * @brief 면 별 모델 행렬 버퍼를 사용해 여러 오브젝트를 한 번의 드로우로 그립니다.
+     *
+     * @param shader_          사용할 셰이더.
+     * @param faceCount_       오브젝트 당 면의 개수.
+     * @param verticesPerFace_ 면 당 정점의 개수. (마지막 면은 남은 정점을 모두 포함합니다)
+     * @param instanceCount_   그릴 오브젝트의 개수.
+     */
+    void DrawFaces(const Shader& shader_,
+                   GLint         faceCount_,
+                   GLint         verticesPerFace_,
+                   GLsizei       instanceCount_) const noexcept;
+
     /**
      * @brief 정점 배열 객체.
      */
@@ -184,6 +266,19 @@ class Cube final
      */
     virtual void Render(const Shader& shader_) const noexcept override;
 
+    /**
+     * @brief 여러 큐브의 면 변환을 한꺼번에 계산하여 한 번의 드로우로 렌더링합니다.
+     *
+     * @param shader_ 사용할 셰이더.
+     * @param cubes_  렌더링할 큐브들.
+     */
+    static void RenderBatch(const Shader& shader_, std::span<const Cube* const> cubes_) noexcept;
+
+    /**
+     * @brief 큐브 면의 개수.
+     */
+    static constexpr GLint FACE_COUNT = 6;
+
     /**
      * @brief T 애니메이션 트리거.
      */
@@ -233,6 +328,13 @@ class Cube final
      * @brief 뒷면의 크기 조절 비율.
      */
     float backScale = 1.0f;
+
+    /**
+     * @brief 면 별 모델 행렬을 기록합니다.
+     *
+     * @param destination_ FACE_COUNT 개의 행렬을 기록할 주소.
+     */
+    void WriteFaceModels(glm::mat4* destination_) const noexcept;
 };
 
 /**
@@ -268,6 +370,19 @@ class Pyramid final
      */
     virtual void Render(const Shader& shader_) const noexcept override;
 
+    /**
+     * @brief 여러 피라미드의 면 변환을 한꺼번에 계산하여 한 번의 드로우로 렌더링합니다.
+     *
+     * @param shader_   사용할 셰이더.
+     * @param pyramids_ 렌더링할 피라미드들.
+     */
+    static void RenderBatch(const Shader& shader_, std::span<const Pyramid* const> pyramids_) noexcept;
+
+    /**
+     * @brief 피라미드 면의 개수. (옆면 4개와 밑면)
+     */
+    static constexpr GLint FACE_COUNT = 5;
+
     /**
      * @brief O 애니메이션 트리거.
      */
@@ -298,6 +413,13 @@ class Pyramid final
      * @brief 네 면의 상태.
      */
     FaceState faces[4];
+
+    /**
+     * @brief 면 별 모델 행렬을 기록합니다.
+     *
+     * @param destination_ FACE_COUNT 개의 행렬을 기록할 주소.
+     */
+    void WriteFaceModels(glm::mat4* destination_) const noexcept;
 };
 
 /**
@@ -473,6 +595,11 @@ static constexpr int CONTEXT_MINOR_VERSION = 5;
  */
 static Axes* axes;
 
+/**
+ * @brief 면 별 모델 행렬 버퍼.
+ */
+static FaceMatrixBuffer* faceMatrices = nullptr;
+
 /**
  * @brief 오브젝트들.
  */
@@ -541,6 +668,8 @@ int main()
     const Shader shader(vertexShaderSource, fragmentShaderSource);
     shader.Use();
 
+    faceMatrices = new FaceMatrixBuffer();
+
     axes = new Axes();
     axes->rotation = {30.0f, -30.0f, 0.0f};
 
@@ -618,6 +747,8 @@ int main()
         delete object;
     }
 
+    delete faceMatrices;
+
     return 0;
 }
 
@@ -680,6 +811,42 @@ Shader::~Shader() noexcept
     }
 }
 
+FaceMatrixBuffer::FaceMatrixBuffer() noexcept
+{
+    glGenBuffers(1, &ssbo);
+}
+
+FaceMatrixBuffer::~FaceMatrixBuffer() noexcept
+{
+    if (ssbo != 0)
+    {
+        glDeleteBuffers(1, &ssbo);
+    }
+}
+
+glm::mat4* FaceMatrixBuffer::Begin(const std::size_t count_) noexcept
+{
+    staging.resize(count_);
+    return staging.data();
+}
+
+void FaceMatrixBuffer::End() noexcept
+{
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+
+    if (staging.size() > capacity)
+    {
+        capacity = staging.size();
+    }
+
+    // 이전 드로우가 읽고 있을 수 있으므로 저장 공간을 고아로 만든 뒤 기록합니다.
+    glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(capacity * sizeof(glm::mat4)), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, static_cast<GLsizeiptr>(staging.size() * sizeof(glm::mat4)), staging.data());
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, BINDING, ssbo);
+}
+
 Object::Object(const std::initializer_list<GLfloat> vertices_) noexcept
 {
     constexpr size_t floatsPerVertex = 6;
@@ -737,6 +904,37 @@ Object::~Object() noexcept
     }
 }
 
+glm::mat4 Object::GetModel() const noexcept
+{
+    glm::mat4 model = {1.0f};
+    model = glm::translate(model, position);
+    model = glm::rotate(model, glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
+    model = glm::rotate(model, glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
+    model = glm::rotate(model, glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+    model = glm::scale(model, scale);
+
+    return model;
+}
+
+void Object::DrawFaces(const Shader& shader_,
+                       const GLint   faceCount_,
+                       const GLint   verticesPerFace_,
+                       const GLsizei instanceCount_) const noexcept
+{
+    const GLint faceCountLoc = glGetUniformLocation(shader_.GetProgramID(), "u_FaceCount");
+    glUniform1i(faceCountLoc, faceCount_);
+
+    const GLint verticesPerFaceLoc = glGetUniformLocation(shader_.GetProgramID(), "u_VerticesPerFace");
+    glUniform1i(verticesPerFaceLoc, verticesPerFace_);
+
+    glBindVertexArray(vao);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, vertexCount, instanceCount_);
+    glBindVertexArray(0);
+
+    // 면 행렬을 사용하지 않는 오브젝트(좌표축)는 u_Model을 그대로 사용합니다.
+    glUniform1i(faceCountLoc, 0);
+}
+
 Cube::Cube() noexcept
     : Object(
         {
@@ -846,56 +1044,65 @@ void Cube::Update(const float deltaTime_) noexcept
 
 void Cube::Render(const Shader& shader_) const noexcept
 {
-    glm::mat4 objectModel = {1.0f};
-    objectModel = glm::rotate(objectModel, glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
-    objectModel = glm::rotate(objectModel, glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
-    objectModel = glm::rotate(objectModel, glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
-    objectModel = glm::scale(objectModel, scale);
+    const Cube* const self = this;
+    RenderBatch(shader_, std::span<const Cube* const>(&self, 1));
+}
 
-    const GLint modelLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Model");
+void Cube::RenderBatch(const Shader& shader_, const std::span<const Cube* const> cubes_) noexcept
+{
+    if (cubes_.empty())
+    {
+        return;
+    }
 
-    glBindVertexArray(vao);
+    glm::mat4* const destination = faceMatrices->Begin(cubes_.size() * FACE_COUNT);
 
-    for (int face = 0; face < 6; ++face)
+    for (std::size_t i = 0; i < cubes_.size(); ++i)
     {
-        glm::mat4 faceLocal = {1.0f};
+        cubes_[i]->WriteFaceModels(destination + i * FACE_COUNT);
+    }
 
-        if (face == 4)
-        {
-            constexpr glm::vec3 pivot = glm::vec3(0.0f, 0.5f, 0.0f);
-            faceLocal = glm::translate(faceLocal, pivot);
-            faceLocal = glm::rotate(faceLocal, topAngleRad, glm::vec3(0.0f, 0.0f, 1.0f));
-            faceLocal = glm::translate(faceLocal, -pivot);
-        }
-        else if (face == 0)
-        {
-            constexpr glm::vec3 pivot = glm::vec3(0.0f, 0.5f, 0.5f);
-            faceLocal = glm::translate(faceLocal, pivot);
-            faceLocal = glm::rotate(faceLocal, -frontAngleRad, glm::vec3(1.0f, 0.0f, 0.0f));
-            faceLocal = glm::translate(faceLocal, -pivot);
-        }
-        else if (face == 2 || face == 3)
-        {
-            constexpr glm::vec3 pivot = glm::vec3(-0.5f, 0.0f, 0.0f);
-            faceLocal = glm::translate(faceLocal, pivot);
-            faceLocal = glm::rotate(faceLocal, sideAngleRad, glm::vec3(1.0f, 0.0f, 0.0f));
-            faceLocal = glm::translate(faceLocal, -pivot);
-        }
-        else if (face == 1)
-        {
-            constexpr glm::vec3 pivot = glm::vec3(0.0f, 0.0f, -0.5f);
-            faceLocal = glm::translate(faceLocal, pivot);
-            faceLocal = glm::scale(faceLocal, glm::vec3(backScale, backScale, 1.0f));
-            faceLocal = glm::translate(faceLocal, -pivot);
-        }
+    faceMatrices->End();
+
+    cubes_.front()->DrawFaces(shader_, FACE_COUNT, 6, static_cast<GLsizei>(cubes_.size()));
+}
+
+void Cube::WriteFaceModels(glm::mat4* const destination_) const noexcept
+{
+    const auto hinge = [](const glm::vec3& pivot_, const float angle_, const glm::vec3& axis_) -> glm::mat4
+    {
+        glm::mat4 local = glm::translate(glm::mat4{1.0f}, pivot_);
+        local = glm::rotate(local, angle_, axis_);
+        local = glm::translate(local, -pivot_);
 
-        const glm::mat4 faceModel = glm::translate(glm::mat4{1.0f}, position) * objectModel * faceLocal;
+        return local;
+    };
+
+    const glm::mat4 model = GetModel();
+
+    // 앞면: 아래쪽 모서리를 경첩으로 여닫습니다.
+    destination_[0] = model * hinge({0.0f, 0.5f, 0.5f}, -frontAngleRad, {1.0f, 0.0f, 0.0f});
+
+    // 뒷면: 중심을 기준으로 크기를 조절합니다.
+    {
+        constexpr glm::vec3 pivot = glm::vec3(0.0f, 0.0f, -0.5f);
+
+        glm::mat4 local = glm::translate(glm::mat4{1.0f}, pivot);
+        local = glm::scale(local, glm::vec3(backScale, backScale, 1.0f));
+        local = glm::translate(local, -pivot);
 
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(faceModel));
-        glDrawArrays(GL_TRIANGLES, face * 6, 6);
+        destination_[1] = model * local;
     }
 
-    glBindVertexArray(0);
+    // 두 옆면: 같은 회전을 공유합니다.
+    destination_[2] = model * hinge({-0.5f, 0.0f, 0.0f}, sideAngleRad, {1.0f, 0.0f, 0.0f});
+    destination_[3] = destination_[2];
+
+    // 윗면: 중심 축을 따라 회전합니다.
+    destination_[4] = model * hinge({0.0f, 0.5f, 0.0f}, topAngleRad, {0.0f, 0.0f, 1.0f});
+
+    // 아랫면.
+    destination_[5] = model;
 }
 
 Pyramid::Pyramid() noexcept
@@ -996,69 +1203,63 @@ void Pyramid::Update(const float deltaTime_) noexcept
 
 void Pyramid::Render(const Shader& shader_) const noexcept
 {
-    glm::mat4 model = {1.0f};
-    model = glm::translate(model, position);
-    model = glm::rotate(model,  glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
-    model = glm::rotate(model,  glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
-    model = glm::rotate(model,  glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
-    model = glm::scale(model, scale);
+    const Pyramid* const self = this;
+    RenderBatch(shader_, std::span<const Pyramid* const>(&self, 1));
+}
 
-    const GLint modelLoc = glGetUniformLocation(shader_.GetProgramID(), "u_Model");
+void Pyramid::RenderBatch(const Shader& shader_, const std::span<const Pyramid* const> pyramids_) noexcept
+{
+    if (pyramids_.empty())
+    {
+        return;
+    }
 
-    glBindVertexArray(vao);
+    glm::mat4* const destination = faceMatrices->Begin(pyramids_.size() * FACE_COUNT);
 
-    for (int face = 0; face < 5; ++face)
+    for (std::size_t i = 0; i < pyramids_.size(); ++i)
     {
-        glm::mat4 faceLocal = {1.0f};
+        pyramids_[i]->WriteFaceModels(destination + i * FACE_COUNT);
+    }
 
-        if (face >= 0 && face <= 3)
-        {
-            glm::vec3 pivot;
-            glm::vec3 axis;
+    faceMatrices->End();
 
-            float angle = faces[face].angle;
+    // 옆면은 3개, 밑면은 6개의 정점으로 이루어지므로 마지막 면이 남은 정점을 모두 차지합니다.
+    pyramids_.front()->DrawFaces(shader_, FACE_COUNT, 3, static_cast<GLsizei>(pyramids_.size()));
+}
 
-            switch (face)
-            {
-                case 0:
-                    pivot = glm::vec3(0.0f, -0.5f, -0.5f);
-                    axis  = glm::vec3(1.0f, 0.0f, 0.0f);
-                    angle = -angle; // fold outward
-                    break;
-                case 1:
-                    pivot = glm::vec3(0.5f, -0.5f, 0.0f);
-                    axis  = glm::vec3(0.0f, 0.0f, 1.0f);
-                    angle = -angle; // fold outward
-                    break;
-                case 2:
-                    pivot = glm::vec3(0.0f, -0.5f, 0.5f);
-                    axis  = glm::vec3(1.0f, 0.0f, 0.0f);
-                    // keep angle positive so it mirrors outward
-                    break;
-                case 3:
-                    pivot = glm::vec3(-0.5f, -0.5f, 0.0f);
-                    axis  = glm::vec3(0.0f, 0.0f, 1.0f);
-                    // keep angle positive so it mirrors outward
-                    break;
-                default:
-                    pivot = glm::vec3(0.0f);
-                    axis  = glm::vec3(0.0f, 1.0f, 0.0f);
-                    break;
-            }
+void Pyramid::WriteFaceModels(glm::mat4* const destination_) const noexcept
+{
+    // 면 별 경첩의 위치와 축, 그리고 바깥쪽으로 접히기 위한 회전 방향.
+    constexpr std::array<glm::vec3, 4> pivots =
+    {
+        glm::vec3( 0.0f, -0.5f, -0.5f),
+        glm::vec3( 0.5f, -0.5f,  0.0f),
+        glm::vec3( 0.0f, -0.5f,  0.5f),
+        glm::vec3(-0.5f, -0.5f,  0.0f),
+    };
 
-            faceLocal = glm::translate(faceLocal, pivot);
-            faceLocal = glm::rotate(faceLocal, angle, axis);
-            faceLocal = glm::translate(faceLocal, -pivot);
-        }
+    constexpr std::array<glm::vec3, 4> hingeAxes =
+    {
+        glm::vec3(1.0f, 0.0f, 0.0f),
+        glm::vec3(0.0f, 0.0f, 1.0f),
+        glm::vec3(1.0f, 0.0f, 0.0f),
+        glm::vec3(0.0f, 0.0f, 1.0f),
+    };
+
+    constexpr std::array<float, 4> directions = {-1.0f, -1.0f, 1.0f, 1.0f};
 
-        // Use the already-translated/rotated/scaled model; do not reapply position translation.
-        const glm::mat4 faceModel = model * faceLocal;
+    const glm::mat4 model = GetModel();
 
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, &faceModel[0][0]);
-        glDrawArrays(GL_TRIANGLES, face * 3, (face == 4) ? 6 : 3);
+    for (std::size_t face = 0; face < 4; ++face)
+    {
+        glm::mat4 local = glm::translate(glm::mat4{1.0f}, pivots[face]);
+        local = glm::rotate(local, faces[face].angle * directions[face], hingeAxes[face]);
+        local = glm::translate(local, -pivots[face]);
+
+        destination_[face] = model * local;
     }
 
-    glBindVertexArray(0);
+    destination_[4] = model;
 }
 
 Axes::Axes() noexcept
@@ -1,11 +1,25 @@
 #version 450 core
 layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec3 aColor;
+layout(std430, binding = 0) readonly buffer FaceMatrices
+{
+    mat4 faceModels[];
+};
 uniform mat4 u_Projection;
 uniform mat4 u_Model;
+uniform int u_FaceCount;
+uniform int u_VerticesPerFace;
 out vec3 vColor;
 void main()
 {
     vColor = aColor;
-    gl_Position = u_Projection * u_Model * vec4(aPos, 1.0);
+
+    mat4 model = u_Model;
+    if (u_FaceCount > 0)
+    {
+        int face = min(gl_VertexID / u_VerticesPerFace, u_FaceCount - 1);
+        model = faceModels[gl_InstanceID * u_FaceCount + face];
+    }
+
+    gl_Position = u_Projection * model * vec4(aPos, 1.0);
 }
\ No newline at end of file
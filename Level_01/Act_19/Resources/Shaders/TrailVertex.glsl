@@ -0,0 +1,33 @@
+#version 450 core
+
+layout(std430, binding = 0) readonly buffer TrailPoints
+{
+    vec4 points[];
+};
+
+layout(std430, binding = 1) readonly buffer TrailColors
+{
+    vec4 colors[];
+};
+
+uniform mat4 uView;
+uniform mat4 uProjection;
+
+uniform int uStride;
+uniform int uCapacity;
+uniform int uHead;
+uniform int uCount;
+
+out vec3 vColor;
+
+void main()
+{
+    // gl_VertexID는 링 버퍼의 슬롯, gl_InstanceID는 천체 인덱스입니다.
+    const int slot = gl_VertexID;
+    const int age  = (uHead - 1 - (slot % uCapacity) + uCapacity) % uCapacity;
+
+    const float fade = 1.0 - float(age) / float(uCount);
+
+    vColor = colors[gl_InstanceID].rgb * fade;
+    gl_Position = uProjection * uView * vec4(points[slot * uStride + gl_InstanceID].xyz, 1.0);
+}
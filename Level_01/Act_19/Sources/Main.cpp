@@ -5,6 +5,7 @@
 #include "Rendering/Camera.h"
 #include "Rendering/Mesh.h"
 #include "Rendering/Shader.h"
+#include "Rendering/Trail.h"
 
 #include "Core/Application.h"
 #include "Core/File.h"
@@ -18,6 +19,11 @@
  */
 static void OnStart() noexcept;
 
+/**
+ * @brief 고정된 시간 간격마다 호출됩니다.
+ */
+static void OnFixedUpdate() noexcept;
+
 /**
  * @brief 매 프레임마다 호출됩니다.
  */
@@ -73,10 +79,30 @@ static std::unique_ptr<Camera> camera = nullptr;
  */
 static std::vector<std::unique_ptr<Planet>> planets;
 
+/**
+ * @brief 궤적을 그릴 때 사용할 셰이더.
+ */
+static std::unique_ptr<Shader> trailShader = nullptr;
+
 /**
  * @brief 행성들의 공전 궤도 경로.
  */
-static std::vector<std::vector<std::unique_ptr<Object>>> pathes;
+static std::unique_ptr<Trail> trail = nullptr;
+
+/**
+ * @brief 궤적에 추가할 행성들의 위치. (매 샘플마다 재사용됩니다.)
+ */
+static std::vector<glm::vec3> trailPoints;
+
+/**
+ * @brief 행성 당 궤적 점의 최대 개수.
+ */
+static constexpr std::size_t TRAIL_CAPACITY = 1024;
+
+/**
+ * @brief 궤적을 남길 수 있는 행성의 최대 개수.
+ */
+static constexpr std::size_t TRAIL_MAX_BODIES = 4096;
 
 /**
  * @brief 모든 행성의 공전 궤도 Z축 기울기 속도.
@@ -98,6 +124,7 @@ int main()
     specification.height                     = APPLICATION_HEIGHT;
     specification.fps                        = FPS;
     specification.onStart                    = OnStart;
+    specification.onFixedUpdate              = OnFixedUpdate;
     specification.onUpdate                   = OnUpdate;
     specification.onRender                  = OnRender;
 
@@ -115,6 +142,11 @@ static void OnStart() noexcept
     shader = std::make_unique<Shader>(vertexShaderSource, fragmentShaderSource);
     shader->Use();
 
+    const std::string trailVertexShaderFile = File::ReadFile("Resources/Shaders/TrailVertex.glsl");
+    const char* const trailVertexShaderSource = trailVertexShaderFile.c_str();
+
+    trailShader = std::make_unique<Shader>(trailVertexShaderSource, fragmentShaderSource);
+
     constexpr glm::vec3 position    = { 0.0f, 0.0f,  10.0f };
     constexpr glm::vec3 front       = { 0.0f, 0.0f, -1.0f };
     constexpr glm::vec3 up          = { 0.0f, 1.0f,  0.0f };
@@ -152,7 +184,23 @@ static void OnStart() noexcept
     moon3->SetScale(glm::vec3(0.5f, 0.5f, 0.5f));
     moon3->SetColor(glm::vec3(1.0f, 0.0f, 0.0f));
 
-    pathes.resize(planets.size());
+    trail = std::make_unique<Trail>(TRAIL_CAPACITY, TRAIL_MAX_BODIES);
+    for (const std::unique_ptr<Planet>& planet : planets)
+    {
+        trail->AddBody(planet->GetColor());
+    }
+
+    trailPoints.resize(planets.size());
+}
+
+static void OnFixedUpdate() noexcept
+{
+    for (std::size_t index = 0; index < planets.size(); ++index)
+    {
+        trailPoints[index] = planets[index]->GetPosition();
+    }
+
+    trail->Push(trailPoints);
 }
 
 static void OnUpdate() noexcept
@@ -246,23 +294,14 @@ static void OnUpdate() noexcept
         Application::Quit();
     }
 
-	for (std::size_t index = 0; index < planets.size(); ++index)
+    if (Input::IsKeyPressed('c'))
     {
-        planets[index]->Update();
-
-        //Object* pathObj = pathes[index].emplace_back(std::make_unique<Object>()).get();
-		//pathObj->SetPosition(planets[index]->GetPosition());
-        //pathObj->SetScale(glm::vec3(0.1f, 0.1f, 0.1f));
-        //pathObj->SetColor(glm::vec3(0.0f, 0.0f, 0.0f));
-		//pathObj->SetMesh(Mesh::LoadFrom("Resources/Models/Sphere.obj"));
+        trail->Clear();
     }
 
-    for (auto& path : pathes)
+	for (const std::unique_ptr<Planet>& planet : planets)
     {
-        if (path.size() > 10)
-        {
-			path.erase(path.begin());
-        }
+        planet->Update();
     }
 }
 
@@ -278,11 +317,13 @@ static void OnRender() noexcept
         planet->Render(*shader, renderMode);
     }
 
-    for (const auto& path : pathes)
+    if (camera != nullptr && trailShader != nullptr)
     {
-        for (const auto& point : path)
-        {
-            point->Render(*shader, renderMode);
-        }
-	}
+        trailShader->Use();
+        camera->PreRender(*trailShader);
+
+        trail->Render(*trailShader);
+
+        shader->Use();
+    }
 }
\ No newline at end of file
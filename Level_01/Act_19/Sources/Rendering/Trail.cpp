@@ -0,0 +1,147 @@
+#include "Trail.h"
+
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+
+Trail::Trail(const std::size_t capacity_,
+             const std::size_t maxBodies_) noexcept
+    : vao{0}
+    , pointBuffer{0}
+    , colorBuffer{0}
+    , capacity{std::max<std::size_t>(capacity_, 2)}
+    , maxBodies{maxBodies_}
+    , bodyCount{0}
+    , head{0}
+    , count{0}
+    , staging(maxBodies_, glm::vec4{0.0f, 0.0f, 0.0f, 1.0f})
+{
+    glGenVertexArrays(1, &vao);
+
+    glGenBuffers(1, &pointBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, pointBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER,
+                 static_cast<GLsizeiptr>(sizeof(glm::vec4) * (capacity + 1) * maxBodies),
+                 nullptr,
+                 GL_DYNAMIC_DRAW);
+
+    glGenBuffers(1, &colorBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, colorBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER,
+                 static_cast<GLsizeiptr>(sizeof(glm::vec4) * maxBodies),
+                 nullptr,
+                 GL_STATIC_DRAW);
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+Trail::~Trail() noexcept
+{
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &pointBuffer);
+    glDeleteBuffers(1, &colorBuffer);
+}
+
+std::size_t Trail::AddBody(const glm::vec3& color_) noexcept
+{
+    if (bodyCount >= maxBodies)
+    {
+        spdlog::error("Trail body limit exceeded: {}", maxBodies);
+        return maxBodies;
+    }
+
+    const glm::vec4 color = {color_, 1.0f};
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, colorBuffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER,
+                    static_cast<GLintptr>(sizeof(glm::vec4) * bodyCount),
+                    sizeof(glm::vec4),
+                    &color);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    // 새 천체가 기존 천체들의 궤적 중간에 끼어들지 않도록 궤적을 비웁니다.
+    Clear();
+
+    return bodyCount++;
+}
+
+void Trail::Push(const std::span<const glm::vec3> positions_) noexcept
+{
+    if (positions_.size() != bodyCount)
+    {
+        spdlog::error("Trail position count mismatch: expected {}, got {}", bodyCount, positions_.size());
+        return;
+    }
+
+    for (std::size_t index = 0; index < bodyCount; ++index)
+    {
+        staging[index] = glm::vec4{positions_[index], 1.0f};
+    }
+
+    Upload(head);
+    if (head == 0)
+    {
+        Upload(capacity);
+    }
+
+    head  = (head + 1) % capacity;
+    count = std::min(count + 1, capacity);
+}
+
+void Trail::Clear() noexcept
+{
+    head  = 0;
+    count = 0;
+}
+
+void Trail::Render(const Shader& shader_) const noexcept
+{
+    if (bodyCount == 0 || count < 2)
+    {
+        return;
+    }
+
+    shader_.SetUniformInt("uStride",   static_cast<int>(maxBodies));
+    shader_.SetUniformInt("uCapacity", static_cast<int>(capacity));
+    shader_.SetUniformInt("uHead",     static_cast<int>(head));
+    shader_.SetUniformInt("uCount",    static_cast<int>(count));
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, POINT_BINDING, pointBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, COLOR_BINDING, colorBuffer);
+    glBindVertexArray(vao);
+
+    const std::size_t oldest    = (head + capacity - count) % capacity;
+    const GLsizei     instances = static_cast<GLsizei>(bodyCount);
+
+    if (oldest + count <= capacity)
+    {
+        glDrawArraysInstanced(GL_LINE_STRIP,
+                              static_cast<GLint>(oldest),
+                              static_cast<GLsizei>(count),
+                              instances);
+    }
+    else
+    {
+        // 마지막 슬롯(0번 슬롯의 사본)까지 그려 두 구간을 잇습니다.
+        glDrawArraysInstanced(GL_LINE_STRIP,
+                              static_cast<GLint>(oldest),
+                              static_cast<GLsizei>(capacity - oldest + 1),
+                              instances);
+        glDrawArraysInstanced(GL_LINE_STRIP,
+                              0,
+                              static_cast<GLsizei>(head),
+                              instances);
+    }
+
+    glBindVertexArray(0);
+}
+
+void Trail::Upload(const std::size_t slot_) const noexcept
+{
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, pointBuffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER,
+                    static_cast<GLintptr>(sizeof(glm::vec4) * slot_ * maxBodies),
+                    static_cast<GLsizeiptr>(sizeof(glm::vec4) * bodyCount),
+                    staging.data());
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
@@ -0,0 +1,177 @@
+#ifndef GUARD_TRAIL_H
+#define GUARD_TRAIL_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gl/glew.h>
+
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include "Shader.h"
+
+/**
+ * @class Trail
+ *
+ * @brief 여러 천체의 공전 궤적을 고정 크기 링 버퍼로 관리하고 렌더링합니다.
+ *
+ * 모든 천체는 하나의 헤드를 공유하며, 버퍼는 [슬롯][천체] 순서로 배치됩니다.
+ * 따라서 매 샘플마다 새로 추가된 점들은 연속된 구간을 이루어 한 번의 glBufferSubData로 업로드되고,
+ * 렌더링 시에는 정점 셰이더가 gl_VertexID(슬롯)와 gl_InstanceID(천체)로 위치를 가져옵니다.
+ * 링이 감겨 있을 때는 두 번의 인스턴스 드로우로 전체 궤적을 그리며, 프레임 중 어떠한 할당도 발생하지 않습니다.
+ */
+class Trail final
+{
+public:
+    /**
+     * @brief 생성자.
+     *
+     * @param capacity_  천체 당 저장할 궤적 점의 최대 개수.
+     * @param maxBodies_ 등록 가능한 천체의 최대 개수.
+     */
+    explicit Trail(std::size_t capacity_, std::size_t maxBodies_) noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~Trail() noexcept;
+
+    Trail(const Trail&) = delete;
+    Trail& operator=(const Trail&) = delete;
+
+    /**
+     * @brief 궤적을 남길 천체를 등록합니다.
+     *
+     * @param color_ 해당 천체 궤적의 색상.
+     *
+     * @return std::size_t 등록된 천체의 인덱스. 실패 시 maxBodies를 반환합니다.
+     */
+    std::size_t AddBody(const glm::vec3& color_) noexcept;
+
+    /**
+     * @brief 등록된 모든 천체의 현재 위치를 궤적에 추가합니다.
+     *
+     * @param positions_ 천체 인덱스 순서의 위치들. 크기는 등록된 천체 수와 같아야 합니다.
+     */
+    void Push(std::span<const glm::vec3> positions_) noexcept;
+
+    /**
+     * @brief 모든 궤적을 비웁니다.
+     */
+    void Clear() noexcept;
+
+    /**
+     * @brief 등록된 모든 천체의 궤적을 렌더링합니다.
+     *
+     * @param shader_ 궤적 전용 셰이더.
+     */
+    void Render(const Shader& shader_) const noexcept;
+
+    /**
+     * @brief 천체 당 저장할 궤적 점의 최대 개수를 반환합니다.
+     *
+     * @return std::size_t 천체 당 저장할 궤적 점의 최대 개수.
+     */
+    [[nodiscard]]
+    inline constexpr std::size_t GetCapacity() const noexcept;
+
+    /**
+     * @brief 등록된 천체의 개수를 반환합니다.
+     *
+     * @return std::size_t 등록된 천체의 개수.
+     */
+    [[nodiscard]]
+    inline constexpr std::size_t GetBodyCount() const noexcept;
+
+    /**
+     * @brief 현재 저장된 궤적 점의 개수를 반환합니다.
+     *
+     * @return std::size_t 현재 저장된 궤적 점의 개수.
+     */
+    [[nodiscard]]
+    inline constexpr std::size_t GetCount() const noexcept;
+
+private:
+    /**
+     * @brief 지정한 슬롯에 스테이징된 점들을 업로드합니다.
+     *
+     * @param slot_ 업로드할 슬롯.
+     */
+    void Upload(std::size_t slot_) const noexcept;
+
+    /**
+     * @brief 궤적 점 버퍼 바인딩 지점.
+     */
+    static constexpr GLuint POINT_BINDING = 0;
+
+    /**
+     * @brief 궤적 색상 버퍼 바인딩 지점.
+     */
+    static constexpr GLuint COLOR_BINDING = 1;
+
+    /**
+     * @brief 빈 정점 배열 객체. (정점 데이터는 셰이더 저장 버퍼에서 가져옵니다.)
+     */
+    GLuint vao;
+
+    /**
+     * @brief 궤적 점 버퍼. (capacity + 1) * maxBodies 개의 점을 보관합니다.
+     *
+     * 마지막 슬롯은 0번 슬롯의 사본으로, 링이 감겨 두 번에 나누어 그릴 때 이음새를 메워줍니다.
+     */
+    GLuint pointBuffer;
+
+    /**
+     * @brief 천체 별 궤적 색상 버퍼.
+     */
+    GLuint colorBuffer;
+
+    /**
+     * @brief 천체 당 저장할 궤적 점의 최대 개수.
+     */
+    std::size_t capacity;
+
+    /**
+     * @brief 등록 가능한 천체의 최대 개수.
+     */
+    std::size_t maxBodies;
+
+    /**
+     * @brief 등록된 천체의 개수.
+     */
+    std::size_t bodyCount;
+
+    /**
+     * @brief 다음에 기록할 슬롯.
+     */
+    std::size_t head;
+
+    /**
+     * @brief 현재 저장된 궤적 점의 개수.
+     */
+    std::size_t count;
+
+    /**
+     * @brief 업로드 전 한 슬롯 분량의 점들을 담는 스테이징 버퍼.
+     */
+    std::vector<glm::vec4> staging;
+};
+
+inline constexpr std::size_t Trail::GetCapacity() const noexcept
+{
+    return capacity;
+}
+
+inline constexpr std::size_t Trail::GetBodyCount() const noexcept
+{
+    return bodyCount;
+}
+
+inline constexpr std::size_t Trail::GetCount() const noexcept
+{
+    return count;
+}
+
+#endif // !GUARD_TRAIL_H
@@ -7,6 +7,7 @@
 #include "Mesh.h"
 #include "Object.h"
 #include "Shader.h"
+#include "ShaderManager.h"
 
 /**
  * @brief 창이 켜질 때 호출됩니다.
@@ -70,10 +71,15 @@ static std::unique_ptr<Camera> camera;
  */
 static std::unique_ptr<Light> light;
 
+/**
+ * @brief 셰이더 관리자.
+ */
+static std::unique_ptr<ShaderManager> shaders;
+
 /**
  * @brief 셰이더.
  */
-static std::unique_ptr<Shader> shader;
+static Shader* shader = nullptr;
 
 /**
  * @brief 큐브 메쉬.
@@ -126,7 +132,14 @@ void OnLoad() noexcept
 	const glm::vec3 lightColor	  = glm::vec3(1.0f, 1.0f, 1.0f);
 	light = std::make_unique<Light>(lightPosition, lightColor);
 
-	shader = std::make_unique<Shader>();
+	shaders = std::make_unique<ShaderManager>("Cache/Shaders");
+
+	shader = shaders->Load("Resources/Shaders/Vertex.vert", "Resources/Shaders/Fragment.frag");
+	if (!shaders->Build())
+	{
+		spdlog::critical("Shader creation failed.");
+		Application::Quit(-1);
+	}
 	shader->Use();
 
 	cubeMesh = std::unique_ptr<Mesh>(Mesh::LoadFrom("Resources/Meshes/Cube.obj"));
@@ -253,7 +266,9 @@ void OnClose() noexcept
 
 	light.reset();
 
-	shader.reset();
+	shader = nullptr;
+
+	shaders.reset();
 
 	for (auto& object : objects)
 	{
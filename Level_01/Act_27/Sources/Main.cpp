@@ -7,6 +7,7 @@
 #include "Mesh.h"
 #include "Object.h"
 #include "Shader.h"
+#include "ShaderManager.h"
 #include "Tank.h"
 
 /**
@@ -41,10 +42,15 @@ static std::unique_ptr<Camera> camera;
  */
 static std::unique_ptr<Light> light;
 
+/**
+ * @brief 셰이더 관리자.
+ */
+static std::unique_ptr<ShaderManager> shaders;
+
 /**
  * @brief 셰이더.
  */
-static std::unique_ptr<Shader> shader;
+static Shader* shader = nullptr;
 
 /**
  * @brief 평면 메쉬.
@@ -87,7 +93,14 @@ void OnLoad() noexcept
 	constexpr glm::vec3 lightColor	  = glm::vec3(1.0f, 1.0f, 1.0f);
 	light = std::make_unique<Light>(lightPosition, lightColor);
 
-	shader = std::make_unique<Shader>();
+	shaders = std::make_unique<ShaderManager>("Cache/Shaders");
+
+	shader = shaders->Load("Resources/Shaders/Vertex.vert", "Resources/Shaders/Fragment.frag");
+	if (!shaders->Build())
+	{
+		spdlog::critical("Shader creation failed.");
+		Application::Quit(-1);
+	}
 	shader->Use();
 
 	planeMesh = std::unique_ptr<Mesh>(Mesh::LoadFrom("Resources/Meshes/Plane.obj"));
@@ -243,7 +256,9 @@ void OnClose() noexcept
 
 	light.reset();
 
-	shader.reset();
+	shader = nullptr;
+
+	shaders.reset();
 
 	objects.clear();
 }
\ No newline at end of file
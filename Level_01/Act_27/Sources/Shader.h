@@ -9,11 +9,13 @@
  */
 class Shader final
 {
+    friend class ShaderManager;
+
 public:
     /**
-     * @brief 생성자.
+     * @brief 생성자. 프로그램은 ShaderManager가 빌드합니다.
      */
-    explicit Shader() noexcept;
+    explicit Shader() noexcept = default;
 
     /**
      * @brief 소멸자.
@@ -0,0 +1,348 @@
+﻿#include "ShaderManager.h"
+
+/**
+ * @brief 프로그램 바이너리 캐시 파일의 헤더. 헤더 뒤에는 glGetProgramBinary가 반환한 바이너리가 이어집니다.
+ */
+struct ProgramCacheHeader final
+{
+    /**
+     * @brief 파일 식별자.
+     */
+    char magic[4];
+
+    /**
+     * @brief 캐시 형식 버전.
+     */
+    std::uint32_t version;
+
+    /**
+     * @brief 드라이버가 반환한 바이너리 형식.
+     */
+    std::uint32_t format;
+
+    /**
+     * @brief 바이너리의 바이트 크기.
+     */
+    std::uint32_t size;
+};
+
+/**
+ * @brief 프로그램 바이너리 캐시 파일 식별자.
+ */
+static constexpr char PROGRAM_CACHE_MAGIC[4] = { 'P', 'R', 'G', 'B' };
+
+/**
+ * @brief 프로그램 바이너리 캐시 형식 버전.
+ */
+static constexpr std::uint32_t PROGRAM_CACHE_VERSION = 1;
+
+ShaderManager::ShaderManager(const std::filesystem::path& cacheDirectory_) noexcept
+    : cacheDirectory(cacheDirectory_)
+    , isBinarySupported(false)
+    , isParallelSupported(false)
+{
+    std::error_code error;
+    std::filesystem::create_directories(cacheDirectory, error);
+    if (error)
+    {
+        spdlog::warn("Failed to create shader cache directory: {}", cacheDirectory.string());
+    }
+
+    // 드라이버가 바뀌면 바이너리를 다시 만들어야 하므로 드라이버 문자열을 캐시 키에 포함합니다.
+    const auto getString = [] (const GLenum name_) -> std::string_view
+    {
+        const GLubyte* const value = glGetString(name_);
+        return value != nullptr ? reinterpret_cast<const char*>(value) : "";
+    };
+    driver = std::format("{}|{}|{}", getString(GL_VENDOR), getString(GL_RENDERER), getString(GL_VERSION));
+
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    isBinarySupported = formatCount > 0;
+    if (!isBinarySupported)
+    {
+        spdlog::warn("Program binaries are not supported. Shaders will be compiled at every start.");
+    }
+
+    // 드라이버가 허용하는 만큼의 컴파일러 스레드를 사용합니다.
+    isParallelSupported = glfwExtensionSupported("GL_KHR_parallel_shader_compile") == GLFW_TRUE;
+    if (isParallelSupported)
+    {
+        using MaxShaderCompilerThreads = void (APIENTRY*)(GLuint);
+
+        const auto maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreads>(glfwGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+        if (maxShaderCompilerThreads != nullptr)
+        {
+            maxShaderCompilerThreads(std::numeric_limits<GLuint>::max());
+        }
+    }
+}
+
+Shader* ShaderManager::Load(const std::filesystem::path& vertex_,
+                            const std::filesystem::path& fragment_) noexcept
+{
+    Shader* const shader = shaders.emplace_back(std::make_unique<Shader>()).get();
+
+    Pending pending;
+    pending.shader       = shader;
+    pending.vertexPath   = vertex_;
+    pending.fragmentPath = fragment_;
+    pendings.push_back(std::move(pending));
+
+    return shader;
+}
+
+bool ShaderManager::Build() noexcept
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto toMilliseconds = [] (const Clock::duration duration_) -> double
+    {
+        return std::chrono::duration<double, std::milli>(duration_).count();
+    };
+
+    const Clock::time_point start       = Clock::now();
+    bool                    isSucceeded = true;
+    std::size_t             cachedCount = 0;
+    std::vector<Pending*>   misses;
+
+    // 1. 소스를 읽고, 캐시된 바이너리가 있다면 컴파일 없이 그대로 사용합니다.
+    for (Pending& pending : pendings)
+    {
+        pending.vertexSource   = ReadFile(pending.vertexPath);
+        pending.fragmentSource = ReadFile(pending.fragmentPath);
+        if (pending.vertexSource.empty() || pending.fragmentSource.empty())
+        {
+            isSucceeded = false;
+            continue;
+        }
+
+        std::string key = driver;
+        key += '\0';
+        key += pending.vertexSource;
+        key += '\0';
+        key += pending.fragmentSource;
+
+        pending.cachePath = cacheDirectory / std::format("{:016x}.bin", std::hash<std::string>{}(key));
+
+        if (isBinarySupported)
+        {
+            if (const GLuint programID = LoadBinary(pending.cachePath); programID != 0)
+            {
+                pending.shader->programID = programID;
+                ++cachedCount;
+                continue;
+            }
+        }
+
+        misses.push_back(&pending);
+    }
+
+    const Clock::time_point loaded = Clock::now();
+
+    // 2. 모든 컴파일과 링크를 먼저 요청하고 나서 결과를 확인해야 드라이버가 병렬로 처리할 수 있습니다.
+    for (Pending* const pending : misses)
+    {
+        pending->vertexID   = Compile(GL_VERTEX_SHADER,   pending->vertexSource);
+        pending->fragmentID = Compile(GL_FRAGMENT_SHADER, pending->fragmentSource);
+    }
+
+    for (Pending* const pending : misses)
+    {
+        const GLuint programID = glCreateProgram();
+        glAttachShader(programID, pending->vertexID);
+        glAttachShader(programID, pending->fragmentID);
+        if (isBinarySupported)
+        {
+            glProgramParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        glLinkProgram(programID);
+
+        pending->shader->programID = programID;
+    }
+
+    for (Pending* const pending : misses)
+    {
+        GLuint& programID = pending->shader->programID;
+
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(programID, GL_LINK_STATUS, &linkStatus);
+        if (linkStatus != GL_TRUE)
+        {
+            // 링크 실패의 원인은 대부분 컴파일 오류이므로 셰이더 로그부터 출력합니다.
+            const bool isVertexCompiled   = CheckShader(pending->vertexID,   pending->vertexPath);
+            const bool isFragmentCompiled = CheckShader(pending->fragmentID, pending->fragmentPath);
+            if (isVertexCompiled && isFragmentCompiled)
+            {
+                GLint length = 0;
+                glGetProgramiv(programID, GL_INFO_LOG_LENGTH, &length);
+
+                std::string infoLog(static_cast<std::size_t>(std::max(length, 1)), '\0');
+                glGetProgramInfoLog(programID, static_cast<GLsizei>(infoLog.size()), nullptr, infoLog.data());
+                spdlog::error("Shader link failed ({}, {}):\n{}", pending->vertexPath.string(), pending->fragmentPath.string(), infoLog.c_str());
+            }
+
+            glDeleteProgram(programID);
+            programID   = 0;
+            isSucceeded = false;
+        }
+
+        glDeleteShader(pending->vertexID);
+        glDeleteShader(pending->fragmentID);
+    }
+
+    const Clock::time_point compiled = Clock::now();
+
+    // 3. 새로 링크한 프로그램의 바이너리를 다음 실행을 위해 기록합니다.
+    if (isBinarySupported)
+    {
+        for (const Pending* const pending : misses)
+        {
+            if (pending->shader->programID != 0)
+            {
+                SaveBinary(pending->shader->programID, pending->cachePath);
+            }
+        }
+    }
+
+    const Clock::time_point saved = Clock::now();
+
+    spdlog::info("Shader build: {} programs ({} cached, {} compiled{}) in {:.2f} ms [load {:.2f} ms, compile/link {:.2f} ms, save {:.2f} ms]",
+                 pendings.size(),
+                 cachedCount,
+                 misses.size(),
+                 isParallelSupported ? ", parallel" : "",
+                 toMilliseconds(saved - start),
+                 toMilliseconds(loaded - start),
+                 toMilliseconds(compiled - loaded),
+                 toMilliseconds(saved - compiled));
+
+    pendings.clear();
+
+    return isSucceeded;
+}
+
+GLuint ShaderManager::LoadBinary(const std::filesystem::path& cachePath_) noexcept
+{
+    std::ifstream ifs(cachePath_, std::ios::binary);
+    if (!ifs.is_open())
+    {
+        return 0;
+    }
+
+    ProgramCacheHeader header;
+    if (!ifs.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, PROGRAM_CACHE_MAGIC, sizeof(PROGRAM_CACHE_MAGIC)) != 0 ||
+        header.version != PROGRAM_CACHE_VERSION)
+    {
+        return 0;
+    }
+
+    std::vector<char> binary(header.size);
+    if (!ifs.read(binary.data(), static_cast<std::streamsize>(binary.size())))
+    {
+        return 0;
+    }
+
+    // 드라이버가 갱신되어 바이너리를 거부할 수도 있으므로 링크 상태를 확인합니다.
+    const GLuint programID = glCreateProgram();
+    glProgramBinary(programID, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(programID, GL_LINK_STATUS, &linkStatus);
+    if (linkStatus != GL_TRUE)
+    {
+        glDeleteProgram(programID);
+        return 0;
+    }
+
+    return programID;
+}
+
+void ShaderManager::SaveBinary(const GLuint                 programID_,
+                               const std::filesystem::path& cachePath_) noexcept
+{
+    GLint length = 0;
+    glGetProgramiv(programID_, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        return;
+    }
+
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum            format = 0;
+    glGetProgramBinary(programID_, length, nullptr, &format, binary.data());
+
+    ProgramCacheHeader header = { };
+    std::memcpy(header.magic, PROGRAM_CACHE_MAGIC, sizeof(PROGRAM_CACHE_MAGIC));
+    header.version = PROGRAM_CACHE_VERSION;
+    header.format  = format;
+    header.size    = static_cast<std::uint32_t>(binary.size());
+
+    std::filesystem::path temporaryPath = cachePath_;
+    temporaryPath += ".tmp";
+
+    std::ofstream ofs(temporaryPath, std::ios::binary | std::ios::trunc);
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofs.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+    ofs.close();
+
+    std::error_code error;
+    if (ofs)
+    {
+        std::filesystem::rename(temporaryPath, cachePath_, error);
+    }
+
+    if (!ofs || error)
+    {
+        spdlog::warn("Failed to write shader cache: {}", cachePath_.string());
+        std::filesystem::remove(temporaryPath, error);
+    }
+}
+
+GLuint ShaderManager::Compile(const GLenum       type_,
+                              const std::string& source_) noexcept
+{
+    const GLchar* const source = source_.c_str();
+
+    const GLuint shaderID = glCreateShader(type_);
+    glShaderSource(shaderID, 1, &source, nullptr);
+    glCompileShader(shaderID);
+
+    return shaderID;
+}
+
+bool ShaderManager::CheckShader(const GLuint                 shaderID_,
+                                const std::filesystem::path& path_) noexcept
+{
+    GLint compileStatus = GL_FALSE;
+    glGetShaderiv(shaderID_, GL_COMPILE_STATUS, &compileStatus);
+    if (compileStatus == GL_TRUE)
+    {
+        return true;
+    }
+
+    GLint length = 0;
+    glGetShaderiv(shaderID_, GL_INFO_LOG_LENGTH, &length);
+
+    std::string infoLog(static_cast<std::size_t>(std::max(length, 1)), '\0');
+    glGetShaderInfoLog(shaderID_, static_cast<GLsizei>(infoLog.size()), nullptr, infoLog.data());
+    spdlog::error("Shader compile failed ({}):\n{}", path_.string(), infoLog.c_str());
+
+    return false;
+}
+
+std::string ShaderManager::ReadFile(const std::filesystem::path& path_) noexcept
+{
+    std::ifstream ifs(path_, std::ios::binary);
+    if (!ifs.is_open())
+    {
+        spdlog::error("Failed to open shader: {}", path_.string());
+        return "";
+    }
+
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+
+    return buffer.str();
+}
@@ -5,6 +5,7 @@ layout(location = 1) in vec3 aNormal;
 layout(location = 2) in vec2 aTexCoord;
 
 uniform mat4 uModel;
+uniform mat3 uNormalMatrix; // CPU에서 계산한 transpose(inverse(mat3(uModel)))
 uniform mat4 uView;
 uniform mat4 uProjection;
 
@@ -20,8 +21,7 @@ void main()
     vFragPos = vec3(uModel * vec4(aPosition, 1.0));
 
     // [추가] 법선 벡터 변환 (회전/크기 적용)
-    // 역행렬 계산은 비용이 크므로, 추후엔 CPU에서 NormalMatrix를 넘겨주는 것이 좋습니다.
-    vNormal = mat3(transpose(inverse(uModel))) * aNormal;
+    vNormal = uNormalMatrix * aNormal;
 
-    gl_Position = uProjection * uView * uModel * vec4(aPosition, 1.0);
+    gl_Position = uProjection * uView * vec4(vFragPos, 1.0);
 }
\ No newline at end of file
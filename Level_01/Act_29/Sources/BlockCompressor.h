@@ -0,0 +1,135 @@
+﻿#pragma once
+
+#include "PCH.h"
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+/**
+ * @class BlockCompressor
+ *
+ * @brief RGBA8 이미지를 4x4 블록 단위의 BC1/BC3 압축 형식으로 인코딩합니다.
+ *
+ * 블록 행들을 여러 스레드에 나누어 인코딩하며, 블록 내 16개 픽셀의 인덱스 선택은 SSE로 4개씩 처리합니다.
+ */
+class BlockCompressor final
+{
+public:
+    /**
+     * @brief 압축 형식을 정의합니다.
+     */
+    enum class Format : unsigned char
+    {
+        /**
+         * @brief 불투명 색상. 블록 당 8바이트. (RGBA8 대비 1/8)
+         */
+        BC1,
+
+        /**
+         * @brief 보간 알파를 포함한 색상. 블록 당 16바이트. (RGBA8 대비 1/4)
+         */
+        BC3,
+    };
+
+    /**
+     * @brief 인코딩 품질과 속도의 균형을 정의합니다.
+     */
+    enum class Quality : unsigned char
+    {
+        /**
+         * @brief 색상 경계 상자의 양 끝을 끝점으로 사용합니다.
+         */
+        Fast,
+
+        /**
+         * @brief 색상 분포의 주축을 따라 끝점을 고릅니다.
+         */
+        Normal,
+
+        /**
+         * @brief 주축으로 고른 끝점을 최소 제곱법으로 반복 보정합니다.
+         */
+        High,
+    };
+
+    /**
+     * @brief 지정한 크기의 이미지를 압축했을 때의 바이트 크기를 반환합니다.
+     *
+     * @param format_ 압축 형식.
+     * @param width_  이미지 너비.
+     * @param height_ 이미지 높이.
+     *
+     * @return std::size_t 압축된 바이트 크기.
+     */
+    [[nodiscard]]
+    static std::size_t ComputeSize(const Format format_, const int width_, const int height_) noexcept;
+
+    /**
+     * @brief 압축 형식에 대응하는 OpenGL 내부 형식을 반환합니다.
+     *
+     * @param format_ 압축 형식.
+     *
+     * @return GLenum OpenGL 내부 형식.
+     */
+    [[nodiscard]]
+    static GLenum ToInternalFormat(const Format format_) noexcept;
+
+    /**
+     * @brief 이미지를 압축합니다.
+     *
+     * @param pixels_      RGBA8 픽셀. (행 우선, 빽빽하게 배치)
+     * @param width_       이미지 너비.
+     * @param height_      이미지 높이.
+     * @param format_      압축 형식.
+     * @param quality_     인코딩 품질.
+     * @param output_      압축된 블록을 기록할 버퍼. ComputeSize 만큼의 크기가 필요합니다.
+     * @param threadCount_ 사용할 스레드 개수. 0이면 하드웨어 스레드 개수를 사용합니다.
+     */
+    static void Compress(const std::byte* pixels_,
+                         const int        width_,
+                         const int        height_,
+                         const Format     format_,
+                         const Quality    quality_,
+                         std::byte*       output_,
+                         unsigned int     threadCount_ = 0) noexcept;
+
+    /**
+     * @brief 품질 별, 스레드 개수 별 인코딩 처리량(MP/s)을 측정하여 로그로 남깁니다.
+     */
+    static void Benchmark() noexcept;
+
+private:
+    /**
+     * @brief 지정한 블록 행 범위를 압축합니다.
+     */
+    static void CompressRows(const std::byte* pixels_,
+                             const int        width_,
+                             const int        height_,
+                             const Format     format_,
+                             const Quality    quality_,
+                             std::byte*       output_,
+                             const int        firstRow_,
+                             const int        lastRow_) noexcept;
+
+    /**
+     * @brief 4x4 블록의 색상을 BC1 블록(8바이트)으로 인코딩합니다.
+     *
+     * @param block_   블록의 RGBA8 픽셀 16개.
+     * @param quality_ 인코딩 품질.
+     * @param output_  기록할 위치.
+     */
+    static void EncodeColor(const std::uint8_t (&block_)[64], const Quality quality_, std::byte* output_) noexcept;
+
+    /**
+     * @brief 4x4 블록의 알파를 BC3 알파 블록(8바이트)으로 인코딩합니다.
+     *
+     * @param block_  블록의 RGBA8 픽셀 16개.
+     * @param output_ 기록할 위치.
+     */
+    static void EncodeAlpha(const std::uint8_t (&block_)[64], std::byte* output_) noexcept;
+};
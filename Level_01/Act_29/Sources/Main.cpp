@@ -7,7 +7,8 @@
 #include "Mesh.h"
 #include "Object.h"
 #include "Shader.h"
-#include "Texture.h"
+#include "ShaderManager.h"
+#include "TextureManager.h"
 
 /**
  * @brief 창이 켜질 때 호출됩니다.
@@ -42,9 +43,9 @@ static std::unique_ptr<Camera> camera;
 static std::unique_ptr<Light> light;
 
 /**
- * @brief 사용할 셰이더.
+ * @brief 셰이더 관리자.
  */
-static std::vector<std::unique_ptr<Shader>> shader;
+static std::unique_ptr<ShaderManager> shaders;
 
 /**
  * @brief 표준 셰이더.
@@ -72,19 +73,19 @@ static Mesh* cubeMesh = nullptr;
 static Mesh* pyramidMesh = nullptr;
 
 /**
- * @brief 사용할 텍스처들.
+ * @brief 텍스처 매니저.
  */
-static std::vector<std::unique_ptr<Texture>> textures;
+static std::unique_ptr<TextureManager> textures;
 
 /**
  * @brief 큐브 텍스처.
  */
-static Texture* cubeTexture = nullptr;
+static TextureManager::Handle cubeTexture;
 
 /**
  * @brief 피라미드 텍스처.
  */
-static Texture* pyramidTexture = nullptr;
+static TextureManager::Handle pyramidTexture;
 
 /**
  * @brief 시뮬레이션 할 오브젝트들.
@@ -132,19 +133,13 @@ void OnLoad() noexcept
 	constexpr glm::vec3 lightColor    = glm::vec3(1.0f, 1.0f, 1.0f);
 	light = std::make_unique<Light>(lightPosition, lightColor);
 
-	standardShader = shader.emplace_back(std::make_unique<Shader>("Resources/Shaders/Standard.vert",
-																  "Resources/Shaders/Standard.frag")).get();
-	if (!standardShader)
-	{
-		spdlog::critical("Standard shader creation failed.");
-		Application::Quit(-1);
-	}
+	shaders = std::make_unique<ShaderManager>("Cache/Shaders");
 
-	textureShader = shader.emplace_back(std::make_unique<Shader>("Resources/Shaders/Texture.vert",
-																 "Resources/Shaders/Texture.frag")).get();
-	if (!textureShader)
+	standardShader = shaders->Load("Resources/Shaders/Standard.vert", "Resources/Shaders/Standard.frag");
+	textureShader  = shaders->Load("Resources/Shaders/Texture.vert",  "Resources/Shaders/Texture.frag");
+	if (!shaders->Build())
 	{
-		spdlog::critical("Texture shader creation failed.");
+		spdlog::critical("Shader creation failed.");
 		Application::Quit(-1);
 	}
 
@@ -162,25 +157,31 @@ void OnLoad() noexcept
 		Application::Quit(-1);
 	}
 
-	cubeTexture = textures.emplace_back(Texture::LoadFrom("Resources/Textures/Texture.png")).get();
-	if (!cubeTexture)
+	textures = std::make_unique<TextureManager>("Cache/Textures");
+
+	// 같은 경로는 같은 핸들을 돌려받으므로 큐브와 피라미드는 한 텍스처를 공유합니다.
+	cubeTexture = textures->Load("Resources/Textures/Texture.png");
+	if (!cubeTexture.IsValid())
 	{
 		spdlog::critical("Cube texture load failed.");
 		Application::Quit(-1);
 	}
 
-	pyramidTexture = textures.emplace_back(Texture::LoadFrom("Resources/Textures/Texture.png")).get();
-	if (!pyramidTexture)
+	pyramidTexture = textures->Load("Resources/Textures/Texture.png");
+	if (!pyramidTexture.IsValid())
 	{
 		spdlog::critical("Pyramid texture load failed.");
 		Application::Quit(-1);
 	}
 
-	cube = objects.emplace_back(std::make_unique<Object>(cubeMesh, cubeTexture)).get();
+	cube = objects.emplace_back(std::make_unique<Object>(cubeMesh, textures.get(), cubeTexture)).get();
 	cube->SetPosition(glm::vec3(0.0f, 0.0f, 0.0f));
 
-	pyramid = objects.emplace_back(std::make_unique<Object>(pyramidMesh, pyramidTexture)).get();
+	pyramid = objects.emplace_back(std::make_unique<Object>(pyramidMesh, textures.get(), pyramidTexture)).get();
 	pyramid->SetPosition(glm::vec3(0.0f, 0.0f, 0.0f));
+
+	// 디코딩은 백그라운드에서 진행되었으므로 첫 프레임 전에 업로드만 마무리합니다.
+	textures->Wait();
 }
 
 static bool trigger = false;
@@ -194,6 +195,8 @@ void OnTick(const float deltaTime_) noexcept
 		Application::Quit(0);
 	}
 
+	textures->Update();
+
 	if (Input::IsKeyPressed(GLFW_KEY_C))
 		trigger = false;
 
@@ -232,4 +235,8 @@ void OnClose() noexcept
 	light.reset();
 
 	objects.clear();
+
+	textures.reset();
+
+	shaders.reset();
 }
\ No newline at end of file
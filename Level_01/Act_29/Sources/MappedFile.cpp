@@ -0,0 +1,85 @@
+﻿#include "MappedFile.h"
+
+MappedFile::MappedFile(const std::filesystem::path& path_) noexcept
+{
+    file = CreateFileW(path_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        Close();
+        return;
+    }
+
+    mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        Close();
+        return;
+    }
+
+    data = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data == nullptr)
+    {
+        Close();
+        return;
+    }
+
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+}
+
+MappedFile::~MappedFile() noexcept
+{
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other_) noexcept
+    : file(std::exchange(other_.file, INVALID_HANDLE_VALUE))
+    , mapping(std::exchange(other_.mapping, nullptr))
+    , data(std::exchange(other_.data, nullptr))
+    , size(std::exchange(other_.size, 0))
+{
+
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other_) noexcept
+{
+    if (this != &other_)
+    {
+        Close();
+
+        file    = std::exchange(other_.file, INVALID_HANDLE_VALUE);
+        mapping = std::exchange(other_.mapping, nullptr);
+        data    = std::exchange(other_.data, nullptr);
+        size    = std::exchange(other_.size, 0);
+    }
+
+    return *this;
+}
+
+void MappedFile::Close() noexcept
+{
+    if (data != nullptr)
+    {
+        UnmapViewOfFile(data);
+        data = nullptr;
+    }
+
+    if (mapping != nullptr)
+    {
+        CloseHandle(mapping);
+        mapping = nullptr;
+    }
+
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(file);
+        file = INVALID_HANDLE_VALUE;
+    }
+
+    size = 0;
+}
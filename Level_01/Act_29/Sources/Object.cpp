@@ -3,10 +3,11 @@
 #include "Input.h"
 
 #include "Mesh.h"
-#include "Texture.h"
+#include "NormalMatrix.h"
 
-Object::Object(Mesh* mesh_, Texture* texture_) noexcept
+Object::Object(Mesh* mesh_, TextureManager* textures_, const TextureManager::Handle texture_) noexcept
     : mesh(mesh_)
+    , textures(textures_)
     , texture(texture_)
 {
 
@@ -30,23 +31,18 @@ void Object::Update(const float deltaTime_) noexcept
 
 void Object::Render(const Shader& shader_) const noexcept
 {
-    shader_.SetUniformMatrix4x4("uModel", GetModelMatrix());
-
-    // 2. 텍스쳐가 있다면 바인딩
-    if (texture)
+    // 1. 법선 행렬은 정점마다 역행렬을 구하지 않도록 객체 당 한 번 CPU에서 계산합니다.
+    const glm::mat4 model = GetModelMatrix();
+    shader_.SetUniformMatrix4x4("uModel", model);
+    shader_.SetUniformMatrix3x3("uNormalMatrix", NormalMatrix::Compute(model, IsUniformScale()));
+
+    // 2. 텍스쳐가 있다면 레이어 선택 (같은 텍스처 배열이 이미 바인딩되어 있다면 레이어 인덱스만 바뀜)
+    // Standard 셰이더는 이 유니폼들이 없으므로 무시됨(또는 위치 -1 반환)
+    if (textures && texture.IsValid())
     {
-        texture->Bind(0); // 0번 슬롯에 바인딩
-        // 셰이더의 샘플러(uTexture)에게 0번 슬롯을 사용하라고 알림 (Texture 셰이더일 경우)
-        // Standard 셰이더는 이 유니폼이 없으므로 무시됨(또는 위치 -1 반환)
-        shader_.SetUniformInt("uTexture", 0);
+        textures->Bind(texture, shader_);
     }
 
     // 3. 메쉬 그리기
     mesh->Render();
-
-    // 4. 언바인딩 (선택사항, 안전을 위해)
-    if (texture)
-    {
-        texture->Unbind();
-    }
 }
\ No newline at end of file
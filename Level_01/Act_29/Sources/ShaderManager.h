@@ -0,0 +1,178 @@
+﻿#pragma once
+
+#include "PCH.h"
+
+#include "Shader.h"
+
+/**
+ * @class ShaderManager
+ *
+ * @brief 셰이더 프로그램들을 한 번에 빌드하고, 링크된 프로그램 바이너리를 디스크에 캐싱합니다.
+ *
+ * 캐시 키는 셰이더 소스와 드라이버 문자열(제조사, 렌더러, 버전)의 해시입니다.
+ * 캐시에 없는 프로그램은 모든 셰이더의 컴파일과 링크를 먼저 요청한 뒤 결과를 확인하므로,
+ * GL_KHR_parallel_shader_compile을 지원하는 드라이버에서는 여러 프로그램이 병렬로 컴파일됩니다.
+ */
+class ShaderManager final
+{
+public:
+    /**
+     * @brief 생성자.
+     *
+     * @param cacheDirectory_ 프로그램 바이너리 캐시를 저장할 디렉터리.
+     */
+    explicit ShaderManager(const std::filesystem::path& cacheDirectory_) noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~ShaderManager() noexcept = default;
+
+    ShaderManager(const ShaderManager&) = delete;
+    ShaderManager& operator=(const ShaderManager&) = delete;
+
+    /**
+     * @brief 셰이더 프로그램을 빌드 목록에 추가합니다. 프로그램은 Build 호출 시 생성됩니다.
+     *
+     * @param vertex_   버텍스 셰이더 파일 경로.
+     * @param fragment_ 프래그먼트 셰이더 파일 경로.
+     *
+     * @return Shader* 셰이더. 관리자가 소유하며 Build 이후에 사용할 수 있습니다.
+     */
+    Shader* Load(const std::filesystem::path& vertex_,
+                 const std::filesystem::path& fragment_) noexcept;
+
+    /**
+     * @brief 추가된 모든 셰이더 프로그램을 캐시에서 불러오거나 컴파일합니다.
+     *
+     * @return bool 모든 프로그램이 준비되었다면 true.
+     */
+    bool Build() noexcept;
+
+private:
+    /**
+     * @struct Pending
+     *
+     * @brief 빌드를 기다리는 셰이더 프로그램.
+     */
+    struct Pending
+    {
+        /**
+         * @brief 결과를 받을 셰이더.
+         */
+        Shader* shader = nullptr;
+
+        /**
+         * @brief 버텍스 셰이더 파일 경로.
+         */
+        std::filesystem::path vertexPath;
+
+        /**
+         * @brief 프래그먼트 셰이더 파일 경로.
+         */
+        std::filesystem::path fragmentPath;
+
+        /**
+         * @brief 버텍스 셰이더 소스.
+         */
+        std::string vertexSource;
+
+        /**
+         * @brief 프래그먼트 셰이더 소스.
+         */
+        std::string fragmentSource;
+
+        /**
+         * @brief 캐시 파일 경로.
+         */
+        std::filesystem::path cachePath;
+
+        /**
+         * @brief 컴파일 중인 버텍스 셰이더 ID.
+         */
+        GLuint vertexID = 0;
+
+        /**
+         * @brief 컴파일 중인 프래그먼트 셰이더 ID.
+         */
+        GLuint fragmentID = 0;
+    };
+
+    /**
+     * @brief 캐시 파일에서 프로그램 바이너리를 불러옵니다.
+     *
+     * @param cachePath_ 캐시 파일 경로.
+     *
+     * @return GLuint 프로그램 ID. 캐시가 없거나 드라이버가 거부하면 0.
+     */
+    [[nodiscard]]
+    static GLuint LoadBinary(const std::filesystem::path& cachePath_) noexcept;
+
+    /**
+     * @brief 링크된 프로그램의 바이너리를 캐시 파일에 기록합니다.
+     *
+     * @param programID_ 프로그램 ID.
+     * @param cachePath_ 캐시 파일 경로.
+     */
+    static void SaveBinary(const GLuint                 programID_,
+                           const std::filesystem::path& cachePath_) noexcept;
+
+    /**
+     * @brief 셰이더를 생성하고 컴파일을 요청합니다. (결과는 확인하지 않습니다)
+     *
+     * @param type_   셰이더 타입.
+     * @param source_ 셰이더 소스.
+     *
+     * @return GLuint 셰이더 ID.
+     */
+    [[nodiscard]]
+    static GLuint Compile(const GLenum       type_,
+                          const std::string& source_) noexcept;
+
+    /**
+     * @brief 셰이더의 컴파일 결과를 확인하고 실패 시 로그를 출력합니다.
+     *
+     * @param shaderID_ 셰이더 ID.
+     * @param path_     셰이더 파일 경로.
+     *
+     * @return bool 컴파일에 성공했다면 true.
+     */
+    static bool CheckShader(const GLuint                 shaderID_,
+                            const std::filesystem::path& path_) noexcept;
+
+    /**
+     * @brief 파일 전체를 문자열로 읽습니다.
+     */
+    [[nodiscard]]
+    static std::string ReadFile(const std::filesystem::path& path_) noexcept;
+
+    /**
+     * @brief 프로그램 바이너리 캐시 디렉터리.
+     */
+    std::filesystem::path cacheDirectory;
+
+    /**
+     * @brief 캐시 키에 포함되는 드라이버 문자열.
+     */
+    std::string driver;
+
+    /**
+     * @brief 드라이버가 프로그램 바이너리를 지원하는지 여부.
+     */
+    bool isBinarySupported;
+
+    /**
+     * @brief 드라이버가 GL_KHR_parallel_shader_compile을 지원하는지 여부.
+     */
+    bool isParallelSupported;
+
+    /**
+     * @brief 관리 중인 셰이더들.
+     */
+    std::vector<std::unique_ptr<Shader>> shaders;
+
+    /**
+     * @brief 빌드를 기다리는 셰이더 프로그램들.
+     */
+    std::vector<Pending> pendings;
+};
@@ -0,0 +1,522 @@
+﻿#include "TextureManager.h"
+
+#include "Shader.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+/**
+ * @brief 밉 체인 캐시 파일의 헤더. 헤더 뒤에는 모든 밉 레벨의 픽셀(또는 압축 블록)이 0번 레벨부터 이어집니다.
+ */
+struct MipCacheHeader final
+{
+    /**
+     * @brief 파일 식별자.
+     */
+    char magic[4];
+
+    /**
+     * @brief 캐시 형식 버전.
+     */
+    std::uint32_t version;
+
+    /**
+     * @brief 0번 레벨의 너비.
+     */
+    std::int32_t width;
+
+    /**
+     * @brief 0번 레벨의 높이.
+     */
+    std::int32_t height;
+
+    /**
+     * @brief 밉 레벨 개수.
+     */
+    std::int32_t levels;
+
+    /**
+     * @brief 픽셀 데이터의 OpenGL 내부 형식.
+     */
+    std::uint32_t format;
+
+    /**
+     * @brief 블록 압축 품질.
+     */
+    std::uint32_t quality;
+
+    /**
+     * @brief 정렬을 위한 예약 공간.
+     */
+    std::uint32_t reserved;
+
+    /**
+     * @brief 캐시 생성 당시 원본 파일의 크기.
+     */
+    std::uint64_t sourceSize;
+
+    /**
+     * @brief 캐시 생성 당시 원본 파일의 수정 시각.
+     */
+    std::int64_t sourceTime;
+};
+
+/**
+ * @brief 밉 체인 캐시 파일 식별자.
+ */
+static constexpr char MIP_CACHE_MAGIC[4] = { 'M', 'I', 'P', 'C' };
+
+/**
+ * @brief 밉 체인 캐시 형식 버전.
+ */
+static constexpr std::uint32_t MIP_CACHE_VERSION = 2;
+
+TextureManager::TextureManager(const std::filesystem::path& cacheDirectory_,
+                               const BlockCompressor::Quality quality_) noexcept
+    : cacheDirectory(cacheDirectory_)
+    , quality(quality_)
+    , isCompressionSupported(false)
+    , boundArray(0)
+{
+    // S3TC는 코어 기능이 아니므로 드라이버가 지원하는 압축 형식 목록에서 확인합니다.
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &formatCount);
+
+    std::vector<GLint> formats(static_cast<std::size_t>(std::max(formatCount, 0)));
+    if (!formats.empty())
+    {
+        glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data());
+    }
+
+    isCompressionSupported = std::ranges::find(formats, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT) != formats.end() &&
+                             std::ranges::find(formats, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT) != formats.end();
+    if (!isCompressionSupported)
+    {
+        spdlog::warn("S3TC texture compression is not supported. Textures will be uploaded as RGBA8.");
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(cacheDirectory, error);
+    if (error)
+    {
+        spdlog::warn("Failed to create texture cache directory: {}", cacheDirectory.string());
+    }
+}
+
+TextureManager::~TextureManager() noexcept
+{
+    for (Entry& entry : entries)
+    {
+        if (entry.pending.valid())
+        {
+            entry.pending.wait();
+        }
+    }
+
+    for (const TextureArray& array : arrays)
+    {
+        glDeleteTextures(1, &array.id);
+    }
+}
+
+TextureManager::Handle TextureManager::Load(const std::string& path_) noexcept
+{
+    if (const auto iter = lookup.find(path_); iter != lookup.end())
+    {
+        return { iter->second };
+    }
+
+    // 레이어 배정에 필요한 크기만 헤더에서 읽고, 픽셀은 백그라운드에서 준비합니다.
+    int width    = 0;
+    int height   = 0;
+    int channels = 0;
+    if (!stbi_info(path_.c_str(), &width, &height, &channels))
+    {
+        spdlog::error("Failed to load texture: {}", path_);
+        return {};
+    }
+
+    // 알파 채널이 있는 이미지(회색+알파, RGBA)는 BC3, 없는 이미지는 BC1으로 압축합니다.
+    // 디코딩은 항상 4채널로 펼치므로 회색+알파를 BC1으로 보내면 알파가 사라집니다.
+    GLenum format = GL_RGBA8;
+    if (isCompressionSupported)
+    {
+        const bool hasAlpha = channels == 2 || channels == 4;
+        format = BlockCompressor::ToInternalFormat(hasAlpha ? BlockCompressor::Format::BC3 : BlockCompressor::Format::BC1);
+    }
+
+    Entry entry;
+    entry.array = AcquireArray(width, height, format);
+    entry.layer = arrays[entry.array].layerCount++;
+
+    const std::filesystem::path cachePath = cacheDirectory / std::format("{:016x}.mips", std::hash<std::string>{}(path_));
+    entry.pending = std::async(std::launch::async, &TextureManager::Prepare, std::filesystem::path(path_), cachePath, format, quality);
+
+    const std::uint32_t index = static_cast<std::uint32_t>(entries.size());
+    entries.push_back(std::move(entry));
+    lookup.emplace(path_, index);
+
+    return { index };
+}
+
+void TextureManager::Update() noexcept
+{
+    for (Entry& entry : entries)
+    {
+        if (!entry.pending.valid() ||
+            entry.pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            continue;
+        }
+
+        const MipChain chain = entry.pending.get();
+        if (chain.data != nullptr)
+        {
+            Upload(entry, chain);
+        }
+    }
+}
+
+void TextureManager::Wait() noexcept
+{
+    for (Entry& entry : entries)
+    {
+        if (entry.pending.valid())
+        {
+            entry.pending.wait();
+        }
+    }
+
+    Update();
+}
+
+void TextureManager::Bind(const Handle handle_, const Shader& shader_) noexcept
+{
+    if (!handle_.IsValid() || handle_.index >= entries.size())
+    {
+        return;
+    }
+
+    const Entry& entry = entries[handle_.index];
+    const GLuint id    = arrays[entry.array].id;
+
+    if (boundArray != id)
+    {
+        glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+        boundArray = id;
+    }
+
+    shader_.SetUniformInt("uTexture", TEXTURE_UNIT);
+    shader_.SetUniformInt("uLayer", static_cast<int>(entry.layer));
+}
+
+void TextureManager::Unbind() noexcept
+{
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    boundArray = 0;
+}
+
+std::uint32_t TextureManager::AcquireArray(const int width_, const int height_, const GLenum format_) noexcept
+{
+    for (std::uint32_t index = 0; index < arrays.size(); ++index)
+    {
+        const TextureArray& array = arrays[index];
+        if (array.width == width_ && array.height == height_ && array.format == format_ && array.layerCount < LAYERS_PER_ARRAY)
+        {
+            return index;
+        }
+    }
+
+    TextureArray array = { 0, width_, height_, ComputeLevels(width_, height_), format_, 0 };
+
+    glGenTextures(1, &array.id);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, array.id);
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY, array.levels, format_, width_, height_, LAYERS_PER_ARRAY);
+
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // 업로드가 끝나기 전의 레이어가 초기화되지 않은 값을 보이지 않도록 비워둡니다. (압축 형식은 지울 수 없습니다)
+    if (format_ == GL_RGBA8)
+    {
+        for (int level = 0; level < array.levels; ++level)
+        {
+            glClearTexImage(array.id, level, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, boundArray);
+
+    arrays.push_back(array);
+    return static_cast<std::uint32_t>(arrays.size() - 1);
+}
+
+void TextureManager::Upload(const Entry& entry_, const MipChain& chain_) const noexcept
+{
+    const TextureArray& array = arrays[entry_.array];
+    if (chain_.width != array.width || chain_.height != array.height ||
+        chain_.levels != array.levels || chain_.format != array.format)
+    {
+        spdlog::error("Texture size changed while loading: {}x{} (expected {}x{})",
+                      chain_.width, chain_.height, array.width, array.height);
+        return;
+    }
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, array.id);
+
+    const std::byte* level  = chain_.data;
+    int              width  = chain_.width;
+    int              height = chain_.height;
+
+    for (int index = 0; index < chain_.levels; ++index)
+    {
+        const std::size_t size = ComputeLevelSize(width, height, chain_.format);
+
+        if (chain_.format == GL_RGBA8)
+        {
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, index, 0, 0, static_cast<GLint>(entry_.layer),
+                            width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, level);
+        }
+        else
+        {
+            glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, index, 0, 0, static_cast<GLint>(entry_.layer),
+                                      width, height, 1, chain_.format, static_cast<GLsizei>(size), level);
+        }
+
+        level  += size;
+        width   = std::max(1, width / 2);
+        height  = std::max(1, height / 2);
+    }
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, boundArray);
+}
+
+TextureManager::MipChain TextureManager::Prepare(const std::filesystem::path& sourcePath_,
+                                                 const std::filesystem::path& cachePath_,
+                                                 const GLenum                 format_,
+                                                 const BlockCompressor::Quality quality_) noexcept
+{
+    MipChain chain;
+
+    std::error_code sizeError;
+    std::error_code timeError;
+    const std::uint64_t sourceSize = std::filesystem::file_size(sourcePath_, sizeError);
+    const std::int64_t  sourceTime = std::filesystem::last_write_time(sourcePath_, timeError).time_since_epoch().count();
+    if (sizeError || timeError)
+    {
+        spdlog::error("Failed to load texture: {}", sourcePath_.string());
+        return chain;
+    }
+
+    // 1. 원본이 바뀌지 않았다면 캐시를 매핑하여 그대로 사용합니다.
+    {
+        MappedFile mapped(cachePath_);
+        if (mapped.IsOpen() && mapped.GetSize() >= sizeof(MipCacheHeader))
+        {
+            MipCacheHeader header;
+            std::memcpy(&header, mapped.GetData(), sizeof(header));
+
+            if (std::memcmp(header.magic, MIP_CACHE_MAGIC, sizeof(MIP_CACHE_MAGIC)) == 0 &&
+                header.version    == MIP_CACHE_VERSION &&
+                header.format     == format_ &&
+                header.quality    == static_cast<std::uint32_t>(quality_) &&
+                header.sourceSize == sourceSize &&
+                header.sourceTime == sourceTime &&
+                mapped.GetSize()  == sizeof(MipCacheHeader) + ComputeChainSize(header.width, header.height, header.levels, format_))
+            {
+                chain.width  = header.width;
+                chain.height = header.height;
+                chain.levels = header.levels;
+                chain.format = format_;
+                chain.data   = mapped.GetData() + sizeof(MipCacheHeader);
+                chain.mapped = std::move(mapped);
+
+                return chain;
+            }
+        }
+    }
+
+    // 2. 이미지를 디코딩합니다. (OpenGL 텍스처 좌표계에 맞춰 위아래를 뒤집습니다)
+    int width    = 0;
+    int height   = 0;
+    int channels = 0;
+
+    stbi_uc* const decoded = stbi_load(sourcePath_.string().c_str(), &width, &height, &channels, 4);
+    if (decoded == nullptr)
+    {
+        spdlog::error("Failed to load texture: {}", sourcePath_.string());
+        return chain;
+    }
+
+    chain.width  = width;
+    chain.height = height;
+    chain.levels = ComputeLevels(width, height);
+    chain.pixels.resize(ComputeChainSize(width, height, chain.levels, GL_RGBA8));
+
+    const std::size_t rowSize = static_cast<std::size_t>(width) * 4;
+    for (int y = 0; y < height; ++y)
+    {
+        std::memcpy(chain.pixels.data() + static_cast<std::size_t>(y) * rowSize,
+                    decoded + static_cast<std::size_t>(height - 1 - y) * rowSize,
+                    rowSize);
+    }
+
+    stbi_image_free(decoded);
+
+    // 3. 이전 레벨을 2x2 평균하여 하위 밉 레벨들을 만듭니다.
+    {
+        std::byte* source       = chain.pixels.data();
+        int        sourceWidth  = width;
+        int        sourceHeight = height;
+
+        for (int level = 1; level < chain.levels; ++level)
+        {
+            const int targetWidth  = std::max(1, sourceWidth / 2);
+            const int targetHeight = std::max(1, sourceHeight / 2);
+
+            std::byte* const target = source + static_cast<std::size_t>(sourceWidth) * sourceHeight * 4;
+
+            for (int y = 0; y < targetHeight; ++y)
+            {
+                const int y0 = std::min(y * 2,     sourceHeight - 1);
+                const int y1 = std::min(y * 2 + 1, sourceHeight - 1);
+
+                for (int x = 0; x < targetWidth; ++x)
+                {
+                    const int x0 = std::min(x * 2,     sourceWidth - 1);
+                    const int x1 = std::min(x * 2 + 1, sourceWidth - 1);
+
+                    for (int channel = 0; channel < 4; ++channel)
+                    {
+                        const auto at = [&](const int sx_, const int sy_) -> unsigned int
+                        {
+                            return std::to_integer<unsigned int>(source[(static_cast<std::size_t>(sy_) * sourceWidth + sx_) * 4 + channel]);
+                        };
+
+                        const unsigned int sum = at(x0, y0) + at(x1, y0) + at(x0, y1) + at(x1, y1);
+                        target[(static_cast<std::size_t>(y) * targetWidth + x) * 4 + channel] = static_cast<std::byte>((sum + 2) / 4);
+                    }
+                }
+            }
+
+            source       = target;
+            sourceWidth  = targetWidth;
+            sourceHeight = targetHeight;
+        }
+    }
+
+    // 4. 압축 형식이라면 각 밉 레벨을 블록 압축하여 픽셀 데이터를 교체합니다.
+    if (format_ != GL_RGBA8)
+    {
+        const BlockCompressor::Format blockFormat = format_ == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT ? BlockCompressor::Format::BC1
+                                                                                               : BlockCompressor::Format::BC3;
+
+        std::vector<std::byte> compressed(ComputeChainSize(width, height, chain.levels, format_));
+
+        const std::byte* source      = chain.pixels.data();
+        std::byte*       target      = compressed.data();
+        int              levelWidth  = width;
+        int              levelHeight = height;
+
+        for (int level = 0; level < chain.levels; ++level)
+        {
+            BlockCompressor::Compress(source, levelWidth, levelHeight, blockFormat, quality_, target);
+
+            source     += ComputeLevelSize(levelWidth, levelHeight, GL_RGBA8);
+            target     += ComputeLevelSize(levelWidth, levelHeight, format_);
+            levelWidth  = std::max(1, levelWidth / 2);
+            levelHeight = std::max(1, levelHeight / 2);
+        }
+
+        chain.pixels = std::move(compressed);
+    }
+
+    chain.format = format_;
+    chain.data   = chain.pixels.data();
+
+    // 5. 다음 실행을 위해 캐시에 기록합니다. 중간에 실패해도 깨진 캐시가 남지 않도록 임시 파일을 거칩니다.
+    {
+        MipCacheHeader header = { };
+        std::memcpy(header.magic, MIP_CACHE_MAGIC, sizeof(MIP_CACHE_MAGIC));
+        header.version    = MIP_CACHE_VERSION;
+        header.width      = chain.width;
+        header.height     = chain.height;
+        header.levels     = chain.levels;
+        header.format     = format_;
+        header.quality    = static_cast<std::uint32_t>(quality_);
+        header.sourceSize = sourceSize;
+        header.sourceTime = sourceTime;
+
+        std::filesystem::path temporaryPath = cachePath_;
+        temporaryPath += ".tmp";
+
+        std::ofstream ofs(temporaryPath, std::ios::binary | std::ios::trunc);
+        ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        ofs.write(reinterpret_cast<const char*>(chain.pixels.data()), static_cast<std::streamsize>(chain.pixels.size()));
+        ofs.close();
+
+        std::error_code error;
+        if (ofs)
+        {
+            std::filesystem::rename(temporaryPath, cachePath_, error);
+        }
+
+        if (!ofs || error)
+        {
+            spdlog::warn("Failed to write texture cache: {}", cachePath_.string());
+            std::filesystem::remove(temporaryPath, error);
+        }
+    }
+
+    return chain;
+}
+
+int TextureManager::ComputeLevels(const int width_, const int height_) noexcept
+{
+    int levels = 1;
+    for (int size = std::max(width_, height_); size > 1; size /= 2)
+    {
+        ++levels;
+    }
+
+    return levels;
+}
+
+std::size_t TextureManager::ComputeLevelSize(const int width_, const int height_, const GLenum format_) noexcept
+{
+    switch (format_)
+    {
+        case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+        {
+            return BlockCompressor::ComputeSize(BlockCompressor::Format::BC1, width_, height_);
+        }
+        case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+        {
+            return BlockCompressor::ComputeSize(BlockCompressor::Format::BC3, width_, height_);
+        }
+        default:
+        {
+            return static_cast<std::size_t>(width_) * height_ * 4;
+        }
+    }
+}
+
+std::size_t TextureManager::ComputeChainSize(const int width_, const int height_, const int levels_, const GLenum format_) noexcept
+{
+    std::size_t size   = 0;
+    int         width  = width_;
+    int         height = height_;
+
+    for (int level = 0; level < levels_; ++level)
+    {
+        size  += ComputeLevelSize(width, height, format_);
+        width  = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+
+    return size;
+}
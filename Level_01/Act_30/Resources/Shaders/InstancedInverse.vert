@@ -0,0 +1,31 @@
+#version 460 core
+
+layout(location = 0) in vec3 aPosition;
+layout(location = 1) in vec3 aNormal;
+layout(location = 2) in vec2 aTexCoord;
+
+// 인스턴스 별 모델 행렬
+layout(std430, binding = 0) readonly buffer ModelBuffer
+{
+    mat4 models[];
+};
+
+uniform mat4 uView;
+uniform mat4 uProjection;
+
+out vec3 vNormal;
+out vec3 vFragPos;
+out vec2 vTexCoord;
+
+void main()
+{
+    mat4 model = models[gl_InstanceID];
+
+    vTexCoord = aTexCoord;
+    vFragPos  = vec3(model * vec4(aPosition, 1.0));
+
+    // 비교용: 정점마다 역행렬을 계산합니다.
+    vNormal = mat3(transpose(inverse(model))) * aNormal;
+
+    gl_Position = uProjection * uView * vec4(vFragPos, 1.0);
+}
\ No newline at end of file
@@ -6,14 +6,15 @@ in vec2 vTexCoord;
 
 out vec4 FragColor;
 
-uniform sampler2D uTexture;
+uniform sampler2DArray uTexture;
+uniform int uLayer;        // 텍스처 배열 내 레이어
 uniform vec3 uLightPos;    // [추가] 조명 위치
 uniform vec3 uLightColor;  // [추가] 조명 색상
 uniform vec3 uViewPos;     // [추가] 카메라 위치
 
 void main()
 {
-    vec4 texColor = texture(uTexture, vTexCoord);
+    vec4 texColor = texture(uTexture, vec3(vTexCoord, uLayer));
 
     // 1. Ambient (주변광 - 기본 밝기)
     float ambientStrength = 0.1;
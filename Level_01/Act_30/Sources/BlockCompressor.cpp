@@ -0,0 +1,469 @@
+﻿#include "BlockCompressor.h"
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define BLOCK_COMPRESSOR_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief 블록 한 변의 픽셀 수.
+ */
+static constexpr int BLOCK_DIMENSION = 4;
+
+/**
+ * @brief 스레드 하나가 맡을 최소 블록 행 수. 작은 밉 레벨은 스레드 생성 비용이 더 크므로 한 스레드로 처리합니다.
+ */
+static constexpr int MIN_ROWS_PER_THREAD = 16;
+
+/**
+ * @brief 16개 값을 축에 투영하고 [0, steps_] 범위의 정수로 반올림합니다.
+ *
+ * @param values_ 채널 별 16개 값. (SoA)
+ * @param origin_ 투영 원점.
+ * @param axis_   투영 축. 원점에서 끝점까지가 steps_가 되도록 미리 스케일되어 있어야 합니다.
+ * @param steps_  최대 단계.
+ * @param result_ 반올림된 단계들.
+ */
+static void Project(const float (&values_)[3][16],
+                    const float (&origin_)[3],
+                    const float (&axis_)[3],
+                    const int   steps_,
+                    int (&result_)[16]) noexcept
+{
+#ifdef BLOCK_COMPRESSOR_USE_SSE2
+    const __m128 originR = _mm_set1_ps(origin_[0]);
+    const __m128 originG = _mm_set1_ps(origin_[1]);
+    const __m128 originB = _mm_set1_ps(origin_[2]);
+    const __m128 axisR   = _mm_set1_ps(axis_[0]);
+    const __m128 axisG   = _mm_set1_ps(axis_[1]);
+    const __m128 axisB   = _mm_set1_ps(axis_[2]);
+    const __m128 lower   = _mm_setzero_ps();
+    const __m128 upper   = _mm_set1_ps(static_cast<float>(steps_));
+    const __m128 half    = _mm_set1_ps(0.5f);
+
+    for (int index = 0; index < 16; index += 4)
+    {
+        __m128 t = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&values_[0][index]), originR), axisR);
+        t = _mm_add_ps(t, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&values_[1][index]), originG), axisG));
+        t = _mm_add_ps(t, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&values_[2][index]), originB), axisB));
+        t = _mm_add_ps(_mm_min_ps(_mm_max_ps(t, lower), upper), half);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&result_[index]), _mm_cvttps_epi32(t));
+    }
+#else
+    for (int index = 0; index < 16; ++index)
+    {
+        const float t = (values_[0][index] - origin_[0]) * axis_[0] +
+                        (values_[1][index] - origin_[1]) * axis_[1] +
+                        (values_[2][index] - origin_[2]) * axis_[2];
+
+        result_[index] = static_cast<int>(std::clamp(t, 0.0f, static_cast<float>(steps_)) + 0.5f);
+    }
+#endif
+}
+
+/**
+ * @brief 0~255 범위의 색상을 RGB565로 양자화합니다.
+ */
+static std::uint16_t ToRGB565(const glm::vec3& color_) noexcept
+{
+    const int r = static_cast<int>(std::clamp(color_.r, 0.0f, 255.0f) * (31.0f / 255.0f) + 0.5f);
+    const int g = static_cast<int>(std::clamp(color_.g, 0.0f, 255.0f) * (63.0f / 255.0f) + 0.5f);
+    const int b = static_cast<int>(std::clamp(color_.b, 0.0f, 255.0f) * (31.0f / 255.0f) + 0.5f);
+
+    return static_cast<std::uint16_t>((r << 11) | (g << 5) | b);
+}
+
+/**
+ * @brief RGB565를 디코더와 같은 방식으로 0~255 범위의 색상으로 복원합니다.
+ */
+static glm::vec3 FromRGB565(const std::uint16_t color_) noexcept
+{
+    const int r = (color_ >> 11) & 31;
+    const int g = (color_ >> 5)  & 63;
+    const int b =  color_        & 31;
+
+    return { static_cast<float>((r << 3) | (r >> 2)),
+             static_cast<float>((g << 2) | (g >> 4)),
+             static_cast<float>((b << 3) | (b >> 2)) };
+}
+
+std::size_t BlockCompressor::ComputeSize(const Format format_, const int width_, const int height_) noexcept
+{
+    const std::size_t blocks = static_cast<std::size_t>((width_ + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION) *
+                               static_cast<std::size_t>((height_ + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION);
+
+    return blocks * (format_ == Format::BC1 ? 8 : 16);
+}
+
+GLenum BlockCompressor::ToInternalFormat(const Format format_) noexcept
+{
+    return format_ == Format::BC1 ? GL_COMPRESSED_RGBA_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+}
+
+void BlockCompressor::Compress(const std::byte* pixels_,
+                               const int        width_,
+                               const int        height_,
+                               const Format     format_,
+                               const Quality    quality_,
+                               std::byte*       output_,
+                               unsigned int     threadCount_) noexcept
+{
+    const int rows = (height_ + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+
+    if (threadCount_ == 0)
+    {
+        threadCount_ = std::max(1u, std::thread::hardware_concurrency());
+        threadCount_ = std::min(threadCount_, static_cast<unsigned int>(std::max(1, rows / MIN_ROWS_PER_THREAD)));
+    }
+
+    threadCount_ = std::clamp(threadCount_, 1u, static_cast<unsigned int>(std::max(1, rows)));
+
+    // 블록 행들을 고르게 나누어 각 스레드가 서로 겹치지 않는 출력 구간을 기록합니다.
+    std::vector<std::jthread> workers;
+    workers.reserve(threadCount_ - 1);
+
+    for (unsigned int thread = 1; thread < threadCount_; ++thread)
+    {
+        const int firstRow = static_cast<int>(static_cast<long long>(rows) * thread / threadCount_);
+        const int lastRow  = static_cast<int>(static_cast<long long>(rows) * (thread + 1) / threadCount_);
+
+        workers.emplace_back(&BlockCompressor::CompressRows, pixels_, width_, height_, format_, quality_, output_, firstRow, lastRow);
+    }
+
+    CompressRows(pixels_, width_, height_, format_, quality_, output_, 0, static_cast<int>(rows / threadCount_));
+}
+
+void BlockCompressor::Benchmark() noexcept
+{
+    constexpr int WIDTH  = 2048;
+    constexpr int HEIGHT = 2048;
+
+    // 그라데이션에 잡음을 섞어 실제 텍스처와 비슷하게 블록마다 색상 분포가 다르도록 만듭니다.
+    std::vector<std::byte> pixels(static_cast<std::size_t>(WIDTH) * HEIGHT * 4);
+    {
+        std::mt19937 random(42);
+        std::uniform_int_distribution<int> noise(-24, 24);
+
+        for (int y = 0; y < HEIGHT; ++y)
+        {
+            for (int x = 0; x < WIDTH; ++x)
+            {
+                std::byte* const pixel = pixels.data() + (static_cast<std::size_t>(y) * WIDTH + x) * 4;
+
+                pixel[0] = static_cast<std::byte>(std::clamp(x * 255 / WIDTH + noise(random), 0, 255));
+                pixel[1] = static_cast<std::byte>(std::clamp(y * 255 / HEIGHT + noise(random), 0, 255));
+                pixel[2] = static_cast<std::byte>(std::clamp(((x ^ y) & 255) + noise(random), 0, 255));
+                pixel[3] = static_cast<std::byte>(std::clamp(255 - (x + y) * 255 / (WIDTH + HEIGHT) + noise(random), 0, 255));
+            }
+        }
+    }
+
+    std::vector<std::byte> output(ComputeSize(Format::BC3, WIDTH, HEIGHT));
+
+    constexpr std::array<const char*, 3> QUALITY_NAMES = { "Fast", "Normal", "High" };
+    constexpr std::array<Quality, 3>     QUALITIES     = { Quality::Fast, Quality::Normal, Quality::High };
+
+    const unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const double       megapixels      = static_cast<double>(WIDTH) * HEIGHT / 1'000'000.0;
+
+    spdlog::info("BCn encode benchmark: {}x{} RGBA8", WIDTH, HEIGHT);
+
+    for (std::size_t index = 0; index < QUALITIES.size(); ++index)
+    {
+        for (const Format format : { Format::BC1, Format::BC3 })
+        {
+            for (const unsigned int threads : { 1u, hardwareThreads })
+            {
+                const auto start = std::chrono::steady_clock::now();
+                Compress(pixels.data(), WIDTH, HEIGHT, format, QUALITIES[index], output.data(), threads);
+                const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+                const double throughput = megapixels / elapsed.count();
+
+                spdlog::info("  BC{} {:<6} {:>2} thread(s): {:8.2f} MP/s ({:.2f} MP/s per thread)",
+                             format == Format::BC1 ? 1 : 3,
+                             QUALITY_NAMES[index],
+                             threads,
+                             throughput,
+                             throughput / threads);
+
+                if (threads == hardwareThreads)
+                {
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void BlockCompressor::CompressRows(const std::byte* pixels_,
+                                   const int        width_,
+                                   const int        height_,
+                                   const Format     format_,
+                                   const Quality    quality_,
+                                   std::byte*       output_,
+                                   const int        firstRow_,
+                                   const int        lastRow_) noexcept
+{
+    const int         columns    = (width_ + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+    const std::size_t blockBytes = format_ == Format::BC1 ? 8 : 16;
+
+    std::uint8_t block[64];
+
+    for (int row = firstRow_; row < lastRow_; ++row)
+    {
+        for (int column = 0; column < columns; ++column)
+        {
+            // 이미지 경계에 걸친 블록은 가장자리 픽셀을 반복하여 채웁니다.
+            for (int y = 0; y < BLOCK_DIMENSION; ++y)
+            {
+                const int sourceY = std::min(row * BLOCK_DIMENSION + y, height_ - 1);
+
+                for (int x = 0; x < BLOCK_DIMENSION; ++x)
+                {
+                    const int sourceX = std::min(column * BLOCK_DIMENSION + x, width_ - 1);
+
+                    std::memcpy(&block[(y * BLOCK_DIMENSION + x) * 4],
+                                pixels_ + (static_cast<std::size_t>(sourceY) * width_ + sourceX) * 4,
+                                4);
+                }
+            }
+
+            std::byte* const target = output_ + (static_cast<std::size_t>(row) * columns + column) * blockBytes;
+
+            if (format_ == Format::BC3)
+            {
+                EncodeAlpha(block, target);
+                EncodeColor(block, quality_, target + 8);
+            }
+            else
+            {
+                EncodeColor(block, quality_, target);
+            }
+        }
+    }
+}
+
+void BlockCompressor::EncodeColor(const std::uint8_t (&block_)[64], const Quality quality_, std::byte* output_) noexcept
+{
+    float     values[3][16];
+    glm::vec3 minimum = glm::vec3(255.0f);
+    glm::vec3 maximum = glm::vec3(0.0f);
+    glm::vec3 mean    = glm::vec3(0.0f);
+
+    for (int index = 0; index < 16; ++index)
+    {
+        const glm::vec3 color = { block_[index * 4 + 0], block_[index * 4 + 1], block_[index * 4 + 2] };
+
+        values[0][index] = color.r;
+        values[1][index] = color.g;
+        values[2][index] = color.b;
+
+        minimum = glm::min(minimum, color);
+        maximum = glm::max(maximum, color);
+        mean   += color;
+    }
+
+    mean /= 16.0f;
+
+    // 1. 끝점 선택. (end는 color0, start는 color1이 됩니다)
+    glm::vec3 start;
+    glm::vec3 end;
+
+    if (quality_ == Quality::Fast)
+    {
+        const glm::vec3 inset = (maximum - minimum) / 16.0f;
+
+        start = minimum + inset;
+        end   = maximum - inset;
+    }
+    else
+    {
+        float covariance[6] = { };
+        for (int index = 0; index < 16; ++index)
+        {
+            const glm::vec3 d = glm::vec3(values[0][index], values[1][index], values[2][index]) - mean;
+
+            covariance[0] += d.r * d.r;
+            covariance[1] += d.r * d.g;
+            covariance[2] += d.r * d.b;
+            covariance[3] += d.g * d.g;
+            covariance[4] += d.g * d.b;
+            covariance[5] += d.b * d.b;
+        }
+
+        // 거듭제곱법으로 공분산 행렬의 주축을 구합니다.
+        glm::vec3 axis = maximum - minimum;
+        for (int iteration = 0; iteration < 8; ++iteration)
+        {
+            axis = { covariance[0] * axis.r + covariance[1] * axis.g + covariance[2] * axis.b,
+                     covariance[1] * axis.r + covariance[3] * axis.g + covariance[4] * axis.b,
+                     covariance[2] * axis.r + covariance[4] * axis.g + covariance[5] * axis.b };
+
+            const float length = std::max({ std::abs(axis.r), std::abs(axis.g), std::abs(axis.b) });
+            if (length <= 0.0f)
+            {
+                break;
+            }
+
+            axis /= length;
+        }
+
+        const float lengthSquared = glm::dot(axis, axis);
+        if (lengthSquared <= 0.0f)
+        {
+            start = mean;
+            end   = mean;
+        }
+        else
+        {
+            axis /= std::sqrt(lengthSquared);
+
+            float lowest  = std::numeric_limits<float>::max();
+            float highest = std::numeric_limits<float>::lowest();
+            for (int index = 0; index < 16; ++index)
+            {
+                const float t = glm::dot(glm::vec3(values[0][index], values[1][index], values[2][index]) - mean, axis);
+
+                lowest  = std::min(lowest, t);
+                highest = std::max(highest, t);
+            }
+
+            start = mean + axis * lowest;
+            end   = mean + axis * highest;
+        }
+
+        // 현재 인덱스 배정에 대해 오차 제곱합이 최소가 되도록 끝점을 다시 풉니다.
+        if (quality_ == Quality::High)
+        {
+            for (int iteration = 0; iteration < 2; ++iteration)
+            {
+                const glm::vec3 direction = end - start;
+                const float     length    = glm::dot(direction, direction);
+                if (length <= 0.0f)
+                {
+                    break;
+                }
+
+                const float origin[3] = { start.r, start.g, start.b };
+                const float scaled[3] = { direction.r * 3.0f / length, direction.g * 3.0f / length, direction.b * 3.0f / length };
+
+                int steps[16];
+                Project(values, origin, scaled, 3, steps);
+
+                float     aa = 0.0f;
+                float     ab = 0.0f;
+                float     bb = 0.0f;
+                glm::vec3 ax = glm::vec3(0.0f);
+                glm::vec3 bx = glm::vec3(0.0f);
+
+                for (int index = 0; index < 16; ++index)
+                {
+                    const float     w     = static_cast<float>(steps[index]) / 3.0f;
+                    const glm::vec3 color = { values[0][index], values[1][index], values[2][index] };
+
+                    aa += (1.0f - w) * (1.0f - w);
+                    ab += (1.0f - w) * w;
+                    bb += w * w;
+                    ax += (1.0f - w) * color;
+                    bx += w * color;
+                }
+
+                const float determinant = aa * bb - ab * ab;
+                if (std::abs(determinant) < 1e-6f)
+                {
+                    break;
+                }
+
+                start = glm::clamp((bb * ax - ab * bx) / determinant, glm::vec3(0.0f), glm::vec3(255.0f));
+                end   = glm::clamp((aa * bx - ab * ax) / determinant, glm::vec3(0.0f), glm::vec3(255.0f));
+            }
+        }
+    }
+
+    // 2. 끝점 양자화. 4색 모드를 쓰려면 color0 > color1 이어야 합니다.
+    std::uint16_t color0 = ToRGB565(end);
+    std::uint16_t color1 = ToRGB565(start);
+    if (color0 < color1)
+    {
+        std::swap(color0, color1);
+    }
+
+    // 3. 양자화된 끝점을 기준으로 인덱스 선택.
+    std::uint32_t indices = 0;
+    if (color0 != color1)
+    {
+        const glm::vec3 endpoint0 = FromRGB565(color0);
+        const glm::vec3 endpoint1 = FromRGB565(color1);
+        const glm::vec3 direction = endpoint1 - endpoint0;
+        const float     length    = glm::dot(direction, direction);
+
+        const float origin[3] = { endpoint0.r, endpoint0.g, endpoint0.b };
+        const float scaled[3] = { direction.r * 3.0f / length, direction.g * 3.0f / length, direction.b * 3.0f / length };
+
+        int steps[16];
+        Project(values, origin, scaled, 3, steps);
+
+        // 단계(color0에서 color1 방향) -> BC1 인덱스. (0: color0, 1: color1, 2: 2/3 color0, 3: 1/3 color0)
+        constexpr std::uint32_t STEP_TO_INDEX[4] = { 0, 2, 3, 1 };
+
+        for (int index = 0; index < 16; ++index)
+        {
+            indices |= STEP_TO_INDEX[steps[index]] << (index * 2);
+        }
+    }
+
+    const std::uint8_t bytes[8] =
+    {
+        static_cast<std::uint8_t>(color0 & 0xFF), static_cast<std::uint8_t>(color0 >> 8),
+        static_cast<std::uint8_t>(color1 & 0xFF), static_cast<std::uint8_t>(color1 >> 8),
+        static_cast<std::uint8_t>(indices & 0xFF),         static_cast<std::uint8_t>((indices >> 8) & 0xFF),
+        static_cast<std::uint8_t>((indices >> 16) & 0xFF), static_cast<std::uint8_t>(indices >> 24),
+    };
+
+    std::memcpy(output_, bytes, sizeof(bytes));
+}
+
+void BlockCompressor::EncodeAlpha(const std::uint8_t (&block_)[64], std::byte* output_) noexcept
+{
+    float        values[3][16] = { };
+    std::uint8_t alpha0        = 0;
+    std::uint8_t alpha1        = 255;
+
+    for (int index = 0; index < 16; ++index)
+    {
+        const std::uint8_t alpha = block_[index * 4 + 3];
+
+        values[0][index] = alpha;
+        alpha0           = std::max(alpha0, alpha);
+        alpha1           = std::min(alpha1, alpha);
+    }
+
+    std::uint64_t indices = 0;
+    if (alpha0 != alpha1)
+    {
+        const float origin[3] = { static_cast<float>(alpha0), 0.0f, 0.0f };
+        const float scaled[3] = { -7.0f / static_cast<float>(alpha0 - alpha1), 0.0f, 0.0f };
+
+        int steps[16];
+        Project(values, origin, scaled, 7, steps);
+
+        // 단계(alpha0에서 alpha1 방향) -> BC3 알파 인덱스. (0: alpha0, 1: alpha1, 2~7: 보간값)
+        for (int index = 0; index < 16; ++index)
+        {
+            const int step = steps[index];
+            const std::uint64_t code = step == 0 ? 0 : (step == 7 ? 1 : static_cast<std::uint64_t>(step + 1));
+
+            indices |= code << (index * 3);
+        }
+    }
+
+    std::uint8_t bytes[8] = { alpha0, alpha1 };
+    for (int index = 0; index < 6; ++index)
+    {
+        bytes[2 + index] = static_cast<std::uint8_t>((indices >> (index * 8)) & 0xFF);
+    }
+
+    std::memcpy(output_, bytes, sizeof(bytes));
+}
@@ -1,13 +1,16 @@
 ﻿#include "PCH.h"
 
 #include "Application.h"
+#include "BlockCompressor.h"
 #include "Camera.h"
 #include "Input.h"
 #include "Light.h"
 #include "Mesh.h"
+#include "NormalMatrix.h"
 #include "Object.h"
 #include "Shader.h"
-#include "Texture.h"
+#include "ShaderManager.h"
+#include "TextureManager.h"
 
 /**
  * @brief 창이 켜질 때 호출됩니다.
@@ -42,9 +45,9 @@ static std::unique_ptr<Camera> camera;
 static std::unique_ptr<Light> light;
 
 /**
- * @brief 사용할 셰이더.
+ * @brief 셰이더 관리자.
  */
-static std::vector<std::unique_ptr<Shader>> shader;
+static std::unique_ptr<ShaderManager> shaders;
 
 /**
  * @brief 표준 셰이더.
@@ -56,6 +59,16 @@ static Shader* standardShader = nullptr;
  */
 static Shader* textureShader = nullptr;
 
+/**
+ * @brief 법선 행렬 벤치마크용 인스턴스 셰이더. (정점마다 역행렬 계산)
+ */
+static Shader* inverseShader = nullptr;
+
+/**
+ * @brief 법선 행렬 벤치마크용 인스턴스 셰이더. (CPU에서 계산한 법선 행렬 사용)
+ */
+static Shader* normalShader = nullptr;
+
 /**
  * @brief 사용할 메쉬들.
  */
@@ -74,21 +87,29 @@ static Mesh* pyramidMesh = nullptr;
 static Mesh* quadMesh = nullptr;
 
 /**
- * @brief 사용할 텍스처들.
+ * @brief 구 메쉬. (법선 행렬 벤치마크용)
+ */
+static Mesh* sphereMesh = nullptr;
+
+/**
+ * @brief 텍스처 매니저.
  */
-static std::vector<std::unique_ptr<Texture>> textures;
+static std::unique_ptr<TextureManager> textures;
 
 /**
  * @brief 큐브 텍스처.
  */
-static Texture* cubeTexture = nullptr;
+static TextureManager::Handle cubeTexture;
 
 /**
  * @brief 피라미드 텍스처.
  */
-static Texture* pyramidTexture = nullptr;
+static TextureManager::Handle pyramidTexture;
 
-static Texture* quadTexture = nullptr;
+/**
+ * @brief 배경 텍스처.
+ */
+static TextureManager::Handle quadTexture;
 
 /**
  * @brief 시뮬레이션 할 오브젝트들.
@@ -138,19 +159,15 @@ void OnLoad() noexcept
 	constexpr glm::vec3 lightColor    = glm::vec3(1.0f, 1.0f, 1.0f);
 	light = std::make_unique<Light>(lightPosition, lightColor);
 
-	standardShader = shader.emplace_back(std::make_unique<Shader>("Resources/Shaders/Standard.vert",
-																  "Resources/Shaders/Standard.frag")).get();
-	if (!standardShader)
-	{
-		spdlog::critical("Standard shader creation failed.");
-		Application::Quit(-1);
-	}
+	shaders = std::make_unique<ShaderManager>("Cache/Shaders");
 
-	textureShader = shader.emplace_back(std::make_unique<Shader>("Resources/Shaders/Texture.vert",
-																 "Resources/Shaders/Texture.frag")).get();
-	if (!textureShader)
+	standardShader = shaders->Load("Resources/Shaders/Standard.vert", "Resources/Shaders/Standard.frag");
+	textureShader  = shaders->Load("Resources/Shaders/Texture.vert",  "Resources/Shaders/Texture.frag");
+	inverseShader  = shaders->Load("Resources/Shaders/InstancedInverse.vert", "Resources/Shaders/Texture.frag");
+	normalShader   = shaders->Load("Resources/Shaders/InstancedNormal.vert",  "Resources/Shaders/Texture.frag");
+	if (!shaders->Build())
 	{
-		spdlog::critical("Texture shader creation failed.");
+		spdlog::critical("Shader creation failed.");
 		Application::Quit(-1);
 	}
 
@@ -174,35 +191,47 @@ void OnLoad() noexcept
 		Application::Quit(-1);
 	}
 
-	cubeTexture = textures.emplace_back(Texture::LoadFrom("Resources/Textures/Texture.png")).get();
-	if (!cubeTexture)
+	sphereMesh = meshes.emplace_back(Mesh::LoadFrom("Resources/Meshes/Sphere.obj")).get();
+	if (!sphereMesh)
+	{
+		spdlog::warn("Sphere mesh load failed. Normal matrix benchmark is disabled.");
+	}
+
+	textures = std::make_unique<TextureManager>("Cache/Textures");
+
+	// 같은 경로는 같은 핸들을 돌려받으므로 큐브와 피라미드는 한 텍스처를 공유합니다.
+	cubeTexture = textures->Load("Resources/Textures/Texture.png");
+	if (!cubeTexture.IsValid())
 	{
 		spdlog::critical("Cube texture load failed.");
 		Application::Quit(-1);
 	}
 
-	pyramidTexture = textures.emplace_back(Texture::LoadFrom("Resources/Textures/Texture.png")).get();
-	if (!pyramidTexture)
+	pyramidTexture = textures->Load("Resources/Textures/Texture.png");
+	if (!pyramidTexture.IsValid())
 	{
 		spdlog::critical("Pyramid texture load failed.");
 		Application::Quit(-1);
 	}
 
-	quadTexture = textures.emplace_back(Texture::LoadFrom("Resources/Textures/Background.png")).get();
-	if (!quadTexture) {
+	quadTexture = textures->Load("Resources/Textures/Background.png");
+	if (!quadTexture.IsValid()) {
 		spdlog::critical("Background texture load failed.");
 	}
 
-	cube = objects.emplace_back(std::make_unique<Object>(cubeMesh, cubeTexture)).get();
+	cube = objects.emplace_back(std::make_unique<Object>(cubeMesh, textures.get(), cubeTexture)).get();
 	cube->SetPosition(glm::vec3(0.0f, 0.0f, 0.0f));
 
-	pyramid = objects.emplace_back(std::make_unique<Object>(pyramidMesh, pyramidTexture)).get();
+	pyramid = objects.emplace_back(std::make_unique<Object>(pyramidMesh, textures.get(), pyramidTexture)).get();
 	pyramid->SetPosition(glm::vec3(0.0f, 0.0f, 0.0f));
 
-	background = objects.emplace_back(std::make_unique<Object>(quadMesh, quadTexture)).get();
+	background = objects.emplace_back(std::make_unique<Object>(quadMesh, textures.get(), quadTexture)).get();
 
 	background->SetPosition(glm::vec3(0.0f, 0.0f, -10.0f));
 	background->SetScale(glm::vec3(20.0f, 20.0f, 1.0f));
+
+	// 디코딩은 백그라운드에서 병렬로 진행되었으므로 첫 프레임 전에 업로드만 마무리합니다.
+	textures->Wait();
 }
 
 static bool trigger = false;
@@ -216,6 +245,18 @@ void OnTick(const float deltaTime_) noexcept
 		Application::Quit(0);
 	}
 
+	textures->Update();
+
+	if (Input::IsKeyPressed(GLFW_KEY_B))
+	{
+		BlockCompressor::Benchmark();
+	}
+
+	if (Input::IsKeyPressed(GLFW_KEY_N) && sphereMesh)
+	{
+		NormalMatrix::Benchmark(*sphereMesh, *inverseShader, *normalShader);
+	}
+
 	if (Input::IsKeyPressed(GLFW_KEY_C))
 		trigger = false;
 
@@ -241,9 +282,9 @@ void OnDisplay() noexcept
 	textureShader->SetUniformMatrix4x4("uView", glm::mat4(1.0f));
 	textureShader->SetUniformMatrix4x4("uProjection", glm::mat4(1.0f));
 	textureShader->SetUniformMatrix4x4("uModel", glm::scale(glm::mat4(1.0f), glm::vec3(2.0f)));
+	textureShader->SetUniformMatrix3x3("uNormalMatrix", NormalMatrix::Compute(glm::scale(glm::mat4(1.0f), glm::vec3(2.0f)), true));
 
-	quadTexture->Bind(0);
-	textureShader->SetUniformInt("uTexture", 0);
+	textures->Bind(quadTexture, *textureShader);
 	quadMesh->Render();
 
 	glEnable(GL_DEPTH_TEST);
@@ -267,4 +308,8 @@ void OnClose() noexcept
 	light.reset();
 
 	objects.clear();
+
+	textures.reset();
+
+	shaders.reset();
 }
\ No newline at end of file
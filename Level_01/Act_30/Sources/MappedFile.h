@@ -0,0 +1,102 @@
+﻿#pragma once
+
+#include "PCH.h"
+
+/**
+ * @class MappedFile
+ *
+ * @brief 파일을 읽기 전용으로 메모리에 매핑합니다.
+ *
+ * 파일 내용은 복사 없이 페이지 단위로 필요할 때 읽혀지므로, 캐시된 텍스처처럼 큰 바이너리를 그대로 업로드할 때 사용합니다.
+ */
+class MappedFile final
+{
+public:
+    /**
+     * @brief 기본 생성자. 아무 파일도 매핑하지 않습니다.
+     */
+    MappedFile() noexcept = default;
+
+    /**
+     * @brief 생성자.
+     *
+     * @param path_ 매핑할 파일 경로.
+     */
+    explicit MappedFile(const std::filesystem::path& path_) noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    ~MappedFile() noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other_) noexcept;
+    MappedFile& operator=(MappedFile&& other_) noexcept;
+
+    /**
+     * @brief 파일이 매핑되어 있는지 여부를 반환합니다.
+     *
+     * @return bool 매핑 여부.
+     */
+    [[nodiscard]]
+    inline bool IsOpen() const noexcept;
+
+    /**
+     * @brief 매핑된 메모리의 시작 주소를 반환합니다.
+     *
+     * @return const std::byte* 매핑된 메모리의 시작 주소.
+     */
+    [[nodiscard]]
+    inline const std::byte* GetData() const noexcept;
+
+    /**
+     * @brief 매핑된 파일의 크기를 반환합니다.
+     *
+     * @return std::size_t 매핑된 파일의 크기.
+     */
+    [[nodiscard]]
+    inline std::size_t GetSize() const noexcept;
+
+private:
+    /**
+     * @brief 매핑을 해제하고 파일을 닫습니다.
+     */
+    void Close() noexcept;
+
+    /**
+     * @brief 파일 핸들.
+     */
+    HANDLE file = INVALID_HANDLE_VALUE;
+
+    /**
+     * @brief 파일 매핑 핸들.
+     */
+    HANDLE mapping = nullptr;
+
+    /**
+     * @brief 매핑된 메모리의 시작 주소.
+     */
+    const std::byte* data = nullptr;
+
+    /**
+     * @brief 매핑된 파일의 크기.
+     */
+    std::size_t size = 0;
+};
+
+inline bool MappedFile::IsOpen() const noexcept
+{
+    return data != nullptr;
+}
+
+inline const std::byte* MappedFile::GetData() const noexcept
+{
+    return data;
+}
+
+inline std::size_t MappedFile::GetSize() const noexcept
+{
+    return size;
+}
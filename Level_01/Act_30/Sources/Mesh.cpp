@@ -68,6 +68,19 @@ void Mesh::Render(const GLenum renderMode_) const noexcept
     glBindVertexArray(0);
 }
 
+void Mesh::RenderInstanced(const GLsizei instanceCount_, const GLenum renderMode_) const noexcept
+{
+    if (!isInitialized)
+    {
+        return;
+    }
+
+    glBindVertexArray(vao);
+    glDrawElementsInstanced(renderMode_, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, nullptr, instanceCount_);
+
+    glBindVertexArray(0);
+}
+
 std::unique_ptr<Mesh> Mesh::LoadFrom(const std::string& filePath_) noexcept
 {
     std::ifstream ifs(filePath_);
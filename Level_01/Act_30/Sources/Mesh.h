@@ -47,6 +47,22 @@ class Mesh
      */
     void Render(GLenum renderMode_ = GL_TRIANGLES) const noexcept;
 
+    /**
+     * @brief 해당 메쉬를 여러 인스턴스로 렌더링합니다.
+     *
+     * @param instanceCount_ 인스턴스 개수.
+     * @param renderMode_    렌더링 모드. 기본값은 GL_TRIANGLES입니다.
+     */
+    void RenderInstanced(GLsizei instanceCount_, GLenum renderMode_ = GL_TRIANGLES) const noexcept;
+
+    /**
+     * @brief 한 번 그릴 때 처리되는 인덱스 개수를 반환합니다.
+     *
+     * @return std::size_t 인덱스 개수.
+     */
+    [[nodiscard]]
+    inline std::size_t GetIndexCount() const noexcept;
+
     /**
      * @brief 파일에서 메쉬를 로드합니다.
      *
@@ -87,4 +103,9 @@ class Mesh
      * @brief 해당 메쉬의 초기화 여부.
      */
     bool isInitialized;
-};
\ No newline at end of file
+};
+
+inline std::size_t Mesh::GetIndexCount() const noexcept
+{
+    return indices.size();
+}
\ No newline at end of file
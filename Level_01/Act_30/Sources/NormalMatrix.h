@@ -0,0 +1,67 @@
+﻿#pragma once
+
+#include "PCH.h"
+
+class Mesh;
+class Shader;
+
+/**
+ * @class NormalMatrix
+ *
+ * @brief 모델 행렬로부터 법선 행렬(좌상단 3x3의 역전치 행렬)을 CPU에서 계산합니다.
+ *
+ * 역행렬 대신 여인수 행렬을 행렬식으로 나누어 구하며, 세 열의 외적은 SSE로 한 번에 처리합니다.
+ * 크기가 균일한 모델은 법선 행렬이 모델 행렬의 회전 부분과 방향이 같으므로 역행렬 계산을 완전히 생략합니다.
+ */
+class NormalMatrix final
+{
+public:
+    /**
+     * @brief 모델 행렬 하나의 법선 행렬을 계산합니다.
+     *
+     * @param model_          모델 행렬.
+     * @param isUniformScale_ 모델 행렬의 크기가 모든 축에서 같은지 여부. (전단이 없어야 합니다)
+     *
+     * @return glm::mat3 법선 행렬.
+     */
+    [[nodiscard]]
+    static glm::mat3 Compute(const glm::mat4& model_, const bool isUniformScale_) noexcept;
+
+    /**
+     * @brief 여러 모델 행렬의 법선 행렬을 한 번에 계산합니다.
+     *
+     * 결과는 열마다 4개의 float를 차지하므로 std430 셰이더 저장 버퍼의 mat3x4 배열로 그대로 업로드할 수 있습니다.
+     *
+     * @param models_         모델 행렬들.
+     * @param normals_        법선 행렬을 기록할 위치. 크기는 models_ 이상이어야 합니다.
+     * @param isUniformScale_ 모든 모델 행렬의 크기가 균일한지 여부.
+     */
+    static void Compute(const std::span<const glm::mat4> models_,
+                        const std::span<glm::mat3x4>     normals_,
+                        const bool                       isUniformScale_) noexcept;
+
+    /**
+     * @brief 구체 인스턴스들을 그려 셰이더 내 역행렬 계산과 CPU 사전 계산의 정점 처리량을 비교하여 로그로 남깁니다.
+     *
+     * @param mesh_              인스턴스로 그릴 메쉬.
+     * @param inverseShader_     정점마다 역행렬을 계산하는 인스턴스 셰이더.
+     * @param precomputedShader_ 미리 계산한 법선 행렬을 읽는 인스턴스 셰이더.
+     */
+    static void Benchmark(const Mesh&   mesh_,
+                          const Shader& inverseShader_,
+                          const Shader& precomputedShader_) noexcept;
+
+private:
+    NormalMatrix() = delete;
+    ~NormalMatrix() = delete;
+
+    /**
+     * @brief 모델 행렬 버퍼 바인딩 지점.
+     */
+    static constexpr GLuint MODEL_BINDING = 0;
+
+    /**
+     * @brief 법선 행렬 버퍼 바인딩 지점.
+     */
+    static constexpr GLuint NORMAL_BINDING = 1;
+};
@@ -3,9 +3,9 @@
 #include "PCH.h"
 
 #include "Shader.h"
+#include "TextureManager.h"
 
 class Mesh;
-class Texture;
 
 /**
  * @brief 
@@ -13,7 +13,14 @@ class Texture;
 class Object
 {
 public:
-	explicit Object(Mesh* mesh_, Texture* texture_) noexcept;
+	/**
+	 * @brief 생성자.
+	 *
+	 * @param mesh_     사용할 메쉬
+	 * @param textures_ 텍스처를 관리하는 텍스처 매니저
+	 * @param texture_  사용할 텍스처 핸들
+	 */
+	explicit Object(Mesh* mesh_, TextureManager* textures_, const TextureManager::Handle texture_) noexcept;
 
 	/**
 	 * @brief 해당 객체를 업데이트합니다.
@@ -97,6 +104,14 @@ class Object
     [[nodiscard]]
 	inline glm::mat4 GetModelMatrix() const noexcept;
 
+    /**
+     * @brief 해당 오브젝트와 모든 상위 객체의 크기가 균일한지 여부를 반환합니다.
+     *
+     * @return bool 크기가 균일하다면 true. (법선 행렬을 역행렬 없이 구할 수 있습니다)
+     */
+    [[nodiscard]]
+    inline bool IsUniformScale() const noexcept;
+
 private:
 	/**
 	 * @brief 해당 객체의 위치.
@@ -123,10 +138,15 @@ class Object
 	 */
 	Mesh* mesh = nullptr;
 
+	/**
+	 * @brief 해당 객체의 텍스처를 관리하는 텍스처 매니저.
+	 */
+	TextureManager* textures = nullptr;
+
 	/**
 	 * @brief 해당 객체의 텍스처.
 	 */
-	Texture* texture = nullptr;
+	TextureManager::Handle texture;
 };
 
 inline constexpr glm::vec3 Object::GetPosition() const noexcept
@@ -184,4 +204,14 @@ inline glm::mat4 Object::GetModelMatrix() const noexcept
     }
 
     return model;
+}
+
+inline bool Object::IsUniformScale() const noexcept
+{
+    if (scale.x != scale.y || scale.y != scale.z)
+    {
+        return false;
+    }
+
+    return parent == nullptr || parent->IsUniformScale();
 }
\ No newline at end of file
@@ -9,15 +9,13 @@
  */
 class Shader final
 {
+    friend class ShaderManager;
+
 public:
     /**
-     * @brief 생성자.
-     *
-     * @param vertex_   버텍스 셰이더 파일 경로.
-     * @param fragment_ 프래그먼트 셰이더 파일 경로.
+     * @brief 생성자. 프로그램은 ShaderManager가 빌드합니다.
      */
-    explicit Shader(const char* vertex_,
-                    const char* fragment_) noexcept;
+    explicit Shader() noexcept = default;
 
     /**
      * @brief 소멸자.
@@ -82,6 +80,15 @@ class Shader final
     inline void SetUniformVector4(const char* const name_,
                                   const glm::vec4& value_) const noexcept;
 
+    /**
+     * @brief 3x3 행렬 유니폼 변수를 설정합니다.
+     *
+     * @param name_  유니폼 변수 이름.
+     * @param value_ 설정할 값.
+     */
+    inline void SetUniformMatrix3x3(const char* const name_,
+                                    const glm::mat3& value_) const noexcept;
+
     /**
      * @brief 4x4 행렬 유니폼 변수를 설정합니다.
      *
@@ -138,6 +145,12 @@ inline void Shader::SetUniformVector4(const char* const name_, const glm::vec4&
     glUniform4fv(location, 1, glm::value_ptr(value_));
 }
 
+inline void Shader::SetUniformMatrix3x3(const char* const name_, const glm::mat3& value_) const noexcept
+{
+    const GLint location = glGetUniformLocation(programID, name_);
+    glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value_));
+}
+
 inline void Shader::SetUniformMatrix4x4(const char* name_, const glm::mat4& value_) const noexcept
 {
     const GLint location = glGetUniformLocation(programID, name_);
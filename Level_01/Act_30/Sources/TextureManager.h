@@ -0,0 +1,304 @@
+﻿#pragma once
+
+#include "PCH.h"
+
+#include "BlockCompressor.h"
+#include "MappedFile.h"
+
+class Shader;
+
+/**
+ * @class TextureManager
+ *
+ * @brief 텍스처를 경로 단위로 한 번만 불러오고, 같은 크기의 텍스처들을 텍스처 배열의 레이어로 묶어 관리합니다.
+ *
+ * PNG 디코딩과 밉 체인 생성, BC1/BC3 블록 압축은 백그라운드 스레드에서 수행되며, 완성된 밉 체인은 바이너리 캐시에 기록됩니다.
+ * 다음 실행부터는 캐시 파일을 메모리 매핑하여 디코딩과 압축 없이 그대로 업로드합니다.
+ * 오브젝트는 텍스처를 바꿀 때 텍스처를 다시 바인딩하는 대신 레이어 인덱스(uLayer)만 바꿉니다.
+ */
+class TextureManager final
+{
+public:
+    /**
+     * @struct Handle
+     *
+     * @brief 불러온 텍스처를 가리키는 핸들.
+     */
+    struct Handle final
+    {
+        /**
+         * @brief 텍스처 인덱스.
+         */
+        std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+
+        /**
+         * @brief 핸들이 유효한지 여부를 반환합니다.
+         *
+         * @return bool 유효 여부.
+         */
+        [[nodiscard]]
+        inline constexpr bool IsValid() const noexcept
+        {
+            return index != std::numeric_limits<std::uint32_t>::max();
+        }
+
+        bool operator==(const Handle&) const = default;
+    };
+
+    /**
+     * @brief 생성자.
+     *
+     * @param cacheDirectory_ 밉 체인 캐시를 저장할 디렉터리.
+     * @param quality_        블록 압축 품질. 바꾸면 기존 캐시는 다시 만들어집니다.
+     */
+    explicit TextureManager(const std::filesystem::path& cacheDirectory_,
+                            const BlockCompressor::Quality quality_ = BlockCompressor::Quality::Normal) noexcept;
+
+    /**
+     * @brief 소멸자. 진행 중인 디코딩이 끝날 때까지 기다립니다.
+     */
+    ~TextureManager() noexcept;
+
+    TextureManager(const TextureManager&) = delete;
+    TextureManager& operator=(const TextureManager&) = delete;
+
+    /**
+     * @brief 텍스처를 불러옵니다. 이미 불러온 경로라면 같은 핸들을 반환합니다.
+     *
+     * 이미지 헤더만 즉시 읽어 텍스처 배열의 레이어를 배정하고, 픽셀 데이터는 백그라운드에서 준비됩니다.
+     *
+     * @param path_ 불러올 이미지 파일 경로.
+     *
+     * @return Handle 텍스처 핸들. 실패 시 유효하지 않은 핸들.
+     */
+    [[nodiscard]]
+    Handle Load(const std::string& path_) noexcept;
+
+    /**
+     * @brief 준비가 끝난 텍스처들을 업로드합니다. 매 프레임 호출합니다.
+     */
+    void Update() noexcept;
+
+    /**
+     * @brief 모든 텍스처가 업로드될 때까지 기다립니다.
+     */
+    void Wait() noexcept;
+
+    /**
+     * @brief 텍스처를 사용하도록 셰이더를 설정합니다.
+     *
+     * 텍스처 배열이 이미 바인딩되어 있다면 레이어 인덱스만 갱신합니다.
+     *
+     * @param handle_ 사용할 텍스처 핸들.
+     * @param shader_ 설정할 셰이더.
+     */
+    void Bind(const Handle handle_, const Shader& shader_) noexcept;
+
+    /**
+     * @brief 바인딩 상태를 초기화합니다. 외부에서 텍스처 바인딩을 바꾼 뒤 호출합니다.
+     */
+    void Unbind() noexcept;
+
+private:
+    /**
+     * @struct MipChain
+     *
+     * @brief 모든 밉 레벨의 픽셀을 빽빽하게 이어 붙인 데이터.
+     */
+    struct MipChain final
+    {
+        /**
+         * @brief 0번 레벨의 너비.
+         */
+        int width = 0;
+
+        /**
+         * @brief 0번 레벨의 높이.
+         */
+        int height = 0;
+
+        /**
+         * @brief 밉 레벨 개수.
+         */
+        int levels = 0;
+
+        /**
+         * @brief 픽셀 데이터의 OpenGL 내부 형식.
+         */
+        GLenum format = GL_RGBA8;
+
+        /**
+         * @brief 새로 생성한 경우의 픽셀 데이터.
+         */
+        std::vector<std::byte> pixels;
+
+        /**
+         * @brief 캐시에서 불러온 경우의 매핑된 파일.
+         */
+        MappedFile mapped;
+
+        /**
+         * @brief 0번 레벨 픽셀의 시작 주소.
+         */
+        const std::byte* data = nullptr;
+    };
+
+    /**
+     * @struct Entry
+     *
+     * @brief 불러온 텍스처 하나의 상태.
+     */
+    struct Entry final
+    {
+        /**
+         * @brief 속한 텍스처 배열의 인덱스.
+         */
+        std::uint32_t array;
+
+        /**
+         * @brief 텍스처 배열 내 레이어.
+         */
+        std::uint32_t layer;
+
+        /**
+         * @brief 백그라운드에서 준비 중인 밉 체인.
+         */
+        std::future<MipChain> pending;
+    };
+
+    /**
+     * @struct TextureArray
+     *
+     * @brief 같은 크기의 텍스처들을 담는 텍스처 배열.
+     */
+    struct TextureArray final
+    {
+        /**
+         * @brief 텍스처 ID.
+         */
+        GLuint id;
+
+        /**
+         * @brief 레이어 너비.
+         */
+        int width;
+
+        /**
+         * @brief 레이어 높이.
+         */
+        int height;
+
+        /**
+         * @brief 밉 레벨 개수.
+         */
+        int levels;
+
+        /**
+         * @brief OpenGL 내부 형식.
+         */
+        GLenum format;
+
+        /**
+         * @brief 사용 중인 레이어 개수.
+         */
+        std::uint32_t layerCount;
+    };
+
+    /**
+     * @brief 텍스처 배열 하나가 담을 수 있는 최대 레이어 개수.
+     */
+    static constexpr std::uint32_t LAYERS_PER_ARRAY = 16;
+
+    /**
+     * @brief 텍스처 배열을 바인딩할 텍스처 유닛.
+     */
+    static constexpr GLint TEXTURE_UNIT = 0;
+
+    /**
+     * @brief 지정한 크기와 형식의 빈 레이어를 가진 텍스처 배열을 찾거나 새로 만듭니다.
+     *
+     * @param width_  레이어 너비.
+     * @param height_ 레이어 높이.
+     * @param format_ OpenGL 내부 형식.
+     *
+     * @return std::uint32_t 텍스처 배열의 인덱스.
+     */
+    std::uint32_t AcquireArray(const int width_, const int height_, const GLenum format_) noexcept;
+
+    /**
+     * @brief 밉 체인을 텍스처 배열의 레이어에 업로드합니다.
+     *
+     * @param entry_ 업로드할 텍스처.
+     * @param chain_ 업로드할 밉 체인.
+     */
+    void Upload(const Entry& entry_, const MipChain& chain_) const noexcept;
+
+    /**
+     * @brief 캐시에서 밉 체인을 불러오거나, 이미지를 디코딩하여 밉 체인을 만들고 캐시에 기록합니다. (백그라운드 스레드)
+     *
+     * @param sourcePath_ 원본 이미지 경로.
+     * @param cachePath_  캐시 파일 경로.
+     * @param format_     저장할 OpenGL 내부 형식. 압축 형식이라면 각 밉 레벨을 블록 압축합니다.
+     * @param quality_    블록 압축 품질.
+     *
+     * @return MipChain 준비된 밉 체인. 실패 시 비어 있습니다.
+     */
+    [[nodiscard]]
+    static MipChain Prepare(const std::filesystem::path& sourcePath_,
+                            const std::filesystem::path& cachePath_,
+                            const GLenum                 format_,
+                            const BlockCompressor::Quality quality_) noexcept;
+
+    /**
+     * @brief 지정한 크기의 밉 레벨 개수를 계산합니다.
+     */
+    [[nodiscard]]
+    static int ComputeLevels(const int width_, const int height_) noexcept;
+
+    /**
+     * @brief 밉 레벨 하나의 바이트 크기를 계산합니다.
+     */
+    [[nodiscard]]
+    static std::size_t ComputeLevelSize(const int width_, const int height_, const GLenum format_) noexcept;
+
+    /**
+     * @brief 밉 체인 전체의 바이트 크기를 계산합니다.
+     */
+    [[nodiscard]]
+    static std::size_t ComputeChainSize(const int width_, const int height_, const int levels_, const GLenum format_) noexcept;
+
+    /**
+     * @brief 캐시 파일을 저장할 디렉터리.
+     */
+    std::filesystem::path cacheDirectory;
+
+    /**
+     * @brief 경로 별 텍스처 인덱스.
+     */
+    std::unordered_map<std::string, std::uint32_t> lookup;
+
+    /**
+     * @brief 불러온 텍스처들.
+     */
+    std::vector<Entry> entries;
+
+    /**
+     * @brief 텍스처 배열들.
+     */
+    std::vector<TextureArray> arrays;
+
+    /**
+     * @brief 블록 압축 품질.
+     */
+    BlockCompressor::Quality quality;
+
+    /**
+     * @brief 드라이버가 BC1/BC3(S3TC) 형식을 지원하는지 여부.
+     */
+    bool isCompressionSupported;
+
+    /**
+     * @brief 현재 바인딩된 텍스처 배열 ID.
+     */
+    GLuint boundArray;
+};